@@ -17,6 +17,7 @@
 \defgroup buffer buffer: calculate buffer of a geometry
 \defgroup centroid centroid: calculate centroid (center of gravity) of a geometry
 \defgroup clear clear: clear geometries
+\defgroup clip_to_grid clip_to_grid: clip a geometry with all tiles of a grid
 \defgroup compare compare: define compare functors for points
 \defgroup concepts geometry concepts: defines and checks concepts for geometries
 \defgroup convert convert: convert geometries from one type to another
@@ -68,5 +69,6 @@
 \defgroup union union: calculate new geometry containing geometries A or B
 \defgroup unique unique: make a geometry unique w.r.t. points,
 \defgroup within within: detect if a geometry is inside another geometry, a.o. point-in-polygon
+\defgroup wkb wkb: read and write WKB (Well-Known Binary) and EWKB
 \defgroup wkt wkt: parse and stream WKT (Well-Known Text)
 */
@@ -80,7 +80,7 @@ def cs_to_quickbook(section):
 
 call_doxygen()
 
-algorithms = ["append", "assign", "make", "clear"
+algorithms = ["append", "assign", "make", "clear", "clip_to_grid"
     , "area", "buffer", "centroid", "convert", "correct", "covered_by"
     , "convex_hull", "crosses", "difference", "disjoint", "distance" 
     , "envelope", "equals", "expand", "for_each", "is_simple", "is_valid"
@@ -121,8 +121,8 @@ strategies = ["distance::pythagoras", "distance::pythagoras_box_box"
     , "buffer::distance_symmetric", "buffer::distance_asymmetric"
     , "buffer::side_straight"
     , "centroid::bashein_detmer", "centroid::average"
-    , "convex_hull::graham_andrew"
-    , "simplify::douglas_peucker"
+    , "convex_hull::graham_andrew", "convex_hull::akl_toussaint"
+    , "simplify::douglas_peucker", "simplify::visvalingam_whyatt"
     , "side::side_by_triangle", "side::side_by_cross_track", "side::spherical_side_formula"
     , "transform::inverse_transformer", "transform::map_transformer"
     , "transform::rotate_transformer", "transform::scale_transformer"
@@ -130,7 +130,7 @@ strategies = ["distance::pythagoras", "distance::pythagoras_box_box"
     ]
     
 views = ["box_view", "segment_view"
-    , "closeable_view", "reversible_view", "identity_view"]
+    , "closeable_view", "reversible_view", "identity_view", "sectioned"]
 
 
 
@@ -169,6 +169,7 @@ group_to_quickbook("enum")
 group_to_quickbook("register")
 group_to_quickbook("svg")
 class_to_quickbook("svg_mapper")
+group_to_quickbook("wkb")
 group_to_quickbook("wkt")
 
 os.chdir("index")
@@ -0,0 +1,109 @@
+// Boost.Geometry (aka GGL, Generic Geometry Library)
+// Benchmark of reading WKT
+
+// Copyright (c) 2026 agent.
+
+// Use, modification and distribution is subject to the Boost Software License,
+// Version 1.0. (See accompanying file LICENSE_1_0.txt or copy at
+// http://www.boost.org/LICENSE_1_0.txt)
+
+#include <cstring>
+#include <iomanip>
+#include <iostream>
+#include <sstream>
+#include <string>
+#include <vector>
+
+#include <boost/chrono.hpp>
+#include <boost/random.hpp>
+
+#include <boost/geometry.hpp>
+#include <boost/geometry/geometries/point_xy.hpp>
+
+namespace bg = boost::geometry;
+
+typedef bg::model::d2::point_xy<double> point_type;
+typedef bg::model::polygon<point_type> polygon_type;
+typedef boost::chrono::thread_clock bench_clock_t;
+typedef boost::chrono::duration<float> dur_t;
+
+
+// Polygons with random coordinates, as written by a database, one per line
+std::string generate(std::size_t polygons_count, std::size_t points_count)
+{
+    boost::mt19937 rng;
+    boost::uniform_real<double> coordinate(-180.0, 180.0);
+    boost::variate_generator<boost::mt19937&, boost::uniform_real<double> >
+        generator(rng, coordinate);
+
+    std::ostringstream out;
+    out << std::setprecision(15);
+    for (std::size_t i = 0; i < polygons_count; i++)
+    {
+        out << "POLYGON((";
+        double const x0 = generator(), y0 = generator();
+        out << x0 << " " << y0;
+        for (std::size_t j = 1; j + 1 < points_count; j++)
+        {
+            out << "," << generator() << " " << generator();
+        }
+        out << "," << x0 << " " << y0 << "))\n";
+    }
+    return out.str();
+}
+
+int main()
+{
+    std::size_t const polygons_count = 20000;
+    std::size_t const points_count = 50;
+
+    std::string const buffer = generate(polygons_count, points_count);
+    std::cout << "WKT of " << buffer.size() / (1024 * 1024) << " MB, "
+              << polygons_count << " polygons of " << points_count
+              << " points" << std::endl;
+
+    std::vector<std::string> lines;
+    {
+        std::istringstream in(buffer);
+        std::string line;
+        while (std::getline(in, line))
+        {
+            lines.push_back(line);
+        }
+    }
+
+    double area_string = 0, area_range = 0;
+    {
+        polygon_type polygon;
+        bench_clock_t::time_point start = bench_clock_t::now();
+        for (std::size_t i = 0; i < lines.size(); i++)
+        {
+            bg::read_wkt(lines[i], polygon);
+            area_string += bg::area(polygon);
+        }
+        dur_t time = bench_clock_t::now() - start;
+        std::cout << time << " - read_wkt of std::string" << std::endl;
+    }
+
+    {
+        polygon_type polygon;
+        bench_clock_t::time_point start = bench_clock_t::now();
+        char const* first = buffer.data();
+        char const* const end = first + buffer.size();
+        while (first != end)
+        {
+            char const* last = static_cast<char const*>(
+                        std::memchr(first, '\n', end - first));
+            bg::read_wkt(first, last, polygon);
+            area_range += bg::area(polygon);
+            first = last + 1;
+        }
+        dur_t time = bench_clock_t::now() - start;
+        std::cout << time << " - read_wkt of character range" << std::endl;
+    }
+
+    // Both should have read the same polygons
+    std::cout << "Total area: " << area_string << " " << area_range << std::endl;
+
+    return 0;
+}
@@ -0,0 +1,112 @@
+// Boost.Geometry (aka GGL, Generic Geometry Library)
+// Benchmark of writing and reading WKB, compared to WKT
+
+// Copyright (c) 2026 agent.
+
+// Use, modification and distribution is subject to the Boost Software License,
+// Version 1.0. (See accompanying file LICENSE_1_0.txt or copy at
+// http://www.boost.org/LICENSE_1_0.txt)
+
+#include <iostream>
+#include <iterator>
+#include <sstream>
+#include <string>
+#include <vector>
+
+#include <boost/chrono.hpp>
+#include <boost/random.hpp>
+
+#include <boost/geometry.hpp>
+#include <boost/geometry/geometries/point_xy.hpp>
+
+namespace bg = boost::geometry;
+
+typedef bg::model::d2::point_xy<double> point_type;
+typedef bg::model::polygon<point_type> polygon_type;
+typedef boost::chrono::thread_clock bench_clock_t;
+typedef boost::chrono::duration<float> dur_t;
+
+
+std::vector<polygon_type> generate(std::size_t polygons_count,
+            std::size_t points_count)
+{
+    boost::mt19937 rng;
+    boost::uniform_real<double> coordinate(-180.0, 180.0);
+    boost::variate_generator<boost::mt19937&, boost::uniform_real<double> >
+        generator(rng, coordinate);
+
+    std::vector<polygon_type> result(polygons_count);
+    for (std::size_t i = 0; i < polygons_count; i++)
+    {
+        for (std::size_t j = 0; j + 1 < points_count; j++)
+        {
+            bg::append(result[i], point_type(generator(), generator()));
+        }
+        bg::append(result[i], bg::exterior_ring(result[i]).front());
+    }
+    return result;
+}
+
+int main()
+{
+    std::size_t const polygons_count = 20000;
+    std::size_t const points_count = 50;
+
+    std::vector<polygon_type> const polygons
+        = generate(polygons_count, points_count);
+    std::cout << polygons_count << " polygons of " << points_count
+              << " points" << std::endl;
+
+    double area_wkt = 0, area_wkb = 0;
+    {
+        bench_clock_t::time_point start = bench_clock_t::now();
+        std::vector<std::string> lines(polygons.size());
+        for (std::size_t i = 0; i < polygons.size(); i++)
+        {
+            std::ostringstream out;
+            out.precision(17);
+            out << bg::wkt(polygons[i]);
+            lines[i] = out.str();
+        }
+        dur_t write_time = bench_clock_t::now() - start;
+
+        start = bench_clock_t::now();
+        polygon_type polygon;
+        for (std::size_t i = 0; i < lines.size(); i++)
+        {
+            bg::read_wkt(lines[i], polygon);
+            area_wkt += bg::area(polygon);
+        }
+        dur_t read_time = bench_clock_t::now() - start;
+        std::cout << write_time << " - write_wkt" << std::endl
+                  << read_time << " - read_wkt" << std::endl;
+    }
+
+    {
+        bench_clock_t::time_point start = bench_clock_t::now();
+        std::vector<unsigned char> buffer;
+        for (std::size_t i = 0; i < polygons.size(); i++)
+        {
+            bg::write_wkb(polygons[i], std::back_inserter(buffer));
+        }
+        dur_t write_time = bench_clock_t::now() - start;
+
+        start = bench_clock_t::now();
+        polygon_type polygon;
+        std::vector<unsigned char>::const_iterator it = buffer.begin();
+        std::vector<unsigned char>::const_iterator const end = buffer.end();
+        while (it != end)
+        {
+            it = bg::read_wkb(it, end, polygon);
+            area_wkb += bg::area(polygon);
+        }
+        dur_t read_time = bench_clock_t::now() - start;
+        std::cout << write_time << " - write_wkb" << std::endl
+                  << read_time << " - read_wkb" << std::endl;
+    }
+
+    // Both should have read the same polygons
+    std::cout << "Total area: " << area_wkt << " " << area_wkb << std::endl;
+
+    return 0;
+}
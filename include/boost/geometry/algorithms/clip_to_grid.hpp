@@ -0,0 +1,754 @@
+// Boost.Geometry (aka GGL, Generic Geometry Library)
+
+// Copyright (c) 2026 agent.
+
+// Use, modification and distribution is subject to the Boost Software License,
+// Version 1.0. (See accompanying file LICENSE_1_0.txt or copy at
+// http://www.boost.org/LICENSE_1_0.txt)
+
+#ifndef BOOST_GEOMETRY_ALGORITHMS_CLIP_TO_GRID_HPP
+#define BOOST_GEOMETRY_ALGORITHMS_CLIP_TO_GRID_HPP
+
+#include <cstddef>
+#include <algorithm>
+#include <deque>
+#include <iterator>
+#include <map>
+#include <vector>
+
+#include <boost/numeric/conversion/cast.hpp>
+#include <boost/range.hpp>
+
+#include <boost/geometry/core/access.hpp>
+#include <boost/geometry/core/coordinate_type.hpp>
+#include <boost/geometry/core/exterior_ring.hpp>
+#include <boost/geometry/core/interior_rings.hpp>
+#include <boost/geometry/core/point_order.hpp>
+#include <boost/geometry/core/point_type.hpp>
+#include <boost/geometry/core/tag.hpp>
+#include <boost/geometry/core/tags.hpp>
+
+#include <boost/geometry/geometries/concepts/check.hpp>
+#include <boost/geometry/geometries/segment.hpp>
+
+#include <boost/geometry/algorithms/append.hpp>
+#include <boost/geometry/algorithms/convert.hpp>
+#include <boost/geometry/algorithms/intersection.hpp>
+#include <boost/geometry/algorithms/not_implemented.hpp>
+#include <boost/geometry/algorithms/detail/interior_iterator.hpp>
+#include <boost/geometry/algorithms/detail/overlay/append_no_duplicates.hpp>
+#include <boost/geometry/algorithms/detail/overlay/clip_linestring.hpp>
+#include <boost/geometry/algorithms/detail/overlay/clip_polygon.hpp>
+
+#include <boost/geometry/util/range.hpp>
+#include <boost/geometry/util/select_most_precise.hpp>
+
+#include <boost/geometry/views/detail/normalized_view.hpp>
+
+
+namespace boost { namespace geometry
+{
+
+
+/*!
+\brief Grid of tiles, dividing a box into columns and rows of equal size
+\ingroup clip_to_grid
+\tparam Box type of the box covered by the grid, and of its tiles
+*/
+template <typename Box>
+class grid_spec
+{
+public :
+    typedef Box box_type;
+    typedef typename geometry::coordinate_type<Box>::type coordinate_type;
+
+    /*!
+    \brief Constructor
+    \param box the box covered by the grid
+    \param columns the number of tiles in x direction
+    \param rows the number of tiles in y direction
+    */
+    grid_spec(Box const& box, std::size_t columns, std::size_t rows)
+        : m_box(box)
+        , m_columns(columns)
+        , m_rows(rows)
+    {}
+
+    inline Box const& box() const { return m_box; }
+    inline std::size_t columns() const { return m_columns; }
+    inline std::size_t rows() const { return m_rows; }
+
+    //! Returns the left side of a column, or the right side of the grid
+    inline coordinate_type x(std::size_t column) const
+    {
+        return line<0>(column, m_columns);
+    }
+
+    //! Returns the bottom side of a row, or the top side of the grid
+    inline coordinate_type y(std::size_t row) const
+    {
+        return line<1>(row, m_rows);
+    }
+
+    //! Returns the box of the tile in a column and a row
+    inline Box tile(std::size_t column, std::size_t row) const
+    {
+        Box result;
+        geometry::set<min_corner, 0>(result, x(column));
+        geometry::set<min_corner, 1>(result, y(row));
+        geometry::set<max_corner, 0>(result, x(column + 1));
+        geometry::set<max_corner, 1>(result, y(row + 1));
+        return result;
+    }
+
+private :
+    template <std::size_t Dimension>
+    inline coordinate_type line(std::size_t index, std::size_t count) const
+    {
+        coordinate_type const min = geometry::get<min_corner, Dimension>(m_box);
+        coordinate_type const max = geometry::get<max_corner, Dimension>(m_box);
+        if (index >= count)
+        {
+            return max;
+        }
+        return min + (max - min) * boost::numeric_cast<coordinate_type>(index)
+                                 / boost::numeric_cast<coordinate_type>(count);
+    }
+
+    Box m_box;
+    std::size_t m_columns;
+    std::size_t m_rows;
+};
+
+
+#ifndef DOXYGEN_NO_DETAIL
+namespace detail { namespace clip_to_grid
+{
+
+// The lines of the grid, to find the tiles touched by a segment
+template <typename CalculationType>
+struct grid_lines
+{
+    typedef CalculationType calculation_type;
+
+    template <typename Box>
+    explicit grid_lines(grid_spec<Box> const& grid)
+    {
+        for (std::size_t i = 0; i <= grid.columns(); i++)
+        {
+            xs.push_back(grid.x(i));
+        }
+        for (std::size_t i = 0; i <= grid.rows(); i++)
+        {
+            ys.push_back(grid.y(i));
+        }
+        for (std::size_t i = 0; i < grid.rows(); i++)
+        {
+            centers.push_back((ys[i] + ys[i + 1]) / 2);
+        }
+    }
+
+    // Gets the tiles between two lines of which the (closed) interval
+    // overlaps the interval [low, high]
+    static inline bool tile_range(std::vector<calculation_type> const& lines,
+                calculation_type const& low, calculation_type const& high,
+                std::size_t& first, std::size_t& last)
+    {
+        if (high < lines.front() || low > lines.back())
+        {
+            return false;
+        }
+        std::size_t const count = lines.size() - 1;
+        first = std::lower_bound(lines.begin() + 1, lines.end(), low)
+              - (lines.begin() + 1);
+        last = std::upper_bound(lines.begin(), lines.end() - 1, high)
+             - lines.begin();
+        first = (std::min)(first, count - 1);
+        last = last > 0 ? last - 1 : 0;
+        return first <= last;
+    }
+
+    std::vector<calculation_type> xs;
+    std::vector<calculation_type> ys;
+
+    // The horizontal lines through the centers of the rows
+    std::vector<calculation_type> centers;
+};
+
+// Calls the visitor for all tiles touched by the segment, and maybe some
+// tiles near the segment
+template <typename Lines, typename Point, typename Visitor>
+inline void route_segment(Lines const& lines,
+            Point const& p1, Point const& p2, Visitor& visitor)
+{
+    typedef typename Lines::calculation_type calculation_type;
+
+    calculation_type const x1 = geometry::get<0>(p1);
+    calculation_type const y1 = geometry::get<1>(p1);
+    calculation_type const x2 = geometry::get<0>(p2);
+    calculation_type const y2 = geometry::get<1>(p2);
+
+    std::size_t first_column, last_column, first_row, last_row;
+    if (! Lines::tile_range(lines.xs, (std::min)(x1, x2), (std::max)(x1, x2),
+                            first_column, last_column)
+        || ! Lines::tile_range(lines.ys, (std::min)(y1, y2), (std::max)(y1, y2),
+                               first_row, last_row))
+    {
+        return;
+    }
+
+    for (std::size_t column = first_column; column <= last_column; column++)
+    {
+        std::size_t low_row = first_row;
+        std::size_t high_row = last_row;
+        if (first_column < last_column && first_row < last_row)
+        {
+            // Get the rows of the part of the segment in this column,
+            // one more at both sides because of rounding
+            calculation_type const xa = (std::max)((std::min)(x1, x2),
+                                                   lines.xs[column]);
+            calculation_type const xb = (std::min)((std::max)(x1, x2),
+                                                   lines.xs[column + 1]);
+            calculation_type const ya = y1 + (xa - x1) * (y2 - y1) / (x2 - x1);
+            calculation_type const yb = y1 + (xb - x1) * (y2 - y1) / (x2 - x1);
+            if (Lines::tile_range(lines.ys, (std::min)(ya, yb),
+                                  (std::max)(ya, yb), low_row, high_row))
+            {
+                low_row = (std::max)(low_row, first_row + 1) - 1;
+                high_row = (std::min)(high_row + 1, last_row);
+            }
+            else
+            {
+                low_row = first_row;
+                high_row = last_row;
+            }
+        }
+
+        for (std::size_t row = low_row; row <= high_row; row++)
+        {
+            visitor.apply(column, row, p1, p2);
+        }
+    }
+}
+
+
+// Clips the rings of polygons with all tiles. Every tile touched by a ring
+// has its own polygon_box_clipper, getting the segments in order. The tiles
+// not touched by any ring are completely inside or outside the polygons,
+// which is found by the crossings of the rings with the horizontal lines
+// through the centers of the rows
+template <typename Box, typename PolygonOut>
+class areal_grid_clipper
+{
+    typedef typename point_type<PolygonOut>::type point_type;
+    typedef intersection::polygon_box_clipper<Box, point_type> clipper_type;
+    typedef typename clipper_type::calculation_type calculation_type;
+
+    static const bool reverse_out
+        = geometry::point_order<PolygonOut>::value == counterclockwise;
+
+    struct tile
+    {
+        tile(Box const& box, std::size_t c, std::size_t r)
+            : clipper(box)
+            , column(c)
+            , row(r)
+            , ring_index(0)
+            , border_inside(false)
+        {}
+
+        clipper_type clipper;
+        std::size_t column, row;
+        std::size_t ring_index;
+        bool border_inside;
+    };
+
+public :
+    explicit areal_grid_clipper(grid_spec<Box> const& grid)
+        : m_grid(grid)
+        , m_lines(grid)
+        , m_crossings(grid.rows())
+        , m_ring_index(0)
+    {}
+
+    template <typename Geometry>
+    inline void add(Geometry const& geometry)
+    {
+        add(geometry, typename tag<Geometry>::type());
+    }
+
+    // Adds a segment of the current ring to a tile
+    inline void apply(std::size_t column, std::size_t row,
+                point_type const& p1, point_type const& p2)
+    {
+        std::size_t const index = get_tile(column, row);
+        tile& t = m_tiles[index];
+        if (t.ring_index != m_ring_index)
+        {
+            t.ring_index = m_ring_index;
+            t.clipper.begin_ring();
+            m_ring_tiles.push_back(index);
+        }
+        t.clipper.add_segment(p1, p2, t.clipper.location(p1),
+                              t.clipper.location(p2));
+    }
+
+    template <typename GeometryOut, typename Geometry, typename Visitor>
+    inline void output(Geometry const& geometry, Visitor& visitor)
+    {
+        // Find the tiles of which the border is inside the polygons
+        std::vector<std::size_t> inside_tiles;
+        std::size_t const columns = m_grid.columns();
+        for (std::size_t row = 0; row < m_crossings.size(); row++)
+        {
+            std::vector<calculation_type>& crossings = m_crossings[row];
+            std::sort(crossings.begin(), crossings.end());
+            for (std::size_t i = 0; i + 1 < crossings.size(); i += 2)
+            {
+                std::size_t const first = std::upper_bound(m_lines.xs.begin(),
+                        m_lines.xs.end() - 1, crossings[i]) - m_lines.xs.begin();
+                std::size_t const last = std::lower_bound(m_lines.xs.begin(),
+                        m_lines.xs.end() - 1, crossings[i + 1]) - m_lines.xs.begin();
+                for (std::size_t column = first; column < last; column++)
+                {
+                    std::size_t const key = row * columns + column;
+                    std::map<std::size_t, std::size_t>::const_iterator it
+                        = m_index.find(key);
+                    if (it != m_index.end())
+                    {
+                        m_tiles[it->second].border_inside = true;
+                    }
+                    else
+                    {
+                        inside_tiles.push_back(key);
+                    }
+                }
+            }
+        }
+
+        // Output all tiles in order of their keys
+        std::map<std::size_t, std::size_t>::const_iterator it = m_index.begin();
+        std::vector<std::size_t>::const_iterator inside_it = inside_tiles.begin();
+        while (it != m_index.end() || inside_it != inside_tiles.end())
+        {
+            if (inside_it == inside_tiles.end()
+                || (it != m_index.end() && it->first < *inside_it))
+            {
+                output_tile<GeometryOut>(m_tiles[it->second], geometry, visitor);
+                ++it;
+            }
+            else
+            {
+                std::size_t const column = *inside_it % columns;
+                std::size_t const row = *inside_it / columns;
+                tile t(m_grid.tile(column, row), column, row);
+                t.border_inside = true;
+                output_tile<GeometryOut>(t, geometry, visitor);
+                ++inside_it;
+            }
+        }
+    }
+
+private :
+    template <typename Ring>
+    inline void add(Ring const& ring, ring_tag)
+    {
+        add_ring(ring, true);
+    }
+
+    template <typename Polygon>
+    inline void add(Polygon const& polygon, polygon_tag)
+    {
+        add_ring(geometry::exterior_ring(polygon), true);
+
+        typename interior_return_type<Polygon const>::type
+            rings = geometry::interior_rings(polygon);
+        for (typename detail::interior_iterator<Polygon const>::type
+                it = boost::begin(rings); it != boost::end(rings); ++it)
+        {
+            add_ring(*it, false);
+        }
+    }
+
+    template <typename MultiPolygon>
+    inline void add(MultiPolygon const& multi_polygon, multi_polygon_tag)
+    {
+        for (typename boost::range_iterator<MultiPolygon const>::type
+                it = boost::begin(multi_polygon);
+            it != boost::end(multi_polygon); ++it)
+        {
+            add(*it, polygon_tag());
+        }
+    }
+
+    template <typename Ring>
+    inline void add_ring(Ring const& ring, bool exterior)
+    {
+        typedef detail::normalized_view<Ring const> view_type;
+        view_type view(ring);
+
+        m_ring.clear();
+        for (typename boost::range_iterator<view_type const>::type
+                it = boost::begin(view); it != boost::end(view); ++it)
+        {
+            point_type point;
+            geometry::convert(*it, point);
+            m_ring.push_back(point);
+        }
+        if (m_ring.size() < 4)
+        {
+            return;
+        }
+
+        m_ring_index++;
+        m_ring_tiles.clear();
+        for (std::size_t i = 0; i + 1 < m_ring.size(); i++)
+        {
+            route_segment(m_lines, m_ring[i], m_ring[i + 1], *this);
+            add_crossings(m_ring[i], m_ring[i + 1]);
+        }
+        for (std::size_t i = 0; i < m_ring_tiles.size(); i++)
+        {
+            m_tiles[m_ring_tiles[i]].clipper.end_ring(exterior);
+        }
+    }
+
+    inline void add_crossings(point_type const& p1, point_type const& p2)
+    {
+        calculation_type const x1 = geometry::get<0>(p1);
+        calculation_type const y1 = geometry::get<1>(p1);
+        calculation_type const x2 = geometry::get<0>(p2);
+        calculation_type const y2 = geometry::get<1>(p2);
+        if (y1 == y2)
+        {
+            return;
+        }
+
+        std::vector<calculation_type> const& centers = m_lines.centers;
+        std::size_t const first = std::lower_bound(centers.begin(),
+                centers.end(), (std::min)(y1, y2)) - centers.begin();
+        std::size_t const last = std::upper_bound(centers.begin(),
+                centers.end(), (std::max)(y1, y2)) - centers.begin();
+        for (std::size_t row = first; row < last; row++)
+        {
+            calculation_type const& y = centers[row];
+            if ((y1 > y) != (y2 > y))
+            {
+                m_crossings[row].push_back(x1 + (y - y1) * (x2 - x1) / (y2 - y1));
+            }
+        }
+    }
+
+    inline std::size_t get_tile(std::size_t column, std::size_t row)
+    {
+        std::size_t const key = row * m_grid.columns() + column;
+        std::map<std::size_t, std::size_t>::iterator it = m_index.lower_bound(key);
+        if (it != m_index.end() && it->first == key)
+        {
+            return it->second;
+        }
+        m_index.insert(it, std::make_pair(key, m_tiles.size()));
+        m_tiles.push_back(tile(m_grid.tile(column, row), column, row));
+        return m_tiles.size() - 1;
+    }
+
+    template <typename GeometryOut, typename Geometry, typename Visitor>
+    inline void output_tile(tile& t, Geometry const& geometry, Visitor& visitor)
+    {
+        GeometryOut geometry_out;
+        if (t.clipper.assemble(t.border_inside))
+        {
+            t.clipper.template output<PolygonOut, reverse_out>(
+                    std::back_inserter(geometry_out));
+        }
+        else
+        {
+            // Degenerate, the rings touch the tile border
+            geometry::intersection(geometry, m_grid.tile(t.column, t.row),
+                                   geometry_out);
+        }
+        if (! boost::empty(geometry_out))
+        {
+            visitor(t.column, t.row, geometry_out);
+        }
+    }
+
+    grid_spec<Box> const& m_grid;
+    grid_lines<calculation_type> m_lines;
+    std::deque<tile> m_tiles;
+    std::map<std::size_t, std::size_t> m_index;
+    std::vector<std::vector<calculation_type> > m_crossings;
+
+    std::vector<point_type> m_ring;
+    std::vector<std::size_t> m_ring_tiles;
+    std::size_t m_ring_index;
+};
+
+
+// Clips linestrings with all tiles, every tile keeps the pieces of the
+// linestrings inside it
+template <typename Box, typename LinestringOut>
+class linear_grid_clipper
+{
+    typedef typename point_type<LinestringOut>::type point_type;
+    typedef typename select_most_precise
+        <
+            typename coordinate_type<Box>::type,
+            typename coordinate_type<point_type>::type,
+            double
+        >::type calculation_type;
+
+    struct tile
+    {
+        tile(std::size_t c, std::size_t r)
+            : column(c)
+            , row(r)
+            , line_index(0)
+            , open(false)
+        {}
+
+        std::size_t column, row;
+        std::vector<LinestringOut> lines;
+        std::size_t line_index;
+        bool open;
+    };
+
+public :
+    explicit linear_grid_clipper(grid_spec<Box> const& grid)
+        : m_grid(grid)
+        , m_lines(grid)
+        , m_line_index(0)
+    {}
+
+    template <typename Geometry>
+    inline void add(Geometry const& geometry)
+    {
+        add(geometry, typename tag<Geometry>::type());
+    }
+
+    // Adds a segment of the current linestring to a tile
+    inline void apply(std::size_t column, std::size_t row,
+                point_type const& p1, point_type const& p2)
+    {
+        Box const box = m_grid.tile(column, row);
+        point_type s1 = p1, s2 = p2;
+        model::referring_segment<point_type> segment(s1, s2);
+        bool c1 = false, c2 = false;
+        if (! m_strategy.clip_segment(box, segment, c1, c2))
+        {
+            return;
+        }
+
+        std::size_t const key = row * m_grid.columns() + column;
+        std::map<std::size_t, std::size_t>::iterator it = m_index.lower_bound(key);
+        if (it == m_index.end() || it->first != key)
+        {
+            it = m_index.insert(it, std::make_pair(key, m_tiles.size()));
+            m_tiles.push_back(tile(column, row));
+        }
+
+        tile& t = m_tiles[it->second];
+        if (t.line_index != m_line_index)
+        {
+            t.line_index = m_line_index;
+            t.open = false;
+        }
+        if (c1 || ! t.open)
+        {
+            t.lines.resize(t.lines.size() + 1);
+            geometry::append(t.lines.back(), s1);
+        }
+        detail::overlay::append_no_duplicates(t.lines.back(), s2);
+        t.open = ! c2;
+    }
+
+    template <typename GeometryOut, typename Geometry, typename Visitor>
+    inline void output(Geometry const& , Visitor& visitor)
+    {
+        for (std::map<std::size_t, std::size_t>::const_iterator it
+                = m_index.begin(); it != m_index.end(); ++it)
+        {
+            tile const& t = m_tiles[it->second];
+            GeometryOut geometry_out;
+            for (std::size_t i = 0; i < t.lines.size(); i++)
+            {
+                // Skip the pieces touching the tile at one point
+                if (boost::size(t.lines[i]) >= 2)
+                {
+                    range::push_back(geometry_out, t.lines[i]);
+                }
+            }
+            if (! boost::empty(geometry_out))
+            {
+                visitor(t.column, t.row, geometry_out);
+            }
+        }
+    }
+
+private :
+    template <typename Linestring>
+    inline void add(Linestring const& linestring, linestring_tag)
+    {
+        m_line_index++;
+        typedef typename boost::range_iterator<Linestring const>::type iterator;
+        iterator it = boost::begin(linestring);
+        if (it == boost::end(linestring))
+        {
+            return;
+        }
+        point_type p1, p2;
+        geometry::convert(*it, p1);
+        for (++it; it != boost::end(linestring); ++it)
+        {
+            geometry::convert(*it, p2);
+            route_segment(m_lines, p1, p2, *this);
+            p1 = p2;
+        }
+    }
+
+    template <typename MultiLinestring>
+    inline void add(MultiLinestring const& multi_linestring,
+                multi_linestring_tag)
+    {
+        for (typename boost::range_iterator<MultiLinestring const>::type
+                it = boost::begin(multi_linestring);
+            it != boost::end(multi_linestring); ++it)
+        {
+            add(*it, linestring_tag());
+        }
+    }
+
+    grid_spec<Box> const& m_grid;
+    grid_lines<calculation_type> m_lines;
+    strategy::intersection::liang_barsky<Box, point_type> m_strategy;
+    std::deque<tile> m_tiles;
+    std::map<std::size_t, std::size_t> m_index;
+    std::size_t m_line_index;
+};
+
+
+template <template <typename, typename> class Clipper>
+struct clip_to_grid
+{
+    template
+    <
+        typename GeometryOut,
+        typename Geometry, typename Box, typename Visitor
+    >
+    static inline void apply(Geometry const& geometry,
+                grid_spec<Box> const& grid, Visitor& visitor)
+    {
+        if (grid.columns() == 0 || grid.rows() == 0)
+        {
+            return;
+        }
+
+        typedef typename boost::range_value<GeometryOut>::type single_out;
+        Clipper<Box, single_out> clipper(grid);
+        clipper.add(geometry);
+        clipper.template output<GeometryOut>(geometry, visitor);
+    }
+};
+
+
+}} // namespace detail::clip_to_grid
+#endif // DOXYGEN_NO_DETAIL
+
+
+#ifndef DOXYGEN_NO_DISPATCH
+namespace dispatch
+{
+
+template <typename Geometry, typename Tag = typename tag<Geometry>::type>
+struct clip_to_grid : not_implemented<Tag>
+{};
+
+template <typename Ring>
+struct clip_to_grid<Ring, ring_tag>
+    : detail::clip_to_grid::clip_to_grid
+        <
+            detail::clip_to_grid::areal_grid_clipper
+        >
+{};
+
+template <typename Polygon>
+struct clip_to_grid<Polygon, polygon_tag>
+    : detail::clip_to_grid::clip_to_grid
+        <
+            detail::clip_to_grid::areal_grid_clipper
+        >
+{};
+
+template <typename MultiPolygon>
+struct clip_to_grid<MultiPolygon, multi_polygon_tag>
+    : detail::clip_to_grid::clip_to_grid
+        <
+            detail::clip_to_grid::areal_grid_clipper
+        >
+{};
+
+template <typename Linestring>
+struct clip_to_grid<Linestring, linestring_tag>
+    : detail::clip_to_grid::clip_to_grid
+        <
+            detail::clip_to_grid::linear_grid_clipper
+        >
+{};
+
+template <typename MultiLinestring>
+struct clip_to_grid<MultiLinestring, multi_linestring_tag>
+    : detail::clip_to_grid::clip_to_grid
+        <
+            detail::clip_to_grid::linear_grid_clipper
+        >
+{};
+
+} // namespace dispatch
+#endif // DOXYGEN_NO_DISPATCH
+
+
+/*!
+\brief Clips a geometry with all tiles of a grid, in one pass
+\ingroup clip_to_grid
+\details Each segment of the geometry is routed to the tiles it touches, and
+    the parts inside each tile are assembled per tile. So the geometry is
+    traversed once, instead of once per tile, and the cost is proportional to
+    the size of the input plus the size of the output. The tiles completely
+    inside a polygon, not touched by its rings, are found without visiting
+    the geometry again. The result of each tile is the same as the
+    intersection of the geometry with the box of the tile.
+    The visitor is called as visitor(column, row, geometry_out) for every tile
+    with a non-empty result, ordered by row and then by column.
+\tparam GeometryOut collection of output geometries, polygons for areal
+    input and linestrings for linear input (e.g. a multi_polygon or a
+    std::vector of linestrings)
+\tparam Geometry \tparam_geometry
+\tparam Box type of the box of the grid
+\tparam Visitor function object called for every non-empty tile
+\param geometry \param_geometry which will be clipped
+\param grid the grid, defining the tiles
+\param visitor the visitor, receiving the result of every tile
+\note Tiles where a ring touches the border of the tile (e.g. a vertex
+    located exactly on a grid line) are clipped by the intersection of the
+    geometry with the tile, which is slower
+*/
+template
+<
+    typename GeometryOut,
+    typename Geometry, typename Box, typename Visitor
+>
+inline void clip_to_grid(Geometry const& geometry,
+            grid_spec<Box> const& grid, Visitor& visitor)
+{
+    concept::check<Geometry const>();
+    concept::check<Box const>();
+
+    dispatch::clip_to_grid<Geometry>::template apply<GeometryOut>(geometry,
+                grid, visitor);
+}
+
+
+}} // namespace boost::geometry
+
+
+#endif // BOOST_GEOMETRY_ALGORITHMS_CLIP_TO_GRID_HPP
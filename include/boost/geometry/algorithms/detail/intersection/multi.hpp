@@ -198,7 +198,7 @@ struct clip_multi_linestring
     >
     static inline OutputIterator apply(MultiLinestring const& multi_linestring,
             Box const& box,
-            RobustPolicy const& robust_policy,
+            RobustPolicy const& ,
             OutputIterator out, Strategy const& )
     {
         typedef typename point_type<LinestringOut>::type point_type;
@@ -208,7 +208,41 @@ struct clip_multi_linestring
             it != boost::end(multi_linestring); ++it)
         {
             out = detail::intersection::clip_range_with_box
-                <LinestringOut>(box, *it, robust_policy, out, lb_strategy);
+                <LinestringOut>(box, *it, out, lb_strategy);
+        }
+        return out;
+    }
+};
+
+
+template
+<
+    typename PolygonOut,
+    bool Reverse1, bool Reverse2, bool ReverseOut
+>
+struct clip_multi_polygon_with_box
+{
+    template
+    <
+        typename MultiPolygon, typename Box,
+        typename RobustPolicy,
+        typename OutputIterator, typename Strategy
+    >
+    static inline OutputIterator apply(MultiPolygon const& multi_polygon,
+            Box const& box,
+            RobustPolicy const& robust_policy,
+            OutputIterator out,
+            Strategy const& strategy)
+    {
+        // The polygons are disjoint, so their clipped polygons are disjoint
+        for (typename boost::range_iterator<MultiPolygon const>::type it
+            = boost::begin(multi_polygon);
+            it != boost::end(multi_polygon); ++it)
+        {
+            out = detail::intersection::clip_polygon_with_box
+                <
+                    PolygonOut, Reverse1, Reverse2, ReverseOut
+                >::apply(*it, box, robust_policy, out, strategy);
         }
         return out;
     }
@@ -413,6 +447,27 @@ struct intersection_insert
 {};
 
 
+template
+<
+    typename MultiPolygon, typename Box,
+    typename GeometryOut,
+    bool Reverse1, bool Reverse2, bool ReverseOut
+>
+struct intersection_insert
+    <
+        MultiPolygon, Box,
+        GeometryOut,
+        overlay_intersection,
+        Reverse1, Reverse2, ReverseOut,
+        multi_polygon_tag, box_tag, polygon_tag,
+        true, true, true
+    > : detail::intersection::clip_multi_polygon_with_box
+            <
+                GeometryOut, Reverse1, Reverse2, ReverseOut
+            >
+{};
+
+
 } // namespace dispatch
 #endif
 
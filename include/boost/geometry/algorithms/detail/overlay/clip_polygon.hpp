@@ -0,0 +1,794 @@
+// Boost.Geometry (aka GGL, Generic Geometry Library)
+
+// Copyright (c) 2026 agent.
+
+// Use, modification and distribution is subject to the Boost Software License,
+// Version 1.0. (See accompanying file LICENSE_1_0.txt or copy at
+// http://www.boost.org/LICENSE_1_0.txt)
+
+#ifndef BOOST_GEOMETRY_ALGORITHMS_DETAIL_OVERLAY_CLIP_POLYGON_HPP
+#define BOOST_GEOMETRY_ALGORITHMS_DETAIL_OVERLAY_CLIP_POLYGON_HPP
+
+#include <cstddef>
+#include <algorithm>
+#include <vector>
+
+#include <boost/range.hpp>
+
+#include <boost/geometry/core/access.hpp>
+#include <boost/geometry/core/closure.hpp>
+#include <boost/geometry/core/exterior_ring.hpp>
+#include <boost/geometry/core/interior_rings.hpp>
+#include <boost/geometry/core/point_type.hpp>
+#include <boost/geometry/core/ring_type.hpp>
+#include <boost/geometry/core/tags.hpp>
+
+#include <boost/geometry/algorithms/area.hpp>
+#include <boost/geometry/algorithms/convert.hpp>
+#include <boost/geometry/algorithms/detail/interior_iterator.hpp>
+#include <boost/geometry/algorithms/detail/overlay/append_no_duplicates.hpp>
+#include <boost/geometry/algorithms/detail/overlay/overlay.hpp>
+#include <boost/geometry/algorithms/detail/overlay/overlay_type.hpp>
+#include <boost/geometry/algorithms/detail/within/point_in_geometry.hpp>
+
+#include <boost/geometry/geometries/ring.hpp>
+
+#include <boost/geometry/util/range.hpp>
+#include <boost/geometry/util/select_most_precise.hpp>
+
+#include <boost/geometry/views/detail/normalized_view.hpp>
+
+namespace boost { namespace geometry
+{
+
+#ifndef DOXYGEN_NO_DETAIL
+namespace detail { namespace intersection
+{
+
+// Position on the border of a box, increasing in clockwise direction,
+// starting at the lower left corner: the side (0: left, 1: top, 2: right,
+// 3: bottom) and a key increasing along that side
+template <typename T>
+struct box_border_position
+{
+    int side;
+    T key;
+
+    inline bool operator<(box_border_position const& other) const
+    {
+        return side != other.side ? side < other.side : key < other.key;
+    }
+
+    inline bool operator==(box_border_position const& other) const
+    {
+        return side == other.side && key == other.key;
+    }
+};
+
+/*!
+    \brief Clips a polygon with a box
+    \details The rings of the polygon are cut into chains inside the box, from
+        the point where a ring enters the box to the point where it leaves
+        the box. The chains are then connected along the border of the box,
+        in clockwise direction (the interior of the polygon is on the right
+        side of its rings, both of the exterior and of the interior rings),
+        in the way of Weiler-Atherton. The rings completely inside the box
+        are kept as they are. The result is valid if the input is valid.
+        The segments can also be added one by one (begin_ring, add_segment,
+        end_ring, assemble), which is used to clip one geometry with all
+        tiles of a grid in one pass.
+    \note Degenerate cases, where a vertex is located on the border of the box
+        or two rings touch the border at the same point, are not clipped.
+        The caller should use the overlay for those polygons.
+    \note The algorithm is currently only implemented for 2D Cartesian points
+*/
+template <typename Box, typename Point>
+class polygon_box_clipper
+{
+public :
+    typedef model::ring<Point> ring_type;
+
+    typedef typename select_most_precise
+        <
+            typename coordinate_type<Box>::type,
+            typename coordinate_type<Point>::type,
+            double
+        >::type calculation_type;
+
+    // Location of a vertex with respect to the box
+    enum { inside = 0, outside_left = 1, outside_right = 2,
+           outside_bottom = 4, outside_top = 8, on_border = 16 };
+
+    enum ring_location { ring_inside, ring_outside, ring_crossing };
+
+private :
+    typedef box_border_position<calculation_type> position_type;
+
+    struct chain
+    {
+        ring_type points;
+        position_type entry;
+        position_type exit;
+        bool visited;
+    };
+
+public :
+    explicit polygon_box_clipper(Box const& box)
+        : m_min_x(geometry::get<min_corner, 0>(box))
+        , m_min_y(geometry::get<min_corner, 1>(box))
+        , m_max_x(geometry::get<max_corner, 0>(box))
+        , m_max_y(geometry::get<max_corner, 1>(box))
+        , m_degenerate(false)
+        , m_open(false)
+        , m_open_head(false)
+        , m_ring_chain_count(0)
+    {}
+
+    //! Clips the polygon (or ring), returns false if it is degenerate
+    template <typename Geometry>
+    inline bool apply(Geometry const& geometry)
+    {
+        m_chains.clear();
+        m_inner_rings.clear();
+        m_exteriors.clear();
+        m_degenerate = false;
+
+        bool border_inside = false;
+        clip(geometry, border_inside, typename tag<Geometry>::type());
+        return ! m_degenerate && assemble(border_inside);
+    }
+
+    //! Returns the location of a point with respect to the box
+    inline int location(Point const& point) const
+    {
+        calculation_type const x = geometry::get<0>(point);
+        calculation_type const y = geometry::get<1>(point);
+        if (x == m_min_x || x == m_max_x || y == m_min_y || y == m_max_y)
+        {
+            return on_border;
+        }
+        return (x < m_min_x ? outside_left : x > m_max_x ? outside_right : 0)
+             | (y < m_min_y ? outside_bottom : y > m_max_y ? outside_top : 0);
+    }
+
+    //! Starts a ring, of which the segments are added in clockwise order
+    inline void begin_ring()
+    {
+        m_open = false;
+        m_open_head = false;
+        m_ring_chain_count = m_chains.size();
+    }
+
+    //! Adds the next segment of the ring, with the locations of its points
+    inline void add_segment(Point const& p1, Point const& p2, int loc1, int loc2)
+    {
+        if (m_degenerate)
+        {
+            return;
+        }
+        if (loc1 == on_border || loc2 == on_border)
+        {
+            m_degenerate = true;
+            return;
+        }
+
+        if (loc1 == inside && ! m_open)
+        {
+            // The ring starts inside the box, the first chain (the head)
+            // is connected to the last chain at the end of the ring
+            geometry::clear(m_current.points);
+            m_current.points.push_back(p1);
+            m_open = true;
+            m_open_head = true;
+        }
+
+        if (loc1 == inside && loc2 == inside)
+        {
+            detail::overlay::append_no_duplicates(m_current.points, p2);
+            return;
+        }
+        if ((loc1 & loc2) != 0)
+        {
+            // Both points are located outside the same side of the box
+            return;
+        }
+
+        Point entry, exit;
+        position_type entry_position, exit_position;
+        if (! clip_segment(p1, p2, loc1 != inside, loc2 != inside,
+                           entry, exit, entry_position, exit_position))
+        {
+            return;
+        }
+
+        if (loc1 != inside)
+        {
+            geometry::clear(m_current.points);
+            m_current.points.push_back(entry);
+            m_current.entry = entry_position;
+            m_open = true;
+            m_open_head = false;
+        }
+        if (loc2 == inside)
+        {
+            detail::overlay::append_no_duplicates(m_current.points, p2);
+            return;
+        }
+
+        detail::overlay::append_no_duplicates(m_current.points, exit);
+        m_current.exit = exit_position;
+        m_current.visited = false;
+        if (m_open_head)
+        {
+            m_head = m_current;
+        }
+        else
+        {
+            m_chains.push_back(m_current);
+        }
+        m_open = false;
+        m_open_head = false;
+    }
+
+    //! Finishes the ring, keeping it if it is completely inside the box
+    inline ring_location end_ring(bool exterior)
+    {
+        if (m_degenerate)
+        {
+            return ring_crossing;
+        }
+        if (m_open && m_open_head)
+        {
+            // The ring did not leave the box
+            if (m_current.points.size() < 4)
+            {
+                m_degenerate = true;
+                return ring_crossing;
+            }
+            (exterior ? m_exteriors : m_inner_rings).push_back(m_current.points);
+            m_open = false;
+            return ring_inside;
+        }
+        if (m_open)
+        {
+            // Connect the last chain with the head
+            for (std::size_t i = 1; i < m_head.points.size(); i++)
+            {
+                detail::overlay::append_no_duplicates(m_current.points,
+                                                      m_head.points[i]);
+            }
+            m_current.exit = m_head.exit;
+            m_current.visited = false;
+            m_chains.push_back(m_current);
+            m_open = false;
+        }
+        return m_chains.size() > m_ring_chain_count
+            ? ring_crossing : ring_outside;
+    }
+
+    //! Connects the chains to rings, border_inside indicates if the border
+    //! of the box is inside the geometry (only used if there are no chains).
+    //! Returns false if the geometry is degenerate
+    inline bool assemble(bool border_inside)
+    {
+        if (m_degenerate)
+        {
+            return false;
+        }
+        if (! m_chains.empty())
+        {
+            m_degenerate = ! connect_chains(m_exteriors);
+        }
+        else if (border_inside)
+        {
+            m_exteriors.push_back(box_ring());
+        }
+        return ! m_degenerate;
+    }
+
+    //! Returns true if nothing is inside the box (after assemble)
+    inline bool empty() const
+    {
+        return m_exteriors.empty();
+    }
+
+    //! Outputs the polygons of the last clipped, not degenerate, geometry
+    template <typename PolygonOut, bool ReverseOut, typename OutputIterator>
+    inline OutputIterator output(OutputIterator out) const
+    {
+        std::vector<ring_type> const& exteriors = m_exteriors;
+        std::vector<PolygonOut> polygons(exteriors.size());
+        for (std::size_t i = 0; i < exteriors.size(); i++)
+        {
+            assign_ring<ReverseOut>(exteriors[i],
+                        geometry::exterior_ring(polygons[i]));
+        }
+
+        for (std::size_t i = 0; i < m_inner_rings.size(); i++)
+        {
+            std::size_t const index = exteriors.size() == 1
+                ? 0 : find_exterior(m_inner_rings[i], exteriors);
+            if (index < exteriors.size())
+            {
+                typename ring_return_type<PolygonOut>::type ring
+                    = add_interior(polygons[index]);
+                assign_ring<ReverseOut>(m_inner_rings[i], ring);
+            }
+        }
+
+        for (std::size_t i = 0; i < polygons.size(); i++)
+        {
+            *out++ = polygons[i];
+        }
+        return out;
+    }
+
+private :
+
+    template <typename Ring>
+    inline void clip(Ring const& ring, bool& border_inside, ring_tag)
+    {
+        clip_exterior(ring, border_inside);
+    }
+
+    template <typename Polygon>
+    inline void clip(Polygon const& polygon, bool& border_inside, polygon_tag)
+    {
+        if (! clip_exterior(geometry::exterior_ring(polygon), border_inside))
+        {
+            return;
+        }
+
+        typename interior_return_type<Polygon const>::type
+            rings = geometry::interior_rings(polygon);
+        for (typename detail::interior_iterator<Polygon const>::type
+                it = boost::begin(rings); it != boost::end(rings); ++it)
+        {
+            ring_location const location = clip_ring(*it, false);
+            if (m_degenerate)
+            {
+                return;
+            }
+            if (location == ring_outside && box_inside(m_ring))
+            {
+                // The box is located in a hole
+                border_inside = false;
+                return;
+            }
+        }
+    }
+
+    // Returns false if the polygon is not inside the box, and does not
+    // enclose or cross it
+    template <typename Ring>
+    inline bool clip_exterior(Ring const& ring, bool& border_inside)
+    {
+        ring_location const location = clip_ring(ring, true);
+        if (m_degenerate)
+        {
+            return false;
+        }
+        if (location == ring_outside)
+        {
+            border_inside = box_inside(m_ring);
+            return border_inside;
+        }
+        return true;
+    }
+
+    // Cuts the ring into chains, and copies it into m_ring
+    template <typename Ring>
+    inline ring_location clip_ring(Ring const& ring, bool exterior)
+    {
+        typedef detail::normalized_view<Ring const> view_type;
+        view_type view(ring);
+
+        geometry::clear(m_ring);
+        m_locations.clear();
+        for (typename boost::range_iterator<view_type const>::type
+                it = boost::begin(view); it != boost::end(view); ++it)
+        {
+            Point point;
+            geometry::convert(*it, point);
+            m_locations.push_back(location(point));
+            m_ring.push_back(point);
+        }
+
+        std::size_t const count = m_ring.size();
+        if (count < 4)
+        {
+            m_degenerate = true;
+            return ring_crossing;
+        }
+
+        begin_ring();
+        for (std::size_t i = 0; i + 1 < count && ! m_degenerate; i++)
+        {
+            add_segment(m_ring[i], m_ring[i + 1],
+                        m_locations[i], m_locations[i + 1]);
+        }
+        return end_ring(exterior);
+    }
+
+    // Clips a segment in the way of Liang-Barsky, returns the entry point if
+    // the first point is clipped, and the exit point if the second point
+    // is clipped
+    inline bool clip_segment(Point const& p1, Point const& p2,
+                bool clip1, bool clip2,
+                Point& entry, Point& exit,
+                position_type& entry_position,
+                position_type& exit_position)
+    {
+        calculation_type const x1 = geometry::get<0>(p1);
+        calculation_type const y1 = geometry::get<1>(p1);
+        calculation_type const dx = calculation_type(geometry::get<0>(p2)) - x1;
+        calculation_type const dy = calculation_type(geometry::get<1>(p2)) - y1;
+
+        calculation_type t1 = 0;
+        calculation_type t2 = 1;
+        int side1 = -1;
+        int side2 = -1;
+
+        if (! check_edge(-dx, x1 - m_min_x, 0, t1, t2, side1, side2)
+            || ! check_edge(dy, m_max_y - y1, 1, t1, t2, side1, side2)
+            || ! check_edge(dx, m_max_x - x1, 2, t1, t2, side1, side2)
+            || ! check_edge(-dy, y1 - m_min_y, 3, t1, t2, side1, side2))
+        {
+            return false;
+        }
+
+        if ((clip1 && side1 < 0) || (clip2 && side2 < 0)
+            || (clip1 && clip2 && ! (t1 < t2)))
+        {
+            // The segment touches the box at one point
+            m_degenerate = true;
+            return false;
+        }
+
+        if (clip1)
+        {
+            border_point(x1, y1, dx, dy, t1, side1, entry, entry_position);
+        }
+        if (clip2)
+        {
+            border_point(x1, y1, dx, dy, t2, side2, exit, exit_position);
+        }
+        return true;
+    }
+
+    static inline bool check_edge(calculation_type const& p,
+                calculation_type const& q, int side,
+                calculation_type& t1, calculation_type& t2,
+                int& side1, int& side2)
+    {
+        if (p < 0)
+        {
+            calculation_type const r = q / p;
+            if (r > t2)
+            {
+                return false;
+            }
+            if (r > t1)
+            {
+                t1 = r;
+                side1 = side;
+            }
+        }
+        else if (p > 0)
+        {
+            calculation_type const r = q / p;
+            if (r < t1)
+            {
+                return false;
+            }
+            if (r < t2)
+            {
+                t2 = r;
+                side2 = side;
+            }
+        }
+        else if (q < 0)
+        {
+            return false;
+        }
+        return true;
+    }
+
+    // Calculates a point on a side of the box, and its position on the border
+    inline void border_point(calculation_type const& x1,
+                calculation_type const& y1,
+                calculation_type const& dx, calculation_type const& dy,
+                calculation_type const& t, int side,
+                Point& point, position_type& position) const
+    {
+        calculation_type x = side == 0 ? m_min_x : side == 2 ? m_max_x
+            : (std::min)((std::max)(x1 + t * dx, m_min_x), m_max_x);
+        calculation_type y = side == 3 ? m_min_y : side == 1 ? m_max_y
+            : (std::min)((std::max)(y1 + t * dy, m_min_y), m_max_y);
+
+        assign_point(point, x, y);
+
+        // Get the coordinates of the point as stored, a corner belongs
+        // to the side starting there
+        x = geometry::get<0>(point);
+        y = geometry::get<1>(point);
+        if (side == 0 && y == m_max_y) { side = 1; }
+        else if (side == 1 && x == m_max_x) { side = 2; }
+        else if (side == 2 && y == m_min_y) { side = 3; }
+        else if (side == 3 && x == m_min_x) { side = 0; }
+
+        position.side = side;
+        position.key = side == 0 ? y : side == 1 ? x : side == 2 ? -y : -x;
+    }
+
+    static inline void assign_point(Point& point,
+                calculation_type const& x, calculation_type const& y)
+    {
+        typedef typename coordinate_type<Point>::type coordinate_type;
+        geometry::set<0>(point, boost::numeric_cast<coordinate_type>(x));
+        geometry::set<1>(point, boost::numeric_cast<coordinate_type>(y));
+    }
+
+    inline Point corner(int side) const
+    {
+        Point point;
+        assign_point(point,
+                side < 2 ? m_min_x : m_max_x,
+                side == 0 || side == 3 ? m_min_y : m_max_y);
+        return point;
+    }
+
+    inline ring_type box_ring() const
+    {
+        ring_type ring;
+        for (int side = 0; side < 4; side++)
+        {
+            ring.push_back(corner(side));
+        }
+        ring.push_back(ring.front());
+        return ring;
+    }
+
+    inline bool box_inside(ring_type const& ring) const
+    {
+        // The box is either completely inside or outside of the ring
+        return detail::within::point_in_geometry(corner(0), ring) > 0;
+    }
+
+    struct entry_less
+    {
+        std::vector<chain> const& chains;
+
+        explicit entry_less(std::vector<chain> const& c)
+            : chains(c)
+        {}
+
+        inline bool operator()(std::size_t left, std::size_t right) const
+        {
+            return chains[left].entry < chains[right].entry;
+        }
+
+        inline bool operator()(position_type const& left, std::size_t right) const
+        {
+            return left < chains[right].entry;
+        }
+    };
+
+    // Connects the chains along the border of the box to rings
+    inline bool connect_chains(std::vector<ring_type>& rings)
+    {
+        std::size_t const count = m_chains.size();
+
+        // All positions on the border must be different
+        std::vector<position_type> positions;
+        positions.reserve(2 * count);
+        for (std::size_t i = 0; i < count; i++)
+        {
+            positions.push_back(m_chains[i].entry);
+            positions.push_back(m_chains[i].exit);
+        }
+        std::sort(positions.begin(), positions.end());
+        if (std::adjacent_find(positions.begin(), positions.end())
+            != positions.end())
+        {
+            return false;
+        }
+
+        std::vector<std::size_t> entries(count);
+        for (std::size_t i = 0; i < count; i++)
+        {
+            entries[i] = i;
+        }
+        std::sort(entries.begin(), entries.end(), entry_less(m_chains));
+
+        for (std::size_t i = 0; i < count; i++)
+        {
+            if (m_chains[i].visited)
+            {
+                continue;
+            }
+
+            ring_type ring;
+            std::size_t current = i;
+            for (;;)
+            {
+                chain& c = m_chains[current];
+                c.visited = true;
+                for (typename ring_type::const_iterator it = c.points.begin();
+                    it != c.points.end(); ++it)
+                {
+                    detail::overlay::append_no_duplicates(ring, *it);
+                }
+
+                // Go to the nearest entry in clockwise direction
+                std::vector<std::size_t>::const_iterator next
+                    = std::upper_bound(entries.begin(), entries.end(),
+                                       c.exit, entry_less(m_chains));
+                std::size_t const next_index
+                    = next == entries.end() ? entries.front() : *next;
+
+                add_corners(ring, c.exit, m_chains[next_index].entry);
+
+                if (next_index == i)
+                {
+                    detail::overlay::append_no_duplicates(ring, ring.front());
+                    break;
+                }
+                if (m_chains[next_index].visited)
+                {
+                    return false;
+                }
+                current = next_index;
+            }
+
+            if (ring.size() < 4)
+            {
+                return false;
+            }
+            rings.push_back(ring);
+        }
+        return true;
+    }
+
+    // Adds the corners passed going from one position to the other
+    inline void add_corners(ring_type& ring,
+                position_type const& from, position_type const& to) const
+    {
+        if (from.side == to.side && from.key < to.key)
+        {
+            return;
+        }
+        int side = from.side;
+        do
+        {
+            side = (side + 1) % 4;
+            detail::overlay::append_no_duplicates(ring, corner(side));
+        } while (side != to.side);
+    }
+
+    // Returns the index of the exterior ring containing the interior ring.
+    // Exterior rings may be nested (an island in a hole, both inside the box),
+    // then the smallest one is taken
+    inline std::size_t find_exterior(ring_type const& interior,
+                std::vector<ring_type> const& exteriors) const
+    {
+        std::size_t result = exteriors.size();
+        calculation_type result_area = 0;
+        for (std::size_t i = 0; i < exteriors.size(); i++)
+        {
+            for (typename ring_type::const_iterator pit = interior.begin();
+                pit != interior.end(); ++pit)
+            {
+                int const code
+                    = detail::within::point_in_geometry(*pit, exteriors[i]);
+                if (code > 0)
+                {
+                    calculation_type const area = geometry::area(exteriors[i]);
+                    if (result == exteriors.size() || area < result_area)
+                    {
+                        result = i;
+                        result_area = area;
+                    }
+                }
+                if (code != 0)
+                {
+                    break;
+                }
+                // On the border, try the next point
+            }
+        }
+        return result;
+    }
+
+    template <typename Polygon>
+    static inline typename ring_return_type<Polygon>::type
+        add_interior(Polygon& polygon)
+    {
+        typename interior_return_type<Polygon>::type
+            rings = geometry::interior_rings(polygon);
+        range::resize(rings, boost::size(rings) + 1);
+        return range::back(rings);
+    }
+
+    template <bool Reverse, typename RingOut>
+    static inline void assign_ring(ring_type const& ring, RingOut& ring_out)
+    {
+        std::size_t const size = ring.size();
+        std::size_t const count
+            = geometry::closure<RingOut>::value == open ? size - 1 : size;
+        for (std::size_t i = 0; i < count; i++)
+        {
+            typename point_type<RingOut>::type point;
+            geometry::convert(Reverse ? ring[size - 1 - i] : ring[i], point);
+            range::push_back(ring_out, point);
+        }
+    }
+
+    calculation_type m_min_x, m_min_y, m_max_x, m_max_y;
+
+    bool m_degenerate;
+
+    std::vector<chain> m_chains;
+    std::vector<ring_type> m_inner_rings;
+    std::vector<ring_type> m_exteriors;
+
+    // The chain being built, and the first chain of a ring starting inside
+    chain m_current;
+    chain m_head;
+    bool m_open;
+    bool m_open_head;
+    std::size_t m_ring_chain_count;
+
+    ring_type m_ring;
+    std::vector<int> m_locations;
+};
+
+
+/*!
+    \brief Intersects a polygon or ring with a box
+    \details The polygon is clipped by the polygon_box_clipper, and if that
+        is not possible because of degenerate cases, by the overlay.
+*/
+template
+<
+    typename PolygonOut,
+    bool Reverse1, bool Reverse2, bool ReverseOut
+>
+struct clip_polygon_with_box
+{
+    template
+    <
+        typename Polygon, typename Box,
+        typename RobustPolicy,
+        typename OutputIterator, typename Strategy
+    >
+    static inline OutputIterator apply(Polygon const& polygon,
+            Box const& box,
+            RobustPolicy const& robust_policy,
+            OutputIterator out,
+            Strategy const& strategy)
+    {
+        typedef typename point_type<PolygonOut>::type point_type;
+
+        polygon_box_clipper<Box, point_type> clipper(box);
+        if (clipper.apply(polygon))
+        {
+            return clipper.template output<PolygonOut, ReverseOut>(out);
+        }
+
+        return detail::overlay::overlay
+            <
+                Polygon, Box,
+                Reverse1, Reverse2, ReverseOut,
+                PolygonOut, overlay_intersection
+            >::apply(polygon, box, robust_policy, out, strategy);
+    }
+};
+
+
+}} // namespace detail::intersection
+#endif // DOXYGEN_NO_DETAIL
+
+}} // namespace boost::geometry
+
+#endif // BOOST_GEOMETRY_ALGORITHMS_DETAIL_OVERLAY_CLIP_POLYGON_HPP
@@ -62,6 +62,7 @@
 
 #include <boost/geometry/algorithms/detail/sections/range_by_section.hpp>
 #include <boost/geometry/algorithms/detail/sections/sectionalize.hpp>
+#include <boost/geometry/algorithms/detail/sections/sectioned.hpp>
 
 #include <boost/geometry/algorithms/expand.hpp>
 
@@ -429,6 +430,7 @@ struct section_visitor
     int m_source_id2;
     Geometry2 const& m_geometry2;
     RobustPolicy const& m_rescale_policy;
+    Turns m_splitted_turns;
     Turns& m_turns;
     InterruptPolicy& m_interrupt_policy;
 
@@ -443,6 +445,22 @@ struct section_visitor
         , m_interrupt_policy(ip)
     {}
 
+    // Used by partition visiting the sections concurrently, the turns
+    // are gathered in the visitor and then appended by join()
+    section_visitor(section_visitor& parent, detail::partition::split)
+        : m_source_id1(parent.m_source_id1), m_geometry1(parent.m_geometry1)
+        , m_source_id2(parent.m_source_id2), m_geometry2(parent.m_geometry2)
+        , m_rescale_policy(parent.m_rescale_policy)
+        , m_turns(m_splitted_turns)
+        , m_interrupt_policy(parent.m_interrupt_policy)
+    {}
+
+    inline void join(section_visitor& other)
+    {
+        m_turns.insert(boost::end(m_turns),
+                       boost::begin(other.m_turns), boost::end(other.m_turns));
+    }
+
     template <typename Section>
     inline bool apply(Section const& sec1, Section const& sec2)
     {
@@ -467,6 +485,37 @@ struct section_visitor
 
 };
 
+}} // namespace detail::get_turns
+
+namespace detail { namespace partition
+{
+
+// The sections may be visited concurrently if the visitor is not interrupted
+template
+<
+    typename Geometry1, typename Geometry2,
+    bool Reverse1, bool Reverse2,
+    typename Turns,
+    typename TurnPolicy,
+    typename RobustPolicy
+>
+struct is_splittable_visitor
+    <
+        detail::get_turns::section_visitor
+            <
+                Geometry1, Geometry2, Reverse1, Reverse2,
+                Turns, TurnPolicy, RobustPolicy,
+                detail::get_turns::no_interrupt_policy
+            >
+    >
+    : boost::true_type
+{};
+
+}} // namespace detail::partition
+
+namespace detail { namespace get_turns
+{
+
 template
 <
     typename Geometry1, typename Geometry2,
@@ -498,13 +547,16 @@ public:
             > box_type;
         typedef geometry::sections<box_type, 2> sections_type;
 
-        sections_type sec1, sec2;
+        sections_type sections1, sections2;
         typedef boost::mpl::vector_c<std::size_t, 0, 1> dimensions;
 
-        geometry::sectionalize<Reverse1, dimensions>(geometry1, robust_policy,
-                sec1, 0);
-        geometry::sectionalize<Reverse2, dimensions>(geometry2, robust_policy,
-                sec2, 1);
+        // The sections of a sectioned geometry are reused
+        sections_type const& sec1
+            = detail::sectionalize::get_sections<Reverse1, dimensions>(
+                    geometry1, robust_policy, sections1, 0);
+        sections_type const& sec2
+            = detail::sectionalize::get_sections<Reverse2, dimensions>(
+                    geometry2, robust_policy, sections2, 1);
 
         // ... and then partition them, intersecting overlapping sections in visitor method
         section_visitor
@@ -29,6 +29,7 @@
 #include <boost/geometry/algorithms/convert.hpp>
 #include <boost/geometry/algorithms/detail/point_on_border.hpp>
 #include <boost/geometry/algorithms/detail/overlay/clip_linestring.hpp>
+#include <boost/geometry/algorithms/detail/overlay/clip_polygon.hpp>
 #include <boost/geometry/algorithms/detail/overlay/get_intersection_points.hpp>
 #include <boost/geometry/algorithms/detail/overlay/overlay.hpp>
 #include <boost/geometry/algorithms/detail/overlay/overlay_type.hpp>
@@ -352,6 +353,45 @@ struct intersection_insert
 {};
 
 
+// Polygon or ring with box, intersection: clip it
+template
+<
+    typename Polygon, typename Box,
+    typename GeometryOut,
+    bool Reverse1, bool Reverse2, bool ReverseOut
+>
+struct intersection_insert
+    <
+        Polygon, Box,
+        GeometryOut,
+        overlay_intersection,
+        Reverse1, Reverse2, ReverseOut,
+        polygon_tag, box_tag, polygon_tag,
+        true, true, true
+    > : detail::intersection::clip_polygon_with_box
+        <GeometryOut, Reverse1, Reverse2, ReverseOut>
+{};
+
+
+template
+<
+    typename Ring, typename Box,
+    typename GeometryOut,
+    bool Reverse1, bool Reverse2, bool ReverseOut
+>
+struct intersection_insert
+    <
+        Ring, Box,
+        GeometryOut,
+        overlay_intersection,
+        Reverse1, Reverse2, ReverseOut,
+        ring_tag, box_tag, polygon_tag,
+        true, true, true
+    > : detail::intersection::clip_polygon_with_box
+        <GeometryOut, Reverse1, Reverse2, ReverseOut>
+{};
+
+
 template
 <
     typename Segment1, typename Segment2,
@@ -64,6 +64,7 @@ struct self_section_visitor
 {
     Geometry const& m_geometry;
     RobustPolicy const& m_rescale_policy;
+    Turns m_splitted_turns;
     Turns& m_turns;
     InterruptPolicy& m_interrupt_policy;
 
@@ -76,6 +77,22 @@ struct self_section_visitor
         , m_interrupt_policy(ip)
     {}
 
+    // Used by partition visiting the sections concurrently, the turns
+    // are gathered in the visitor and then appended by join()
+    inline self_section_visitor(self_section_visitor& parent,
+            detail::partition::split)
+        : m_geometry(parent.m_geometry)
+        , m_rescale_policy(parent.m_rescale_policy)
+        , m_turns(m_splitted_turns)
+        , m_interrupt_policy(parent.m_interrupt_policy)
+    {}
+
+    inline void join(self_section_visitor& other)
+    {
+        m_turns.insert(boost::end(m_turns),
+                       boost::begin(other.m_turns), boost::end(other.m_turns));
+    }
+
     template <typename Section>
     inline bool apply(Section const& sec1, Section const& sec2)
     {
@@ -109,6 +126,35 @@ struct self_section_visitor
 
 
 
+}} // namespace detail::self_get_turn_points
+
+namespace detail { namespace partition
+{
+
+// The sections may be visited concurrently if the visitor is not interrupted
+template
+<
+    typename Geometry,
+    typename Turns,
+    typename TurnPolicy,
+    typename RobustPolicy
+>
+struct is_splittable_visitor
+    <
+        detail::self_get_turn_points::self_section_visitor
+            <
+                Geometry, Turns, TurnPolicy, RobustPolicy,
+                detail::self_get_turn_points::no_interrupt_policy
+            >
+    >
+    : boost::true_type
+{};
+
+}} // namespace detail::partition
+
+namespace detail { namespace self_get_turn_points
+{
+
 template<typename TurnPolicy>
 struct get_turns
 {
@@ -132,8 +178,10 @@ struct get_turns
 
         typedef boost::mpl::vector_c<std::size_t, 0> dimensions;
 
-        sections_type sec;
-        geometry::sectionalize<false, dimensions>(geometry, robust_policy, sec);
+        sections_type sections;
+        sections_type const& sec
+            = detail::sectionalize::get_sections<false, dimensions>(geometry,
+                    robust_policy, sections);
 
         self_section_visitor
             <
@@ -9,11 +9,21 @@
 #ifndef BOOST_GEOMETRY_ALGORITHMS_DETAIL_PARTITION_HPP
 #define BOOST_GEOMETRY_ALGORITHMS_DETAIL_PARTITION_HPP
 
+#include <algorithm>
+#include <cstddef>
+#include <ostream>
 #include <vector>
+#include <boost/mpl/and.hpp>
 #include <boost/range/algorithm/copy.hpp>
+#include <boost/type_traits/integral_constant.hpp>
+#include <boost/type_traits/is_same.hpp>
 #include <boost/geometry/algorithms/assign.hpp>
 #include <boost/geometry/core/coordinate_type.hpp>
 
+#if defined(BOOST_GEOMETRY_EXPERIMENTAL_ENABLE_PARALLEL_PARTITION)
+#include <boost/geometry/util/detail/parallel_tasks.hpp>
+#endif
+
 namespace boost { namespace geometry
 {
 
@@ -38,6 +48,128 @@ inline void divide_box(Box const& box, Box& lower_box, Box& upper_box)
     geometry::set<min_corner, Dimension>(upper_box, mid);
 }
 
+template <int Dimension, typename ExpandPolicy, typename Box,
+          typename InputCollection, typename Coordinates>
+inline void add_centers(InputCollection const& collection,
+                index_vector_type const& input,
+                Coordinates& centers)
+{
+    typedef boost::range_iterator<index_vector_type const>::type it_type;
+    for(it_type it = boost::begin(input); it != boost::end(input); ++it)
+    {
+        Box item_box;
+        geometry::assign_inverse(item_box);
+        ExpandPolicy::apply(item_box, collection[*it]);
+
+        // Twice the center, to avoid dividing each coordinate
+        centers.push_back(geometry::get<min_corner, Dimension>(item_box)
+                        + geometry::get<max_corner, Dimension>(item_box));
+    }
+}
+
+// Divide input box into two parts at the median of the centers of the
+// elements, so both parts contain (about) the same number of elements.
+// If the median is not inside the box it is divided in the middle.
+template <int Dimension, typename Box, typename Coordinates>
+inline void divide_box_at_median(Box const& box, Coordinates& centers,
+                Box& lower_box, Box& upper_box)
+{
+    typedef typename coordinate_type<Box>::type ctype;
+
+    if (boost::size(centers) == 0)
+    {
+        divide_box<Dimension>(box, lower_box, upper_box);
+        return;
+    }
+
+    typename Coordinates::iterator nth = centers.begin() + centers.size() / 2;
+    std::nth_element(centers.begin(), nth, centers.end());
+
+    ctype two = 2;
+    ctype const mid = *nth / two;
+
+    if (! (geometry::get<min_corner, Dimension>(box) < mid
+        && mid < geometry::get<max_corner, Dimension>(box)))
+    {
+        divide_box<Dimension>(box, lower_box, upper_box);
+        return;
+    }
+
+    lower_box = box;
+    upper_box = box;
+    geometry::set<max_corner, Dimension>(lower_box, mid);
+    geometry::set<min_corner, Dimension>(upper_box, mid);
+}
+
+// Divides the box in the middle, independently from the elements
+struct divide_middle_policy
+{
+    template
+    <
+        int Dimension, typename ExpandPolicy,
+        typename Box, typename InputCollection
+    >
+    static inline void apply(Box const& box,
+            InputCollection const& ,
+            index_vector_type const& ,
+            Box& lower_box, Box& upper_box)
+    {
+        divide_box<Dimension>(box, lower_box, upper_box);
+    }
+
+    template
+    <
+        int Dimension, typename ExpandPolicy1, typename ExpandPolicy2,
+        typename Box, typename InputCollection1, typename InputCollection2
+    >
+    static inline void apply(Box const& box,
+            InputCollection1 const& , index_vector_type const& ,
+            InputCollection2 const& , index_vector_type const& ,
+            Box& lower_box, Box& upper_box)
+    {
+        divide_box<Dimension>(box, lower_box, upper_box);
+    }
+};
+
+// Divides the box at the median of the elements, adapting the subdivision
+// to clustered elements at the cost of an additional pass over the elements
+// at each level
+struct divide_median_policy
+{
+    template
+    <
+        int Dimension, typename ExpandPolicy,
+        typename Box, typename InputCollection
+    >
+    static inline void apply(Box const& box,
+            InputCollection const& collection,
+            index_vector_type const& input,
+            Box& lower_box, Box& upper_box)
+    {
+        std::vector<typename coordinate_type<Box>::type> centers;
+        centers.reserve(boost::size(input));
+        add_centers<Dimension, ExpandPolicy, Box>(collection, input, centers);
+        divide_box_at_median<Dimension>(box, centers, lower_box, upper_box);
+    }
+
+    template
+    <
+        int Dimension, typename ExpandPolicy1, typename ExpandPolicy2,
+        typename Box, typename InputCollection1, typename InputCollection2
+    >
+    static inline void apply(Box const& box,
+            InputCollection1 const& collection1, index_vector_type const& input1,
+            InputCollection2 const& collection2, index_vector_type const& input2,
+            Box& lower_box, Box& upper_box)
+    {
+        std::vector<typename coordinate_type<Box>::type> centers;
+        centers.reserve(boost::size(input1) + boost::size(input2));
+        add_centers<Dimension, ExpandPolicy1, Box>(collection1, input1, centers);
+        add_centers<Dimension, ExpandPolicy2, Box>(collection2, input2, centers);
+        divide_box_at_median<Dimension>(box, centers, lower_box, upper_box);
+    }
+};
+
 // Divide collection into three subsets: lower, upper and oversized
 // (not-fitting)
 // (lower == left or bottom, upper == right or top)
@@ -191,10 +323,207 @@ template
     typename OverlapsPolicy2,
     typename ExpandPolicy1,
     typename ExpandPolicy2,
-    typename VisitBoxPolicy
+    typename VisitBoxPolicy,
+    typename DivideBoxPolicy
 >
 class partition_two_collections;
 
+template
+<
+    int Dimension,
+    typename Box,
+    typename OverlapsPolicy,
+    typename ExpandPolicy,
+    typename VisitBoxPolicy,
+    typename DivideBoxPolicy
+>
+class partition_one_collection;
+
+
+// Tag passed to the splitting constructor of the visitors
+struct split {};
+
+// The pairs of elements of independent subdivisions may be visited
+// concurrently if this trait is specialized for the Visitor and derived
+// from boost::true_type. Such Visitor must provide:
+//   Visitor(Visitor& parent, split)
+//     creating the visitor which will visit the pairs of one subdivision,
+//     it must not share the mutable state with the parent, e.g. it should
+//     store the results in its own container,
+//   void join(Visitor& other)
+//     appending the results of the visitor created by the splitting
+//     constructor.
+// The visitors are joined in the order in which the subdivisions would be
+// visited serially so the results are the same as the serial results.
+template <typename Visitor>
+struct is_splittable_visitor
+    : boost::false_type
+{};
+
+// By default the subdivisions are processed immediately
+template
+<
+    int Dimension,
+    typename Box,
+    typename OverlapsPolicy,
+    typename ExpandPolicy,
+    typename VisitBoxPolicy,
+    typename DivideBoxPolicy,
+    typename InputCollection,
+    typename Policy
+>
+inline bool defer_one_collection(Box const& ,
+        InputCollection const& ,
+        index_vector_type const& ,
+        std::size_t , std::size_t ,
+        Policy& )
+{
+    return false;
+}
+
+template
+<
+    int Dimension,
+    typename Box,
+    typename OverlapsPolicy1,
+    typename OverlapsPolicy2,
+    typename ExpandPolicy1,
+    typename ExpandPolicy2,
+    typename VisitBoxPolicy,
+    typename DivideBoxPolicy,
+    typename InputCollection1,
+    typename InputCollection2,
+    typename Policy
+>
+inline bool defer_two_collections(Box const& ,
+        InputCollection1 const& , index_vector_type const& ,
+        InputCollection2 const& , index_vector_type const& ,
+        std::size_t , std::size_t ,
+        Policy& )
+{
+    return false;
+}
+
+// The counters gathered by the statistics_visitor
+struct statistics
+{
+    statistics()
+        : pairs_count(0)
+        , divisions_count(0)
+        , max_level(0)
+        , handle_one_count(0)
+        , handle_two_count(0)
+        , max_handled_pairs(0)
+    {}
+
+    // The number of pairs passed to the visitor
+    std::size_t pairs_count;
+    // The number of divided boxes
+    std::size_t divisions_count;
+    // The deepest level of the subdivision
+    std::size_t max_level;
+    // The number of brute-force visits of all pairs of one collection,
+    // respectively two collections, when the recursion stops
+    std::size_t handle_one_count;
+    std::size_t handle_two_count;
+    // The greatest number of pairs visited by one brute-force visit
+    std::size_t max_handled_pairs;
+};
+
+template <typename Char, typename Traits>
+inline std::basic_ostream<Char, Traits>& operator<<(
+        std::basic_ostream<Char, Traits>& os, statistics const& stats)
+{
+    os << "pairs: " << stats.pairs_count
+        << " divisions: " << stats.divisions_count
+        << " max level: " << stats.max_level
+        << " brute-force one/two: " << stats.handle_one_count
+        << "/" << stats.handle_two_count
+        << " max brute-force pairs: " << stats.max_handled_pairs;
+    return os;
+}
+
+// Wraps the visitor, counting the pairs, the subdivisions and the
+// brute-force visits. E.g. to find out why the partition of clustered
+// elements is slow.
+template <typename Visitor>
+class statistics_visitor
+{
+public :
+    statistics_visitor(Visitor& visitor, statistics& stats)
+        : m_visitor(visitor)
+        , m_statistics(stats)
+    {}
+
+    template <typename Item1, typename Item2>
+    inline void apply(Item1 const& item1, Item2 const& item2)
+    {
+        m_statistics.pairs_count++;
+        m_visitor.apply(item1, item2);
+    }
+
+    inline Visitor& visitor() { return m_visitor; }
+
+    inline void divide(std::size_t level)
+    {
+        m_statistics.divisions_count++;
+        if (level > m_statistics.max_level)
+        {
+            m_statistics.max_level = level;
+        }
+    }
+
+    inline void handle(std::size_t pairs, bool one)
+    {
+        if (pairs == 0)
+        {
+            return;
+        }
+
+        if (one)
+        {
+            m_statistics.handle_one_count++;
+        }
+        else
+        {
+            m_statistics.handle_two_count++;
+        }
+        m_statistics.pairs_count += pairs;
+        if (pairs > m_statistics.max_handled_pairs)
+        {
+            m_statistics.max_handled_pairs = pairs;
+        }
+    }
+
+private :
+    Visitor& m_visitor;
+    statistics& m_statistics;
+};
+
+template <typename InputCollection, typename Visitor>
+inline void handle_one(InputCollection const& collection,
+        index_vector_type const& input,
+        statistics_visitor<Visitor>& visitor)
+{
+    std::size_t const count = boost::size(input);
+    visitor.handle(count > 1 ? count * (count - 1) / 2 : 0, true);
+    handle_one(collection, input, visitor.visitor());
+}
+
+template
+<
+    typename InputCollection1,
+    typename InputCollection2,
+    typename Visitor
+>
+inline void handle_two(
+        InputCollection1 const& collection1, index_vector_type const& input1,
+        InputCollection2 const& collection2, index_vector_type const& input2,
+        statistics_visitor<Visitor>& visitor)
+{
+    visitor.handle(boost::size(input1) * boost::size(input2), false);
+    handle_two(collection1, input1, collection2, input2, visitor.visitor());
+}
 
 template
 <
@@ -202,7 +531,430 @@ template
     typename Box,
     typename OverlapsPolicy,
     typename ExpandPolicy,
-    typename VisitBoxPolicy
+    typename VisitBoxPolicy,
+    typename DivideBoxPolicy,
+    typename InputCollection,
+    typename Visitor
+>
+inline bool defer_one_collection(Box const& ,
+        InputCollection const& ,
+        index_vector_type const& ,
+        std::size_t level, std::size_t ,
+        statistics_visitor<Visitor>& visitor)
+{
+    visitor.divide(level);
+    return false;
+}
+
+template
+<
+    int Dimension,
+    typename Box,
+    typename OverlapsPolicy1,
+    typename OverlapsPolicy2,
+    typename ExpandPolicy1,
+    typename ExpandPolicy2,
+    typename VisitBoxPolicy,
+    typename DivideBoxPolicy,
+    typename InputCollection1,
+    typename InputCollection2,
+    typename Visitor
+>
+inline bool defer_two_collections(Box const& ,
+        InputCollection1 const& , index_vector_type const& ,
+        InputCollection2 const& , index_vector_type const& ,
+        std::size_t level, std::size_t ,
+        statistics_visitor<Visitor>& visitor)
+{
+    visitor.divide(level);
+    return false;
+}
+
+#if defined(BOOST_GEOMETRY_EXPERIMENTAL_ENABLE_PARALLEL_PARTITION)
+
+// The subdivision which pairs are visited by one splitted visitor
+template <typename Visitor>
+struct partition_task
+{
+    virtual ~partition_task() {}
+    virtual void run(Visitor& visitor) const = 0;
+};
+
+// The subdivisions gathered in the order of the serial traversal
+template <typename Visitor>
+class partition_tasks
+{
+public :
+    explicit partition_tasks(std::size_t split_level)
+        : m_split_level(split_level)
+    {}
+
+    ~partition_tasks()
+    {
+        for (std::size_t i = 0; i < m_tasks.size(); i++)
+        {
+            delete m_tasks[i];
+        }
+    }
+
+    inline std::size_t split_level() const { return m_split_level; }
+    inline std::size_t size() const { return m_tasks.size(); }
+    inline partition_task<Visitor> const& operator[](std::size_t i) const
+    {
+        return *m_tasks[i];
+    }
+
+    inline void add(partition_task<Visitor>* task)
+    {
+        try
+        {
+            m_tasks.push_back(task);
+        }
+        catch(...)
+        {
+            delete task;
+            throw;
+        }
+    }
+
+private :
+    partition_tasks(partition_tasks const&);
+    partition_tasks& operator=(partition_tasks const&);
+
+    std::vector<partition_task<Visitor>*> m_tasks;
+    std::size_t m_split_level;
+};
+
+template <typename InputCollection, typename Visitor>
+struct handle_one_task : partition_task<Visitor>
+{
+    handle_one_task(InputCollection const& collection,
+            index_vector_type const& input)
+        : m_collection(collection), m_input(input)
+    {}
+
+    virtual void run(Visitor& visitor) const
+    {
+        handle_one(m_collection, m_input, visitor);
+    }
+
+    InputCollection const& m_collection;
+    index_vector_type m_input;
+};
+
+template <typename InputCollection1, typename InputCollection2, typename Visitor>
+struct handle_two_task : partition_task<Visitor>
+{
+    handle_two_task(InputCollection1 const& collection1,
+            index_vector_type const& input1,
+            InputCollection2 const& collection2,
+            index_vector_type const& input2)
+        : m_collection1(collection1), m_input1(input1)
+        , m_collection2(collection2), m_input2(input2)
+    {}
+
+    virtual void run(Visitor& visitor) const
+    {
+        handle_two(m_collection1, m_input1, m_collection2, m_input2, visitor);
+    }
+
+    InputCollection1 const& m_collection1;
+    index_vector_type m_input1;
+    InputCollection2 const& m_collection2;
+    index_vector_type m_input2;
+};
+
+template
+<
+    int Dimension,
+    typename Box,
+    typename OverlapsPolicy,
+    typename ExpandPolicy,
+    typename VisitBoxPolicy,
+    typename DivideBoxPolicy,
+    typename InputCollection,
+    typename Visitor
+>
+struct one_collection_task : partition_task<Visitor>
+{
+    one_collection_task(Box const& box,
+            InputCollection const& collection,
+            index_vector_type const& input,
+            std::size_t level, std::size_t min_elements)
+        : m_box(box), m_collection(collection), m_input(input)
+        , m_level(level), m_min_elements(min_elements)
+    {}
+
+    virtual void run(Visitor& visitor) const
+    {
+        VisitBoxPolicy box_policy;
+        partition_one_collection
+            <
+                Dimension, Box, OverlapsPolicy, ExpandPolicy,
+                VisitBoxPolicy, DivideBoxPolicy
+            >::apply(m_box, m_collection, m_input,
+                m_level, m_min_elements, visitor, box_policy);
+    }
+
+    Box m_box;
+    InputCollection const& m_collection;
+    index_vector_type m_input;
+    std::size_t m_level;
+    std::size_t m_min_elements;
+};
+
+template
+<
+    int Dimension,
+    typename Box,
+    typename OverlapsPolicy1,
+    typename OverlapsPolicy2,
+    typename ExpandPolicy1,
+    typename ExpandPolicy2,
+    typename VisitBoxPolicy,
+    typename DivideBoxPolicy,
+    typename InputCollection1,
+    typename InputCollection2,
+    typename Visitor
+>
+struct two_collections_task : partition_task<Visitor>
+{
+    two_collections_task(Box const& box,
+            InputCollection1 const& collection1,
+            index_vector_type const& input1,
+            InputCollection2 const& collection2,
+            index_vector_type const& input2,
+            std::size_t level, std::size_t min_elements)
+        : m_box(box)
+        , m_collection1(collection1), m_input1(input1)
+        , m_collection2(collection2), m_input2(input2)
+        , m_level(level), m_min_elements(min_elements)
+    {}
+
+    virtual void run(Visitor& visitor) const
+    {
+        VisitBoxPolicy box_policy;
+        partition_two_collections
+            <
+                Dimension, Box,
+                OverlapsPolicy1, OverlapsPolicy2,
+                ExpandPolicy1, ExpandPolicy2,
+                VisitBoxPolicy,
+                DivideBoxPolicy
+            >::apply(m_box, m_collection1, m_input1, m_collection2, m_input2,
+                m_level, m_min_elements, visitor, box_policy);
+    }
+
+    Box m_box;
+    InputCollection1 const& m_collection1;
+    index_vector_type m_input1;
+    InputCollection2 const& m_collection2;
+    index_vector_type m_input2;
+    std::size_t m_level;
+    std::size_t m_min_elements;
+};
+
+// Gathering the tasks instead of visiting the pairs
+template <typename InputCollection, typename Visitor>
+inline void handle_one(InputCollection const& collection,
+        index_vector_type const& input,
+        partition_tasks<Visitor>& tasks)
+{
+    if (boost::size(input) > 1)
+    {
+        tasks.add(new handle_one_task<InputCollection, Visitor>(
+                    collection, input));
+    }
+}
+
+template
+<
+    typename InputCollection1,
+    typename InputCollection2,
+    typename Visitor
+>
+inline void handle_two(
+        InputCollection1 const& collection1, index_vector_type const& input1,
+        InputCollection2 const& collection2, index_vector_type const& input2,
+        partition_tasks<Visitor>& tasks)
+{
+    if (boost::size(input1) > 0 && boost::size(input2) > 0)
+    {
+        tasks.add(new handle_two_task
+                <
+                    InputCollection1, InputCollection2, Visitor
+                >(collection1, input1, collection2, input2));
+    }
+}
+
+// Below the split level the subdivisions are processed by the tasks
+template
+<
+    int Dimension,
+    typename Box,
+    typename OverlapsPolicy,
+    typename ExpandPolicy,
+    typename VisitBoxPolicy,
+    typename DivideBoxPolicy,
+    typename InputCollection,
+    typename Visitor
+>
+inline bool defer_one_collection(Box const& box,
+        InputCollection const& collection,
+        index_vector_type const& input,
+        std::size_t level, std::size_t min_elements,
+        partition_tasks<Visitor>& tasks)
+{
+    if (level < tasks.split_level())
+    {
+        return false;
+    }
+
+    tasks.add(new one_collection_task
+            <
+                Dimension, Box, OverlapsPolicy, ExpandPolicy,
+                VisitBoxPolicy, DivideBoxPolicy,
+                InputCollection, Visitor
+            >(box, collection, input, level, min_elements));
+    return true;
+}
+
+template
+<
+    int Dimension,
+    typename Box,
+    typename OverlapsPolicy1,
+    typename OverlapsPolicy2,
+    typename ExpandPolicy1,
+    typename ExpandPolicy2,
+    typename VisitBoxPolicy,
+    typename DivideBoxPolicy,
+    typename InputCollection1,
+    typename InputCollection2,
+    typename Visitor
+>
+inline bool defer_two_collections(Box const& box,
+        InputCollection1 const& collection1, index_vector_type const& input1,
+        InputCollection2 const& collection2, index_vector_type const& input2,
+        std::size_t level, std::size_t min_elements,
+        partition_tasks<Visitor>& tasks)
+{
+    if (level < tasks.split_level())
+    {
+        return false;
+    }
+
+    tasks.add(new two_collections_task
+            <
+                Dimension, Box,
+                OverlapsPolicy1, OverlapsPolicy2,
+                ExpandPolicy1, ExpandPolicy2,
+                VisitBoxPolicy, DivideBoxPolicy,
+                InputCollection1, InputCollection2, Visitor
+            >(box, collection1, input1, collection2, input2,
+                level, min_elements));
+    return true;
+}
+
+// Runs the tasks concurrently, each one with its own splitted visitor,
+// and joins the visitors in the order of tasks.
+template <typename Visitor>
+class partition_tasks_runner
+{
+public :
+    partition_tasks_runner(partition_tasks<Visitor> const& tasks,
+            Visitor& visitor)
+        : m_tasks(tasks)
+        , m_visitor(visitor)
+    {}
+
+    ~partition_tasks_runner()
+    {
+        for (std::size_t i = 0; i < m_visitors.size(); i++)
+        {
+            delete m_visitors[i];
+        }
+    }
+
+    inline void apply(std::size_t threads_count)
+    {
+        m_visitors.resize(m_tasks.size(), 0);
+        for (std::size_t i = 0; i < m_tasks.size(); i++)
+        {
+            m_visitors[i] = new Visitor(m_visitor, split());
+        }
+
+        if (! geometry::detail::parallel::tasks_runner<partition_tasks_runner>(*this)
+                .apply(threads_count))
+        {
+            // Something has thrown. Repeat everything serially so the
+            // same exception is thrown as in the serial case.
+            for (std::size_t i = 0; i < m_tasks.size(); i++)
+            {
+                m_tasks[i].run(m_visitor);
+            }
+            return;
+        }
+
+        for (std::size_t i = 0; i < m_tasks.size(); i++)
+        {
+            m_visitor.join(*m_visitors[i]);
+        }
+    }
+
+    // Called by the tasks_runner
+    inline std::size_t size() const
+    {
+        return m_tasks.size();
+    }
+
+    inline void run(std::size_t i) const
+    {
+        m_tasks[i].run(*m_visitors[i]);
+    }
+
+private :
+    partition_tasks_runner(partition_tasks_runner const&);
+    partition_tasks_runner& operator=(partition_tasks_runner const&);
+
+    partition_tasks<Visitor> const& m_tasks;
+    Visitor& m_visitor;
+    std::vector<Visitor*> m_visitors;
+};
+
+inline std::size_t partition_threads_count()
+{
+#if defined(BOOST_GEOMETRY_PARTITION_THREADS)
+    return geometry::detail::parallel::threads_count(
+                BOOST_GEOMETRY_PARTITION_THREADS);
+#else
+    return geometry::detail::parallel::threads_count(0);
+#endif
+}
+
+// The level below which the subdivisions are processed by the tasks,
+// about 8 tasks per thread are created for evenly distributed elements
+inline std::size_t partition_split_level(std::size_t threads_count)
+{
+    std::size_t level = 3;
+    for (std::size_t n = 1; n < threads_count; n *= 2)
+    {
+        level++;
+    }
+    return level;
+}
+
+#endif // BOOST_GEOMETRY_EXPERIMENTAL_ENABLE_PARALLEL_PARTITION
+
+
+template
+<
+    int Dimension,
+    typename Box,
+    typename OverlapsPolicy,
+    typename ExpandPolicy,
+    typename VisitBoxPolicy,
+    typename DivideBoxPolicy
 >
 class partition_one_collection
 {
@@ -233,7 +985,8 @@ class partition_one_collection
                 Box,
                 OverlapsPolicy,
                 ExpandPolicy,
-                VisitBoxPolicy
+                VisitBoxPolicy,
+                DivideBoxPolicy
             >::apply(box, collection, input,
                 level + 1, min_elements, policy, box_policy);
         }
@@ -262,7 +1015,8 @@ class partition_one_collection
                 Box,
                 OverlapsPolicy, OverlapsPolicy,
                 ExpandPolicy, ExpandPolicy,
-                VisitBoxPolicy
+                VisitBoxPolicy,
+                DivideBoxPolicy
             >::apply(box, collection, input1, collection, input2,
                 level + 1, min_elements, policy, box_policy);
         }
@@ -281,10 +1035,20 @@ public :
             std::size_t min_elements,
             Policy& policy, VisitBoxPolicy& box_policy)
     {
+        if (defer_one_collection
+                <
+                    Dimension, Box, OverlapsPolicy, ExpandPolicy,
+                    VisitBoxPolicy, DivideBoxPolicy
+                >(box, collection, input, level, min_elements, policy))
+        {
+            return;
+        }
+
         box_policy.apply(box, level);
 
         Box lower_box, upper_box;
-        divide_box<Dimension>(box, lower_box, upper_box);
+        DivideBoxPolicy::template apply<Dimension, ExpandPolicy>(box,
+                    collection, input, lower_box, upper_box);
 
         index_vector_type lower, upper, exceeding;
         divide_into_subsets<OverlapsPolicy>(lower_box, upper_box, collection,
@@ -324,7 +1088,8 @@ template
     typename OverlapsPolicy2,
     typename ExpandPolicy1,
     typename ExpandPolicy2,
-    typename VisitBoxPolicy
+    typename VisitBoxPolicy,
+    typename DivideBoxPolicy
 >
 class partition_two_collections
 {
@@ -352,7 +1117,8 @@ class partition_two_collections
             OverlapsPolicy2,
             ExpandPolicy1,
             ExpandPolicy2,
-            VisitBoxPolicy
+            VisitBoxPolicy,
+            DivideBoxPolicy
         >::apply(box, collection1, input1, collection2, input2,
                 level + 1, min_elements,
                 policy, box_policy);
@@ -401,10 +1167,25 @@ public :
             std::size_t min_elements,
             Policy& policy, VisitBoxPolicy& box_policy)
     {
+        if (defer_two_collections
+                <
+                    Dimension, Box,
+                    OverlapsPolicy1, OverlapsPolicy2,
+                    ExpandPolicy1, ExpandPolicy2,
+                    VisitBoxPolicy,
+                    DivideBoxPolicy
+                >(box, collection1, input1, collection2, input2,
+                    level, min_elements, policy))
+        {
+            return;
+        }
+
         box_policy.apply(box, level);
 
         Box lower_box, upper_box;
-        divide_box<Dimension>(box, lower_box, upper_box);
+        DivideBoxPolicy::template apply<Dimension, ExpandPolicy1, ExpandPolicy2>(
+                    box, collection1, input1, collection2, input2,
+                    lower_box, upper_box);
 
         index_vector_type lower1, upper1, exceeding1;
         index_vector_type lower2, upper2, exceeding2;
@@ -519,7 +1300,8 @@ template
     typename OverlapsPolicy2 = OverlapsPolicy1,
     typename IncludePolicy1 = detail::partition::include_all_policy,
     typename IncludePolicy2 = detail::partition::include_all_policy,
-    typename VisitBoxPolicy = detail::partition::visit_no_policy
+    typename VisitBoxPolicy = detail::partition::visit_no_policy,
+    typename DivideBoxPolicy = detail::partition::divide_middle_policy
 >
 class partition
 {
@@ -543,6 +1325,157 @@ class partition
         }
     }
 
+    // The pairs are visited concurrently only if the visitor may be splitted
+    // and the boxes aren't visited
+    template <typename VisitPolicy>
+    struct is_parallel
+#if defined(BOOST_GEOMETRY_EXPERIMENTAL_ENABLE_PARALLEL_PARTITION)
+        : boost::mpl::and_
+            <
+                detail::partition::is_splittable_visitor<VisitPolicy>,
+                boost::is_same
+                    <
+                        VisitBoxPolicy,
+                        detail::partition::visit_no_policy
+                    >
+            >
+#else
+        : boost::false_type
+#endif
+    {};
+
+    template <typename InputCollection, typename VisitPolicy>
+    static inline void apply_one(Box const& total,
+            InputCollection const& collection,
+            index_vector_type const& index_vector,
+            VisitPolicy& visitor,
+            std::size_t min_elements,
+            VisitBoxPolicy& box_visitor,
+            boost::false_type /*is_parallel*/)
+    {
+        detail::partition::partition_one_collection
+            <
+                0, Box,
+                OverlapsPolicy1,
+                ExpandPolicy1,
+                VisitBoxPolicy,
+                DivideBoxPolicy
+            >::apply(total, collection, index_vector, 0, min_elements,
+                            visitor, box_visitor);
+    }
+
+    template
+    <
+        typename InputCollection1,
+        typename InputCollection2,
+        typename VisitPolicy
+    >
+    static inline void apply_two(Box const& total,
+            InputCollection1 const& collection1,
+            index_vector_type const& index_vector1,
+            InputCollection2 const& collection2,
+            index_vector_type const& index_vector2,
+            VisitPolicy& visitor,
+            std::size_t min_elements,
+            VisitBoxPolicy& box_visitor,
+            boost::false_type /*is_parallel*/)
+    {
+        detail::partition::partition_two_collections
+            <
+                0, Box, OverlapsPolicy1, OverlapsPolicy2,
+                ExpandPolicy1, ExpandPolicy2, VisitBoxPolicy, DivideBoxPolicy
+            >::apply(total,
+                collection1, index_vector1,
+                collection2, index_vector2,
+                0, min_elements, visitor, box_visitor);
+    }
+
+#if defined(BOOST_GEOMETRY_EXPERIMENTAL_ENABLE_PARALLEL_PARTITION)
+    // Below this number of elements the threads aren't worth starting
+    static inline std::size_t parallel_min_elements()
+    {
+        return 512;
+    }
+
+    template <typename InputCollection, typename VisitPolicy>
+    static inline void apply_one(Box const& total,
+            InputCollection const& collection,
+            index_vector_type const& index_vector,
+            VisitPolicy& visitor,
+            std::size_t min_elements,
+            VisitBoxPolicy& box_visitor,
+            boost::true_type /*is_parallel*/)
+    {
+        std::size_t const threads_count
+            = detail::partition::partition_threads_count();
+        if (threads_count < 2
+            || boost::size(index_vector) < parallel_min_elements())
+        {
+            apply_one(total, collection, index_vector, visitor,
+                    min_elements, box_visitor, boost::false_type());
+            return;
+        }
+
+        detail::partition::partition_tasks<VisitPolicy> tasks(
+                detail::partition::partition_split_level(threads_count));
+        detail::partition::partition_one_collection
+            <
+                0, Box,
+                OverlapsPolicy1,
+                ExpandPolicy1,
+                VisitBoxPolicy,
+                DivideBoxPolicy
+            >::apply(total, collection, index_vector, 0, min_elements,
+                            tasks, box_visitor);
+
+        detail::partition::partition_tasks_runner<VisitPolicy>(tasks, visitor)
+            .apply(threads_count);
+    }
+
+    template
+    <
+        typename InputCollection1,
+        typename InputCollection2,
+        typename VisitPolicy
+    >
+    static inline void apply_two(Box const& total,
+            InputCollection1 const& collection1,
+            index_vector_type const& index_vector1,
+            InputCollection2 const& collection2,
+            index_vector_type const& index_vector2,
+            VisitPolicy& visitor,
+            std::size_t min_elements,
+            VisitBoxPolicy& box_visitor,
+            boost::true_type /*is_parallel*/)
+    {
+        std::size_t const threads_count
+            = detail::partition::partition_threads_count();
+        if (threads_count < 2
+            || boost::size(index_vector1) + boost::size(index_vector2)
+                < parallel_min_elements())
+        {
+            apply_two(total, collection1, index_vector1,
+                    collection2, index_vector2, visitor,
+                    min_elements, box_visitor, boost::false_type());
+            return;
+        }
+
+        detail::partition::partition_tasks<VisitPolicy> tasks(
+                detail::partition::partition_split_level(threads_count));
+        detail::partition::partition_two_collections
+            <
+                0, Box, OverlapsPolicy1, OverlapsPolicy2,
+                ExpandPolicy1, ExpandPolicy2, VisitBoxPolicy, DivideBoxPolicy
+            >::apply(total,
+                collection1, index_vector1,
+                collection2, index_vector2,
+                0, min_elements, tasks, box_visitor);
+
+        detail::partition::partition_tasks_runner<VisitPolicy>(tasks, visitor)
+            .apply(threads_count);
+    }
+#endif
+
 public :
     template <typename InputCollection, typename VisitPolicy>
     static inline void apply(InputCollection const& collection,
@@ -559,14 +1492,12 @@ public :
             expand_to_collection<ExpandPolicy1, IncludePolicy1>(collection,
                     total, index_vector);
 
-            detail::partition::partition_one_collection
-                <
-                    0, Box,
-                    OverlapsPolicy1,
-                    ExpandPolicy1,
-                    VisitBoxPolicy
-                >::apply(total, collection, index_vector, 0, min_elements,
-                                visitor, box_visitor);
+            apply_one(total, collection, index_vector, visitor,
+                    min_elements, box_visitor,
+                    boost::integral_constant
+                        <
+                            bool, is_parallel<VisitPolicy>::value
+                        >());
         }
         else
         {
@@ -611,14 +1542,13 @@ public :
             expand_to_collection<ExpandPolicy2, IncludePolicy2>(collection2,
                     total, index_vector2);
 
-            detail::partition::partition_two_collections
-                <
-                    0, Box, OverlapsPolicy1, OverlapsPolicy2,
-                    ExpandPolicy1, ExpandPolicy2, VisitBoxPolicy
-                >::apply(total,
-                    collection1, index_vector1,
-                    collection2, index_vector2,
-                    0, min_elements, visitor, box_visitor);
+            apply_two(total, collection1, index_vector1,
+                    collection2, index_vector2, visitor,
+                    min_elements, box_visitor,
+                    boost::integral_constant
+                        <
+                            bool, is_parallel<VisitPolicy>::value
+                        >());
         }
         else
         {
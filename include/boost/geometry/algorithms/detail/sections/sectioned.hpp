@@ -0,0 +1,69 @@
+// Boost.Geometry (aka GGL, Generic Geometry Library)
+
+// Copyright (c) 2026 agent.
+
+// Use, modification and distribution is subject to the Boost Software License,
+// Version 1.0. (See accompanying file LICENSE_1_0.txt or copy at
+// http://www.boost.org/LICENSE_1_0.txt)
+
+#ifndef BOOST_GEOMETRY_ALGORITHMS_DETAIL_SECTIONS_SECTIONED_HPP
+#define BOOST_GEOMETRY_ALGORITHMS_DETAIL_SECTIONS_SECTIONED_HPP
+
+#include <boost/geometry/algorithms/detail/sections/sectionalize.hpp>
+#include <boost/geometry/views/sectioned.hpp>
+
+
+namespace boost { namespace geometry
+{
+
+#ifndef DOXYGEN_NO_DETAIL
+namespace detail { namespace sectionalize
+{
+
+// Sectionalizes the geometry, or returns the sections of the sectioned
+// geometry
+template
+<
+    bool Reverse,
+    typename DimensionVector,
+    typename Geometry,
+    typename Sections,
+    typename RobustPolicy
+>
+inline Sections const& get_sections(Geometry const& geometry,
+                RobustPolicy const& robust_policy,
+                Sections& sections,
+                int source_index = 0)
+{
+    geometry::sectionalize<Reverse, DimensionVector>(geometry, robust_policy,
+            sections, source_index);
+    return sections;
+}
+
+template
+<
+    bool Reverse,
+    typename DimensionVector,
+    typename Geometry,
+    typename Sections,
+    typename RobustPolicy
+>
+inline Sections const& get_sections(sectioned<Geometry> const& geometry,
+                RobustPolicy const& robust_policy,
+                Sections& ,
+                int source_index = 0)
+{
+    return geometry.template sections
+        <
+            Reverse, DimensionVector, Sections
+        >(robust_policy, source_index);
+}
+
+}} // namespace detail::sectionalize
+#endif // DOXYGEN_NO_DETAIL
+
+
+}} // namespace boost::geometry
+
+
+#endif // BOOST_GEOMETRY_ALGORITHMS_DETAIL_SECTIONS_SECTIONED_HPP
@@ -0,0 +1,246 @@
+// Boost.Geometry (aka GGL, Generic Geometry Library)
+
+// Copyright (c) 2026 agent.
+
+// Use, modification and distribution is subject to the Boost Software License,
+// Version 1.0. (See accompanying file LICENSE_1_0.txt or copy at
+// http://www.boost.org/LICENSE_1_0.txt)
+
+#ifndef BOOST_GEOMETRY_ALGORITHMS_INCREMENTAL_CONVEX_HULL_HPP
+#define BOOST_GEOMETRY_ALGORITHMS_INCREMENTAL_CONVEX_HULL_HPP
+
+#include <algorithm>
+#include <iterator>
+#include <set>
+#include <vector>
+
+#include <boost/range.hpp>
+
+#include <boost/geometry/core/closure.hpp>
+#include <boost/geometry/core/cs.hpp>
+#include <boost/geometry/core/point_order.hpp>
+
+#include <boost/geometry/geometries/concepts/check.hpp>
+
+#include <boost/geometry/policies/compare.hpp>
+
+#include <boost/geometry/strategies/side.hpp>
+
+#include <boost/geometry/views/detail/range_type.hpp>
+
+#include <boost/geometry/algorithms/detail/as_range.hpp>
+
+
+namespace boost { namespace geometry
+{
+
+
+/*!
+\brief Keeps the convex hull of points which are inserted one at a time
+\ingroup convex_hull
+\details The upper and the lower half of the hull are kept, each as a set
+    ordered on x (then on y). An inserted point which is below the upper half
+    (or above the lower half) is discarded. Otherwise it is inserted, and
+    its neighbours which are not convex anymore are erased. A point is
+    erased only once, so insertion takes amortized O(log n), where n is the
+    number of points of the hull.
+    The hull can be written at any time, it is the same as calculated by
+    convex_hull of all points inserted.
+\tparam Point \tparam_point
+\tparam SideStrategy side strategy to be used, by default the side strategy
+    of the coordinate system
+
+\qbk{
+[heading See also]
+[link geometry.reference.algorithms.convex_hull.convex_hull convex_hull]
+}
+*/
+template
+<
+    typename Point,
+    typename SideStrategy
+        = typename strategy::side::services::default_strategy
+            <
+                typename cs_tag<Point>::type
+            >::type
+>
+class incremental_convex_hull
+{
+    typedef std::set<Point, geometry::less<Point> > half_type;
+    typedef typename half_type::iterator iterator;
+    typedef std::vector<Point> container_type;
+
+public :
+
+    incremental_convex_hull()
+    {
+        concept::check<Point const>();
+    }
+
+    /*!
+    \brief Inserts a point
+    */
+    inline void insert(Point const& point)
+    {
+        insert_in_half<1>(m_upper, point);
+        insert_in_half<-1>(m_lower, point);
+    }
+
+    /*!
+    \brief Returns true if no points are inserted
+    */
+    inline bool empty() const
+    {
+        return m_upper.empty();
+    }
+
+    /*!
+    \brief Removes all points
+    */
+    inline void clear()
+    {
+        m_upper.clear();
+        m_lower.clear();
+    }
+
+    /*!
+    \brief Appends the convex hull of the points inserted until now to the
+        output geometry, with its point order and closure
+    \tparam OutputGeometry \tparam_geometry
+    \param hull \param_geometry \param_set{convex hull}
+    */
+    template <typename OutputGeometry>
+    inline void result(OutputGeometry& hull) const
+    {
+        concept::check<OutputGeometry>();
+
+        if (empty())
+        {
+            // Leave output empty, as convex_hull
+            return;
+        }
+
+        bool const clockwise
+            = geometry::point_order<OutputGeometry>::value == geometry::clockwise;
+        bool const closed
+            = geometry::closure<OutputGeometry>::value != open;
+
+        // Both halves start with the most left point and end with the most
+        // right point, also if it is the same point
+        container_type upper(m_upper.begin(), m_upper.end());
+        container_type lower(m_lower.begin(), m_lower.end());
+        if (upper.size() == 1)
+        {
+            upper.push_back(upper.front());
+            lower.push_back(lower.front());
+        }
+
+        std::back_insert_iterator
+            <
+                typename geometry::detail::range_type<OutputGeometry>::type
+            > out = std::back_inserter(geometry::detail::as_range
+                <
+                    typename geometry::detail::range_type<OutputGeometry>::type
+                >(hull));
+
+        if (clockwise)
+        {
+            output_ranges(upper, lower, out, closed);
+        }
+        else
+        {
+            output_ranges(lower, upper, out, closed);
+        }
+    }
+
+private :
+
+    // Inserts the point in the upper (Factor 1) or lower (Factor -1) half,
+    // if it is outside of it
+    template <int Factor>
+    static inline void insert_in_half(half_type& half, Point const& point)
+    {
+        iterator next = half.lower_bound(point);
+        if (next != half.end() && ! half.key_comp()(point, *next))
+        {
+            // Already there
+            return;
+        }
+        if (next != half.begin() && next != half.end())
+        {
+            iterator previous = next;
+            --previous;
+            if (Factor * SideStrategy::apply(*previous, *next, point) <= 0)
+            {
+                // Inside (or on) the half
+                return;
+            }
+        }
+
+        iterator it = half.insert(next, point);
+
+        // Erase following points which are not convex anymore
+        for (;;)
+        {
+            iterator following = it;
+            ++following;
+            if (following == half.end())
+            {
+                break;
+            }
+            iterator second = following;
+            ++second;
+            if (second == half.end()
+                || Factor * SideStrategy::apply(*it, *second, *following) > 0)
+            {
+                break;
+            }
+            half.erase(following);
+        }
+
+        // Erase preceding points which are not convex anymore
+        while (it != half.begin())
+        {
+            iterator preceding = it;
+            --preceding;
+            if (preceding == half.begin())
+            {
+                break;
+            }
+            iterator second = preceding;
+            --second;
+            if (Factor * SideStrategy::apply(*second, *it, *preceding) > 0)
+            {
+                break;
+            }
+            half.erase(preceding);
+        }
+    }
+
+    // Writes the halves as graham_andrew does
+    template <typename OutputIterator>
+    static inline void output_ranges(container_type const& first,
+                                     container_type const& second,
+                                     OutputIterator out, bool closed)
+    {
+        std::copy(boost::begin(first), boost::end(first), out);
+
+        std::copy(++boost::rbegin(second), // skip the first Point
+                  closed ? boost::rend(second) : --boost::rend(second), // skip the last Point if open
+                  out);
+
+        if (first.size() + second.size() - 1 < 4)
+        {
+            *out++ = *boost::begin(first);
+        }
+    }
+
+    half_type m_upper;
+    half_type m_lower;
+};
+
+
+}} // namespace boost::geometry
+
+
+#endif // BOOST_GEOMETRY_ALGORITHMS_INCREMENTAL_CONVEX_HULL_HPP
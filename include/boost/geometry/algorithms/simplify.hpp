@@ -41,6 +41,12 @@
 
 #include <boost/geometry/algorithms/detail/distance/default_strategies.hpp>
 
+#if defined(BOOST_GEOMETRY_EXPERIMENTAL_ENABLE_PARALLEL_SIMPLIFY)
+#include <vector>
+#include <boost/geometry/algorithms/num_points.hpp>
+#include <boost/geometry/util/detail/parallel_tasks.hpp>
+#endif
+
 namespace boost { namespace geometry
 {
 
@@ -186,6 +192,59 @@ public:
 };
 
 
+#if defined(BOOST_GEOMETRY_EXPERIMENTAL_ENABLE_PARALLEL_SIMPLIFY)
+// Simplifies one of the parts into its own output part
+template
+<
+    typename Policy,
+    typename MultiGeometry,
+    typename Distance,
+    typename Strategy
+>
+struct simplify_multi_tasks
+{
+    typedef typename boost::range_iterator
+        <
+            MultiGeometry const
+        >::type iterator_in_type;
+    typedef typename boost::range_iterator<MultiGeometry>::type iterator_out_type;
+
+    simplify_multi_tasks(MultiGeometry const& multi, MultiGeometry& out,
+                    Distance const& max_distance, Strategy const& strategy)
+        : m_max_distance(max_distance)
+        , m_strategy(strategy)
+    {
+        iterator_out_type it_out = boost::begin(out);
+        for (iterator_in_type it_in = boost::begin(multi);
+             it_in != boost::end(multi);
+             ++it_in, ++it_out)
+        {
+            m_parts_in.push_back(it_in);
+            m_parts_out.push_back(it_out);
+        }
+    }
+
+    inline std::size_t size() const
+    {
+        return m_parts_in.size();
+    }
+
+    inline void run(std::size_t i) const
+    {
+        // Cleared first, a task might be repeated
+        geometry::clear(*m_parts_out[i]);
+        Policy::apply(*m_parts_in[i], *m_parts_out[i],
+                      m_max_distance, m_strategy);
+    }
+
+    std::vector<iterator_in_type> m_parts_in;
+    std::vector<iterator_out_type> m_parts_out;
+    Distance const& m_max_distance;
+    Strategy const& m_strategy;
+};
+#endif
+
+
 template<typename Policy>
 struct simplify_multi
 {
@@ -195,6 +254,26 @@ struct simplify_multi
     {
         traits::resize<MultiGeometry>::apply(out, boost::size(multi));
 
+#if defined(BOOST_GEOMETRY_EXPERIMENTAL_ENABLE_PARALLEL_SIMPLIFY)
+        // The parts are simplified concurrently, each one into its own
+        // output part, so the output is the same as in the serial case.
+        // The strategy, running in these threads, does not start threads.
+        std::size_t const threads_count
+            = geometry::strategy::simplify::detail::simplify_threads_count();
+        if (threads_count >= 2
+            && boost::size(multi) >= 2
+            && geometry::num_points(multi) >= parallel_min_points())
+        {
+            geometry::detail::parallel::run_tasks(
+                simplify_multi_tasks
+                    <
+                        Policy, MultiGeometry, Distance, Strategy
+                    >(multi, out, max_distance, strategy),
+                threads_count);
+            return;
+        }
+#endif
+
         typename boost::range_iterator<MultiGeometry>::type it_out
                 = boost::begin(out);
         for (typename boost::range_iterator<MultiGeometry const>::type
@@ -205,6 +284,15 @@ struct simplify_multi
             Policy::apply(*it_in, *it_out, max_distance, strategy);
         }
     }
+
+#if defined(BOOST_GEOMETRY_EXPERIMENTAL_ENABLE_PARALLEL_SIMPLIFY)
+private :
+    // Below this number of points the threads aren't worth starting
+    static inline std::size_t parallel_min_points()
+    {
+        return 8192;
+    }
+#endif
 };
 
 
@@ -0,0 +1,839 @@
+// Boost.Geometry (aka GGL, Generic Geometry Library)
+
+// Copyright (c) 2026 agent.
+
+// Use, modification and distribution is subject to the Boost Software License,
+// Version 1.0. (See accompanying file LICENSE_1_0.txt or copy at
+// http://www.boost.org/LICENSE_1_0.txt)
+
+#ifndef BOOST_GEOMETRY_ALGORITHMS_SIMPLIFY_PRESERVING_TOPOLOGY_HPP
+#define BOOST_GEOMETRY_ALGORITHMS_SIMPLIFY_PRESERVING_TOPOLOGY_HPP
+
+#include <cstddef>
+#include <algorithm>
+#include <iterator>
+#include <map>
+#include <utility>
+#include <vector>
+
+#include <boost/range.hpp>
+
+#include <boost/geometry/core/access.hpp>
+#include <boost/geometry/core/closure.hpp>
+#include <boost/geometry/core/cs.hpp>
+#include <boost/geometry/core/exterior_ring.hpp>
+#include <boost/geometry/core/interior_rings.hpp>
+#include <boost/geometry/core/mutable_range.hpp>
+#include <boost/geometry/core/point_type.hpp>
+#include <boost/geometry/core/tag.hpp>
+#include <boost/geometry/core/tags.hpp>
+
+#include <boost/geometry/geometries/box.hpp>
+#include <boost/geometry/geometries/multi_polygon.hpp>
+#include <boost/geometry/geometries/concepts/check.hpp>
+
+#include <boost/geometry/algorithms/clear.hpp>
+#include <boost/geometry/algorithms/envelope.hpp>
+#include <boost/geometry/algorithms/expand.hpp>
+#include <boost/geometry/algorithms/is_valid.hpp>
+#include <boost/geometry/algorithms/not_implemented.hpp>
+#include <boost/geometry/algorithms/point_on_surface.hpp>
+#include <boost/geometry/algorithms/within.hpp>
+#include <boost/geometry/algorithms/detail/interior_iterator.hpp>
+#include <boost/geometry/algorithms/detail/disjoint/box_box.hpp>
+#include <boost/geometry/algorithms/detail/distance/default_strategies.hpp>
+#include <boost/geometry/algorithms/detail/equals/point_point.hpp>
+#include <boost/geometry/algorithms/detail/partition.hpp>
+
+#include <boost/geometry/policies/compare.hpp>
+
+#include <boost/geometry/strategies/agnostic/simplify_douglas_peucker.hpp>
+#include <boost/geometry/strategies/side.hpp>
+
+#include <boost/geometry/util/math.hpp>
+#include <boost/geometry/util/range.hpp>
+
+
+namespace boost { namespace geometry
+{
+
+
+#ifndef DOXYGEN_NO_DETAIL
+namespace detail { namespace simplify_preserving_topology
+{
+
+// One segment of an arc, as item of the partition
+template <typename Point>
+struct arc_segment
+{
+    arc_segment(Point const& p1, Point const& p2, std::size_t a)
+        : first(&p1)
+        , second(&p2)
+        , arc(a)
+    {}
+
+    Point const* first;
+    Point const* second;
+    std::size_t arc;
+};
+
+struct expand_segment
+{
+    template <typename Box, typename Segment>
+    static inline void apply(Box& total, Segment const& segment)
+    {
+        geometry::expand(total, *segment.first);
+        geometry::expand(total, *segment.second);
+    }
+};
+
+struct overlaps_segment
+{
+    template <typename Box, typename Segment>
+    static inline bool apply(Box const& box, Segment const& segment)
+    {
+        Box segment_box;
+        geometry::envelope(*segment.first, segment_box);
+        geometry::expand(segment_box, *segment.second);
+        return ! detail::disjoint::disjoint_box_box(box, segment_box);
+    }
+};
+
+// Returns true if the segments p and q have more in common than one
+// shared endpoint: if they cross, overlap, or if an endpoint of one lies
+// on the other one without being an endpoint of both
+template <typename Point>
+inline bool segments_conflict(Point const& p1, Point const& p2,
+                              Point const& q1, Point const& q2)
+{
+    typedef typename strategy::side::services::default_strategy
+        <
+            typename cs_tag<Point>::type
+        >::type side_strategy;
+
+    int const side_q1 = side_strategy::apply(p1, p2, q1);
+    int const side_q2 = side_strategy::apply(p1, p2, q2);
+    int const side_p1 = side_strategy::apply(q1, q2, p1);
+    int const side_p2 = side_strategy::apply(q1, q2, p2);
+
+    if (side_q1 * side_q2 > 0 || side_p1 * side_p2 > 0)
+    {
+        // Disjoint
+        return false;
+    }
+
+    bool const p1_shared = equals::equals_point_point(p1, q1)
+        || equals::equals_point_point(p1, q2);
+    bool const p2_shared = equals::equals_point_point(p2, q1)
+        || equals::equals_point_point(p2, q2);
+
+    if (side_q1 == 0 && side_q2 == 0 && side_p1 == 0 && side_p2 == 0)
+    {
+        // Collinear, compare the projections on the largest dimension
+        bool const use_x = geometry::math::abs(get<0>(p2) - get<0>(p1))
+                        >= geometry::math::abs(get<1>(p2) - get<1>(p1));
+        typedef typename coordinate_type<Point>::type coordinate_type;
+        coordinate_type const a1 = use_x ? get<0>(p1) : get<1>(p1);
+        coordinate_type const a2 = use_x ? get<0>(p2) : get<1>(p2);
+        coordinate_type const b1 = use_x ? get<0>(q1) : get<1>(q1);
+        coordinate_type const b2 = use_x ? get<0>(q2) : get<1>(q2);
+        coordinate_type const low = (std::max)((std::min)(a1, a2), (std::min)(b1, b2));
+        coordinate_type const high = (std::min)((std::max)(a1, a2), (std::max)(b1, b2));
+        if (high < low)
+        {
+            return false;
+        }
+        // They overlap, or they touch, which is fine at a shared endpoint
+        return low < high || ! (p1_shared || p2_shared);
+    }
+
+    if (side_q1 != 0 && side_q2 != 0 && side_p1 != 0 && side_p2 != 0)
+    {
+        // Crossing
+        return true;
+    }
+
+    // Touching, the endpoints lying on the other segment should be shared
+    bool const q1_shared = equals::equals_point_point(q1, p1)
+        || equals::equals_point_point(q1, p2);
+    bool const q2_shared = equals::equals_point_point(q2, p1)
+        || equals::equals_point_point(q2, p2);
+    return (side_q1 == 0 && ! q1_shared)
+        || (side_q2 == 0 && ! q2_shared)
+        || (side_p1 == 0 && ! p1_shared)
+        || (side_p2 == 0 && ! p2_shared);
+}
+
+struct conflict_visitor
+{
+    conflict_visitor(std::vector<char> const& original,
+                     std::vector<char>& conflicts)
+        : m_original(original)
+        , m_conflicts(conflicts)
+    {}
+
+    template <typename Segment>
+    inline void apply(Segment const& s1, Segment const& s2)
+    {
+        if (m_original[s1.arc] && m_original[s2.arc])
+        {
+            return;
+        }
+        if (segments_conflict(*s1.first, *s1.second, *s2.first, *s2.second))
+        {
+            m_conflicts[s1.arc] = ! m_original[s1.arc];
+            m_conflicts[s2.arc] = ! m_original[s2.arc];
+        }
+    }
+
+    std::vector<char> const& m_original;
+    std::vector<char>& m_conflicts;
+};
+
+
+// Splits the rings of the polygons into arcs: chains of points between
+// junctions, the points where rings meet or separate. An arc shared by
+// rings is stored once. The arcs are simplified and the rings are built
+// from them. Simplified arcs which make the result invalid are replaced by
+// their original points, until the result is valid.
+template <typename Polygon>
+class topology_simplifier
+{
+    typedef typename point_type<Polygon>::type point_type;
+    typedef std::vector<point_type> points_type;
+    typedef geometry::less<point_type> less_type;
+    typedef std::pair<point_type, point_type> key_type;
+    typedef model::multi_polygon<Polygon> multi_polygon_type;
+
+    static const bool is_closed = geometry::closure<Polygon>::value == closed;
+
+    // The distinct neighbours of a point, on all rings
+    struct node
+    {
+        node()
+            : count(0)
+        {}
+
+        inline void add(point_type const& neighbour)
+        {
+            for (std::size_t i = 0; i < count && i < 2; i++)
+            {
+                if (detail::equals::equals_point_point(neighbours[i], neighbour))
+                {
+                    return;
+                }
+            }
+            if (count < 2)
+            {
+                neighbours[count] = neighbour;
+            }
+            count++;
+        }
+
+        inline bool is_junction() const
+        {
+            return count > 2;
+        }
+
+        point_type neighbours[2];
+        std::size_t count;
+    };
+
+    struct key_less
+    {
+        inline bool operator()(key_type const& left, key_type const& right) const
+        {
+            less_type less;
+            return less(left.first, right.first)
+                || (! less(right.first, left.first)
+                    && less(left.second, right.second));
+        }
+    };
+
+    // Reference to an arc, as part of a ring
+    struct arc_ref
+    {
+        arc_ref(std::size_t a, bool r)
+            : arc(a)
+            , reversed(r)
+        {}
+
+        std::size_t arc;
+        bool reversed;
+    };
+
+    struct ring_info
+    {
+        std::size_t polygon;
+        std::size_t original_size;
+        std::vector<arc_ref> arcs;
+    };
+
+public :
+
+    inline void add_polygon(Polygon const& polygon)
+    {
+        std::size_t const index = m_polygons.size();
+        m_polygons.push_back(std::vector<std::size_t>());
+        add_ring(exterior_ring(polygon), index);
+
+        typename interior_return_type<Polygon const>::type
+            rings = interior_rings(polygon);
+        for (typename detail::interior_iterator<Polygon const>::type
+                it = boost::begin(rings); it != boost::end(rings); ++it)
+        {
+            add_ring(*it, index);
+        }
+        m_input.push_back(polygon);
+        m_valid_input.push_back(geometry::is_valid(polygon));
+    }
+
+    template <typename Distance, typename Strategy>
+    inline void apply(Distance const& max_distance, Strategy const& strategy)
+    {
+        build_arcs();
+
+        // Polygons sharing borders don't form a valid multi-polygon, then
+        // only the polygons are checked separately
+        m_valid_input_multi = m_input.size() > 1
+            && is_valid_multi(m_input);
+
+        m_simplified.resize(m_arcs.size());
+        m_original.resize(m_arcs.size(), 0);
+        for (std::size_t i = 0; i < m_arcs.size(); i++)
+        {
+            points_type const& arc = m_arcs[i];
+            if (arc.size() <= 2)
+            {
+                m_original[i] = 1;
+            }
+            else
+            {
+                strategy.apply(arc, std::back_inserter(m_simplified[i]),
+                               max_distance);
+                if (m_simplified[i].size() == arc.size())
+                {
+                    m_original[i] = 1;
+                }
+            }
+        }
+
+        restore_collapsed_rings();
+        while (restore_conflicts() || restore_invalid())
+        {}
+    }
+
+    inline void output(std::size_t index, Polygon& polygon) const
+    {
+        std::vector<std::size_t> const& rings = m_polygons[index];
+
+        geometry::clear(polygon);
+        build_ring(m_rings[rings.front()], exterior_ring(polygon));
+        build_interior_rings(rings, interior_rings(polygon));
+    }
+
+private :
+
+    template <typename Ring>
+    inline void add_ring(Ring const& ring, std::size_t polygon_index)
+    {
+        points_type points(boost::begin(ring), boost::end(ring));
+        if (! is_closed && ! points.empty())
+        {
+            points.push_back(points.front());
+        }
+
+        m_polygons[polygon_index].push_back(m_rings.size());
+        m_ring_points.push_back(points);
+        m_rings.push_back(ring_info());
+        m_rings.back().polygon = polygon_index;
+        m_rings.back().original_size = points.size();
+    }
+
+    inline points_type const& current(std::size_t arc) const
+    {
+        return m_original[arc] ? m_arcs[arc] : m_simplified[arc];
+    }
+
+    // Builds the ring (closed, in the original direction) from its arcs
+    inline void build_ring(ring_info const& info, points_type& points) const
+    {
+        points.clear();
+        for (std::size_t i = 0; i < info.arcs.size(); i++)
+        {
+            points_type const& arc = current(info.arcs[i].arc);
+            std::size_t const skip = points.empty() ? 0 : 1;
+            if (info.arcs[i].reversed)
+            {
+                points.insert(points.end(), arc.rbegin() + skip, arc.rend());
+            }
+            else
+            {
+                points.insert(points.end(), arc.begin() + skip, arc.end());
+            }
+        }
+    }
+
+    template <typename InteriorRings>
+    inline void build_interior_rings(std::vector<std::size_t> const& rings,
+                                     InteriorRings& interiors) const
+    {
+        traits::resize<InteriorRings>::apply(interiors, rings.size() - 1);
+
+        typename boost::range_iterator<InteriorRings>::type
+            it = boost::begin(interiors);
+        for (std::size_t i = 1; i < rings.size(); i++, ++it)
+        {
+            build_ring(m_rings[rings[i]], *it);
+        }
+    }
+
+    template <typename Ring>
+    inline void build_ring(ring_info const& info, Ring& ring) const
+    {
+        points_type points;
+        build_ring(info, points);
+        if (! is_closed && ! points.empty())
+        {
+            points.pop_back();
+        }
+        for (typename points_type::const_iterator it = points.begin();
+             it != points.end(); ++it)
+        {
+            range::push_back(ring, *it);
+        }
+    }
+
+    inline void build_arcs()
+    {
+        typedef std::map<point_type, node, less_type> node_map;
+        node_map nodes;
+        for (std::size_t r = 0; r < m_ring_points.size(); r++)
+        {
+            points_type const& points = m_ring_points[r];
+            if (points.size() < 2)
+            {
+                continue;
+            }
+            std::size_t const count = points.size() - 1;
+            for (std::size_t i = 0; i < count; i++)
+            {
+                node& n = nodes[points[i]];
+                n.add(points[i == 0 ? count - 1 : i - 1]);
+                n.add(points[i + 1]);
+            }
+        }
+
+        typedef std::map<key_type, std::size_t, key_less> arc_map;
+        arc_map arc_indices;
+        less_type less;
+
+        for (std::size_t r = 0; r < m_ring_points.size(); r++)
+        {
+            points_type const& points = m_ring_points[r];
+            if (points.size() < 2)
+            {
+                continue;
+            }
+            std::size_t const count = points.size() - 1;
+
+            std::vector<std::size_t> junctions;
+            for (std::size_t i = 0; i < count; i++)
+            {
+                if (nodes[points[i]].is_junction())
+                {
+                    junctions.push_back(i);
+                }
+            }
+            if (junctions.empty())
+            {
+                // The ring is one arc, starting at its smallest point, which
+                // is the same for all rings sharing it
+                std::size_t anchor = 0;
+                for (std::size_t i = 1; i < count; i++)
+                {
+                    if (less(points[i], points[anchor]))
+                    {
+                        anchor = i;
+                    }
+                }
+                junctions.push_back(anchor);
+            }
+
+            for (std::size_t j = 0; j < junctions.size(); j++)
+            {
+                std::size_t const first = junctions[j];
+                std::size_t const last = j + 1 < junctions.size()
+                    ? junctions[j + 1] : junctions.front() + count;
+
+                points_type arc;
+                for (std::size_t i = first; i <= last; i++)
+                {
+                    arc.push_back(points[i % count]);
+                }
+
+                // Both directions are identified by the first two points
+                key_type const forward(arc[0], arc[1]);
+                key_type const backward(arc[arc.size() - 1], arc[arc.size() - 2]);
+                bool const reversed = key_less()(backward, forward);
+                key_type const& key = reversed ? backward : forward;
+
+                typename arc_map::const_iterator it = arc_indices.find(key);
+                std::size_t index = m_arcs.size();
+                if (it == arc_indices.end())
+                {
+                    arc_indices.insert(std::make_pair(key, index));
+                    if (reversed)
+                    {
+                        std::reverse(arc.begin(), arc.end());
+                    }
+                    m_arcs.push_back(points_type());
+                    m_arcs.back().swap(arc);
+                }
+                else
+                {
+                    index = it->second;
+                }
+                m_rings[r].arcs.push_back(arc_ref(index, reversed));
+            }
+        }
+    }
+
+    inline void restore_ring(ring_info const& info)
+    {
+        for (std::size_t i = 0; i < info.arcs.size(); i++)
+        {
+            m_original[info.arcs[i].arc] = 1;
+        }
+    }
+
+    // Rings with less than four points are restored. Restoring arcs only
+    // adds points to other rings, so one pass is enough.
+    inline void restore_collapsed_rings()
+    {
+        std::size_t const minimum = 4;
+        for (std::size_t r = 0; r < m_rings.size(); r++)
+        {
+            ring_info const& info = m_rings[r];
+            std::size_t size = 1;
+            for (std::size_t i = 0; i < info.arcs.size(); i++)
+            {
+                size += current(info.arcs[i].arc).size() - 1;
+            }
+            if (size < minimum && size < info.original_size)
+            {
+                restore_ring(info);
+            }
+        }
+    }
+
+    // Restores the simplified arcs crossing, overlapping or touching other
+    // arcs, returns true if any arc was restored
+    inline bool restore_conflicts()
+    {
+        typedef arc_segment<point_type> segment_type;
+        std::vector<segment_type> segments;
+        for (std::size_t a = 0; a < m_arcs.size(); a++)
+        {
+            points_type const& arc = current(a);
+            for (std::size_t i = 0; i + 1 < arc.size(); i++)
+            {
+                segments.push_back(segment_type(arc[i], arc[i + 1], a));
+            }
+        }
+
+        std::vector<char> conflicts(m_arcs.size(), 0);
+        conflict_visitor visitor(m_original, conflicts);
+        geometry::partition
+            <
+                model::box<point_type>,
+                expand_segment,
+                overlaps_segment
+            >::apply(segments, visitor);
+
+        return restore(conflicts);
+    }
+
+    // Restores the polygons which are invalid but were valid, and the pairs
+    // of polygons of which one is now inside the other, or which now make
+    // the multi-polygon invalid, returns true if any arc was restored
+    inline bool restore_invalid()
+    {
+        std::vector<Polygon> polygons(m_polygons.size());
+        std::vector<model::box<point_type> > boxes(m_polygons.size());
+        std::vector<char> valid(m_polygons.size(), 0);
+        for (std::size_t i = 0; i < m_polygons.size(); i++)
+        {
+            output(i, polygons[i]);
+            geometry::envelope(exterior_ring(polygons[i]), boxes[i]);
+            valid[i] = geometry::is_valid(polygons[i]);
+        }
+
+        std::vector<char> conflicts(m_arcs.size(), 0);
+        bool marked = false;
+        for (std::size_t i = 0; i < polygons.size(); i++)
+        {
+            if (m_valid_input[i] && ! valid[i])
+            {
+                mark_polygon(i, conflicts);
+                marked = true;
+            }
+        }
+
+        // The vertices of a ring may lie on the borders of other polygons,
+        // so a point in the interior of the polygon is checked
+        for (std::size_t i = 0; i < polygons.size(); i++)
+        {
+            if (! valid[i] || polygons.size() < 2)
+            {
+                continue;
+            }
+            point_type point;
+            geometry::point_on_surface(polygons[i], point);
+            for (std::size_t j = 0; j < polygons.size(); j++)
+            {
+                if (i != j
+                    && ! detail::disjoint::disjoint_box_box(boxes[i], boxes[j])
+                    && geometry::within(point, polygons[j])
+                    && ! geometry::within(point, m_input[j]))
+                {
+                    mark_polygon(i, conflicts);
+                    mark_polygon(j, conflicts);
+                    marked = true;
+                }
+            }
+        }
+
+        if (! marked && m_valid_input_multi
+            && ! is_valid_multi(polygons))
+        {
+            mark_invalid_pairs(polygons, boxes, conflicts);
+        }
+
+        return restore(conflicts);
+    }
+
+    static inline bool is_valid_multi(std::vector<Polygon> const& polygons)
+    {
+        multi_polygon_type multi;
+        std::copy(polygons.begin(), polygons.end(), std::back_inserter(multi));
+        return geometry::is_valid(multi);
+    }
+
+    // Marks the pairs of polygons which together are not valid, or all
+    // polygons if no such pair is found
+    inline void mark_invalid_pairs(std::vector<Polygon> const& polygons,
+                                   std::vector<model::box<point_type> > const& boxes,
+                                   std::vector<char>& conflicts) const
+    {
+        bool marked = false;
+        for (std::size_t i = 0; i < polygons.size(); i++)
+        {
+            for (std::size_t j = i + 1; j < polygons.size(); j++)
+            {
+                if (detail::disjoint::disjoint_box_box(boxes[i], boxes[j]))
+                {
+                    continue;
+                }
+                multi_polygon_type pair;
+                pair.push_back(polygons[i]);
+                pair.push_back(polygons[j]);
+                if (! geometry::is_valid(pair))
+                {
+                    mark_polygon(i, conflicts);
+                    mark_polygon(j, conflicts);
+                    marked = true;
+                }
+            }
+        }
+
+        for (std::size_t i = 0; ! marked && i < polygons.size(); i++)
+        {
+            mark_polygon(i, conflicts);
+        }
+    }
+
+    inline void mark_polygon(std::size_t index, std::vector<char>& conflicts) const
+    {
+        std::vector<std::size_t> const& rings = m_polygons[index];
+        for (std::size_t r = 0; r < rings.size(); r++)
+        {
+            ring_info const& info = m_rings[rings[r]];
+            for (std::size_t i = 0; i < info.arcs.size(); i++)
+            {
+                conflicts[info.arcs[i].arc] = ! m_original[info.arcs[i].arc];
+            }
+        }
+    }
+
+    inline bool restore(std::vector<char> const& conflicts)
+    {
+        bool restored = false;
+        for (std::size_t i = 0; i < conflicts.size(); i++)
+        {
+            if (conflicts[i])
+            {
+                m_original[i] = 1;
+                restored = true;
+            }
+        }
+        return restored;
+    }
+
+    std::vector<points_type> m_ring_points;
+    std::vector<ring_info> m_rings;
+    std::vector<std::vector<std::size_t> > m_polygons;
+    std::vector<Polygon> m_input;
+    std::vector<char> m_valid_input;
+    bool m_valid_input_multi;
+
+    std::vector<points_type> m_arcs;
+    std::vector<points_type> m_simplified;
+    std::vector<char> m_original;
+};
+
+
+template <typename Polygon>
+struct simplify_polygon
+{
+    template <typename Distance, typename Strategy>
+    static inline void apply(Polygon const& polygon, Polygon& out,
+                    Distance const& max_distance, Strategy const& strategy)
+    {
+        topology_simplifier<Polygon> simplifier;
+        simplifier.add_polygon(polygon);
+        simplifier.apply(max_distance, strategy);
+        simplifier.output(0, out);
+    }
+};
+
+template <typename MultiPolygon>
+struct simplify_multi_polygon
+{
+    template <typename Distance, typename Strategy>
+    static inline void apply(MultiPolygon const& multi, MultiPolygon& out,
+                    Distance const& max_distance, Strategy const& strategy)
+    {
+        typedef typename boost::range_value<MultiPolygon>::type polygon_type;
+
+        topology_simplifier<polygon_type> simplifier;
+        for (typename boost::range_iterator<MultiPolygon const>::type
+                it = boost::begin(multi); it != boost::end(multi); ++it)
+        {
+            simplifier.add_polygon(*it);
+        }
+        simplifier.apply(max_distance, strategy);
+
+        traits::resize<MultiPolygon>::apply(out, boost::size(multi));
+        std::size_t index = 0;
+        for (typename boost::range_iterator<MultiPolygon>::type
+                it = boost::begin(out); it != boost::end(out); ++it, ++index)
+        {
+            simplifier.output(index, *it);
+        }
+    }
+};
+
+
+}} // namespace detail::simplify_preserving_topology
+#endif // DOXYGEN_NO_DETAIL
+
+
+#ifndef DOXYGEN_NO_DISPATCH
+namespace dispatch
+{
+
+template <typename Geometry, typename Tag = typename tag<Geometry>::type>
+struct simplify_preserving_topology : not_implemented<Tag>
+{};
+
+template <typename Polygon>
+struct simplify_preserving_topology<Polygon, polygon_tag>
+    : detail::simplify_preserving_topology::simplify_polygon<Polygon>
+{};
+
+template <typename MultiPolygon>
+struct simplify_preserving_topology<MultiPolygon, multi_polygon_tag>
+    : detail::simplify_preserving_topology::simplify_multi_polygon<MultiPolygon>
+{};
+
+} // namespace dispatch
+#endif // DOXYGEN_NO_DISPATCH
+
+
+/*!
+\brief Simplify a polygon or multi-polygon, keeping shared borders shared
+\ingroup simplify
+\details The rings are split into arcs at the points where rings meet or
+    separate, such that a border shared by adjacent polygons (or by a hole
+    and the polygon filling it) is one arc. Each arc is simplified once,
+    with its end points kept, and the rings are built from the simplified
+    arcs. So shared borders stay shared, without slivers or overlaps.
+    A simplified arc which would make the result invalid (crossing or
+    touching another arc, collapsing a ring, or moving a polygon inside
+    another one) is kept as it was.
+\tparam Geometry \tparam_geometry
+\tparam Distance A numerical distance measure
+\tparam Strategy A type fulfilling a SimplifyStrategy concept
+\param geometry input geometry, to be simplified
+\param out output geometry, simplified version of the input geometry
+\param max_distance distance (in units of input coordinates) of a vertex
+    to other segments to be removed
+\param strategy simplify strategy to be used for simplification of each arc
+\note Shared borders are recognized by their vertices, which should be
+    exactly equal in the rings sharing them
+
+\qbk{distinguish,with strategy}
+*/
+template<typename Geometry, typename Distance, typename Strategy>
+inline void simplify_preserving_topology(Geometry const& geometry,
+            Geometry& out, Distance const& max_distance,
+            Strategy const& strategy)
+{
+    concept::check<Geometry>();
+
+    geometry::clear(out);
+    if (max_distance < 0)
+    {
+        out = geometry;
+        return;
+    }
+
+    dispatch::simplify_preserving_topology
+        <
+            Geometry
+        >::apply(geometry, out, max_distance, strategy);
+}
+
+
+/*!
+\brief Simplify a polygon or multi-polygon, keeping shared borders shared
+\ingroup simplify
+\details The arcs between the points where rings meet or separate are
+    simplified with the Douglas-Peucker algorithm, once per shared border.
+\tparam Geometry \tparam_geometry
+\tparam Distance \tparam_numeric
+\param geometry input geometry, to be simplified
+\param out output geometry, simplified version of the input geometry
+\param max_distance distance (in units of input coordinates) of a vertex
+    to other segments to be removed
+ */
+template<typename Geometry, typename Distance>
+inline void simplify_preserving_topology(Geometry const& geometry,
+            Geometry& out, Distance const& max_distance)
+{
+    typedef typename point_type<Geometry>::type point_type;
+    typedef typename strategy::distance::services::default_strategy
+        <
+            point_tag, segment_tag, point_type
+        >::type ds_strategy_type;
+
+    simplify_preserving_topology(geometry, out, max_distance,
+        strategy::simplify::douglas_peucker<point_type, ds_strategy_type>());
+}
+
+
+}} // namespace boost::geometry
+
+
+#endif // BOOST_GEOMETRY_ALGORITHMS_SIMPLIFY_PRESERVING_TOPOLOGY_HPP
@@ -0,0 +1,208 @@
+// Boost.Geometry (aka GGL, Generic Geometry Library)
+
+// Copyright (c) 2026 agent.
+
+// Use, modification and distribution is subject to the Boost Software License,
+// Version 1.0. (See accompanying file LICENSE_1_0.txt or copy at
+// http://www.boost.org/LICENSE_1_0.txt)
+
+#ifndef BOOST_GEOMETRY_ALGORITHMS_SIMPLIFY_STREAM_HPP
+#define BOOST_GEOMETRY_ALGORITHMS_SIMPLIFY_STREAM_HPP
+
+#include <cstddef>
+#include <algorithm>
+#include <iterator>
+#include <vector>
+
+#include <boost/geometry/core/tags.hpp>
+
+#include <boost/geometry/geometries/concepts/check.hpp>
+
+#include <boost/geometry/algorithms/detail/distance/default_strategies.hpp>
+
+#include <boost/geometry/strategies/agnostic/simplify_douglas_peucker.hpp>
+
+
+namespace boost { namespace geometry
+{
+
+#ifndef DOXYGEN_NO_DETAIL
+namespace detail { namespace simplify
+{
+
+// Output iterator ignoring the points written to it
+struct discarding_output_iterator
+{
+    typedef std::output_iterator_tag iterator_category;
+    typedef void value_type;
+    typedef void difference_type;
+    typedef void pointer;
+    typedef void reference;
+
+    inline discarding_output_iterator& operator*() { return *this; }
+    inline discarding_output_iterator& operator++() { return *this; }
+    inline discarding_output_iterator& operator++(int) { return *this; }
+
+    template <typename T>
+    inline discarding_output_iterator& operator=(T const&) { return *this; }
+};
+
+}} // namespace detail::simplify
+#endif // DOXYGEN_NO_DETAIL
+
+
+/*!
+\brief Simplifies an unbounded sequence of points, one point at a time
+\ingroup simplify
+\details The points are pushed one after another. They are collected in a
+    window, which is simplified with the Douglas-Peucker algorithm when it
+    is full. The points kept in the window, except the last one, are final
+    and written to the output iterator. The window then starts at the last
+    kept point. So the memory used is bounded by the size of the window,
+    and every point which is not written is within max_distance of the
+    segment between the written points around it, as in simplify.
+    Call finish at the end of the sequence, to write the remaining points.
+\tparam Point \tparam_point
+\tparam OutputIterator \tparam_output_iterator
+\tparam PointSegmentDistanceStrategy point-segment distance strategy to be
+    used, by default the default strategy of the coordinate system
+\note If the points of a full window are all within max_distance of the
+    segment between its first and last point, the last point is written
+    anyway, such that the window can be emptied. The same happens if more
+    than half of the window follows the last kept point. So the output can
+    contain a few more points than simplify of the whole sequence, roughly
+    one per half window.
+
+\qbk{
+[heading See also]
+[link geometry.reference.algorithms.simplify.simplify_3 simplify]
+}
+*/
+template
+<
+    typename Point,
+    typename OutputIterator,
+    typename PointSegmentDistanceStrategy
+        = typename strategy::distance::services::default_strategy
+            <
+                point_tag, segment_tag, Point
+            >::type
+>
+class simplify_stream
+{
+    typedef strategy::simplify::douglas_peucker
+        <
+            Point, PointSegmentDistanceStrategy
+        > strategy_type;
+
+public :
+
+    typedef typename strategy_type::distance_type distance_type;
+
+    /*!
+    \brief Constructs the stream
+    \param out output iterator, receiving the points which are kept
+    \param max_distance distance (in units of input coordinates) of a vertex
+        to other segments to be removed
+    \param window_size maximum number of points kept in memory (at least 3)
+    */
+    simplify_stream(OutputIterator out, distance_type const& max_distance,
+                std::size_t window_size = 256)
+        : m_out(out)
+        , m_max_distance(max_distance)
+        , m_window_size((std::max)(window_size, std::size_t(3)))
+    {
+        m_window.reserve(m_window_size);
+    }
+
+    /*!
+    \brief Adds the next point of the sequence
+    */
+    inline void push(Point const& point)
+    {
+        if (m_max_distance < 0)
+        {
+            // All points are kept, as in simplify
+            *m_out++ = point;
+            return;
+        }
+        if (m_window.empty())
+        {
+            // The first point is always kept
+            *m_out++ = point;
+        }
+        m_window.push_back(point);
+        if (m_window.size() >= m_window_size)
+        {
+            simplify_window(false);
+        }
+    }
+
+    /*!
+    \brief Writes the remaining points of the sequence. The next pushed
+        point starts a new sequence
+    */
+    inline void finish()
+    {
+        if (m_window.size() > 1)
+        {
+            simplify_window(true);
+        }
+        m_window.clear();
+    }
+
+    /*!
+    \brief Returns the output iterator, after the points written until now
+    */
+    inline OutputIterator output() const
+    {
+        return m_out;
+    }
+
+private :
+
+    // Writes the points kept in the window which are final, the window
+    // continues with the last of them, which is written already
+    inline void simplify_window(bool last)
+    {
+        // The kept points are written in the loop below, the buffer tells
+        // which points of the window are kept
+        strategy_type::apply(m_window,
+                             detail::simplify::discarding_output_iterator(),
+                             m_max_distance, m_buffer);
+
+        std::size_t const count = m_window.size();
+
+        // The last point is only kept at the end of the sequence, or if
+        // too many points would remain in the window
+        std::size_t next = 0;
+        for (std::size_t i = 1; i + 1 < count; i++)
+        {
+            if (m_buffer.is_included(i))
+            {
+                *m_out++ = m_window[i];
+                next = i;
+            }
+        }
+        if (last || count - next > m_window_size / 2)
+        {
+            *m_out++ = m_window.back();
+            next = count - 1;
+        }
+
+        m_window.erase(m_window.begin(), m_window.begin() + next);
+    }
+
+    OutputIterator m_out;
+    distance_type m_max_distance;
+    std::size_t m_window_size;
+
+    std::vector<Point> m_window;
+    typename strategy_type::buffer_type m_buffer;
+};
+
+
+}} // namespace boost::geometry
+
+
+#endif // BOOST_GEOMETRY_ALGORITHMS_SIMPLIFY_STREAM_HPP
@@ -54,6 +54,7 @@
 #include <boost/geometry/algorithms/buffer.hpp>
 #include <boost/geometry/algorithms/centroid.hpp>
 #include <boost/geometry/algorithms/clear.hpp>
+#include <boost/geometry/algorithms/clip_to_grid.hpp>
 #include <boost/geometry/algorithms/comparable_distance.hpp>
 #include <boost/geometry/algorithms/convert.hpp>
 #include <boost/geometry/algorithms/convex_hull.hpp>
@@ -67,6 +68,7 @@
 #include <boost/geometry/algorithms/equals.hpp>
 #include <boost/geometry/algorithms/expand.hpp>
 #include <boost/geometry/algorithms/for_each.hpp>
+#include <boost/geometry/algorithms/incremental_convex_hull.hpp>
 #include <boost/geometry/algorithms/intersection.hpp>
 #include <boost/geometry/algorithms/intersects.hpp>
 #include <boost/geometry/algorithms/is_simple.hpp>
@@ -82,6 +84,8 @@
 #include <boost/geometry/algorithms/remove_spikes.hpp>
 #include <boost/geometry/algorithms/reverse.hpp>
 #include <boost/geometry/algorithms/simplify.hpp>
+#include <boost/geometry/algorithms/simplify_preserving_topology.hpp>
+#include <boost/geometry/algorithms/simplify_stream.hpp>
 #include <boost/geometry/algorithms/sym_difference.hpp>
 #include <boost/geometry/algorithms/touches.hpp>
 #include <boost/geometry/algorithms/transform.hpp>
@@ -105,12 +109,15 @@
 #include <boost/geometry/views/closeable_view.hpp>
 #include <boost/geometry/views/identity_view.hpp>
 #include <boost/geometry/views/reversible_view.hpp>
+#include <boost/geometry/views/sectioned.hpp>
 #include <boost/geometry/views/segment_view.hpp>
 
 #include <boost/geometry/io/io.hpp>
 #include <boost/geometry/io/dsv/write.hpp>
 #include <boost/geometry/io/svg/svg_mapper.hpp>
 #include <boost/geometry/io/svg/write_svg.hpp>
+#include <boost/geometry/io/wkb/read.hpp>
+#include <boost/geometry/io/wkb/write.hpp>
 #include <boost/geometry/io/wkt/read.hpp>
 #include <boost/geometry/io/wkt/write.hpp>
 
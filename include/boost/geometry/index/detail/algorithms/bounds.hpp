@@ -2,7 +2,7 @@
 //
 // n-dimensional bounds
 //
-// Copyright (c) 2011-2014 Adam Wulkiewicz, Lodz, Poland.
+// Copyright (c) 2011-2015 Adam Wulkiewicz, Lodz, Poland.
 //
 // Use, modification and distribution is subject to the Boost Software License,
 // Version 1.0. (See accompanying file LICENSE_1_0.txt or copy at
@@ -11,6 +11,17 @@
 #ifndef BOOST_GEOMETRY_INDEX_DETAIL_ALGORITHMS_BOUNDS_HPP
 #define BOOST_GEOMETRY_INDEX_DETAIL_ALGORITHMS_BOUNDS_HPP
 
+#include <limits>
+
+#include <boost/math/special_functions/next.hpp>
+#include <boost/mpl/bool.hpp>
+#include <boost/type_traits/is_floating_point.hpp>
+#include <boost/type_traits/is_same.hpp>
+
+#include <boost/geometry/algorithms/assign.hpp>
+#include <boost/geometry/algorithms/expand.hpp>
+#include <boost/geometry/util/select_most_precise.hpp>
+
 #include <boost/geometry/index/detail/bounded_view.hpp>
 
 namespace boost { namespace geometry { namespace index { namespace detail {
@@ -39,13 +50,141 @@ struct bounds<Geometry, Bounds, segment_tag, box_tag>
     }
 };
 
+// Bounds storing coordinates less precise than the coordinates of a Geometry
+// may be shrunk by rounding to nearest. Move such coordinates outwards
+// so the Bounds always contain the Geometry.
+
+template <typename Bounds, typename Geometry,
+          typename BoundsCoord = typename coordinate_type<Bounds>::type,
+          bool IsExact = ! boost::is_floating_point<BoundsCoord>::value
+                      || boost::is_same
+                            <
+                                typename select_most_precise
+                                    <
+                                        BoundsCoord,
+                                        typename coordinate_type<Geometry>::type
+                                    >::type,
+                                BoundsCoord
+                            >::value
+>
+struct is_exact_bounds
+    : boost::mpl::bool_<IsExact>
+{};
+
+// Coordinates of a Geometry beyond the range of the less precise type are
+// moved outwards to infinities and inwards to the greatest finite values.
+
+template <typename T>
+inline T prior_value(T const& v)
+{
+    if ( v <= -(std::numeric_limits<T>::max)() )
+        return -std::numeric_limits<T>::infinity();
+    return boost::math::float_prior(v);
+}
+
+template <typename T>
+inline T next_value(T const& v)
+{
+    if ( v >= (std::numeric_limits<T>::max)() )
+        return std::numeric_limits<T>::infinity();
+    return boost::math::float_next(v);
+}
+
+template <typename Bounds, typename Geometry,
+          typename TagGeometry = typename geometry::tag<Geometry>::type,
+          std::size_t Dimension = geometry::dimension<Bounds>::value>
+struct round_outward_dimensions
+{
+    template <typename Coord>
+    static inline void round_min(Bounds & b, Coord const& min_coord)
+    {
+        if ( get<min_corner, Dimension - 1>(b) > min_coord )
+            set<min_corner, Dimension - 1>(b, prior_value(get<min_corner, Dimension - 1>(b)));
+    }
+
+    template <typename Coord>
+    static inline void round_max(Bounds & b, Coord const& max_coord)
+    {
+        if ( get<max_corner, Dimension - 1>(b) < max_coord )
+            set<max_corner, Dimension - 1>(b, next_value(get<max_corner, Dimension - 1>(b)));
+    }
+
+    static inline void apply(Bounds & b, Geometry const& g)
+    {
+        round_outward_dimensions<Bounds, Geometry, TagGeometry, Dimension - 1>::apply(b, g);
+        apply(b, g, TagGeometry());
+    }
+
+    static inline void apply(Bounds & b, Geometry const& g, point_tag)
+    {
+        round_min(b, get<Dimension - 1>(g));
+        round_max(b, get<Dimension - 1>(g));
+    }
+
+    static inline void apply(Bounds & b, Geometry const& g, box_tag)
+    {
+        round_min(b, get<min_corner, Dimension - 1>(g));
+        round_max(b, get<max_corner, Dimension - 1>(g));
+    }
+
+    static inline void apply(Bounds & b, Geometry const& g, segment_tag)
+    {
+        bool const less = get<0, Dimension - 1>(g) < get<1, Dimension - 1>(g);
+        round_min(b, less ? get<0, Dimension - 1>(g) : get<1, Dimension - 1>(g));
+        round_max(b, less ? get<1, Dimension - 1>(g) : get<0, Dimension - 1>(g));
+    }
+};
+
+template <typename Bounds, typename Geometry, typename TagGeometry>
+struct round_outward_dimensions<Bounds, Geometry, TagGeometry, 0>
+{
+    static inline void apply(Bounds &, Geometry const&) {}
+};
+
+template <typename Bounds, typename Geometry,
+          bool IsExact = is_exact_bounds<Bounds, Geometry>::value>
+struct round_outward
+{
+    static inline void apply(Bounds &, Geometry const&) {}
+
+    static inline void bounds(Geometry const& g, Bounds & b)
+    {
+        dispatch::bounds<Geometry, Bounds>::apply(g, b);
+    }
+};
+
+template <typename Bounds, typename Geometry>
+struct round_outward<Bounds, Geometry, false>
+    : round_outward_dimensions<Bounds, Geometry>
+{
+    // geometry::convert() throws for coordinates beyond the range of Bounds,
+    // expanding the inverse Bounds clamps them to the greatest finite values
+    static inline void bounds(Geometry const& g, Bounds & b)
+    {
+        geometry::assign_inverse(b);
+        geometry::expand(b, g);
+        round_outward_dimensions<Bounds, Geometry>::apply(b, g);
+    }
+};
+
 } // namespace dispatch
 
+// Calculates Bounds containing Geometry.
 template <typename Geometry, typename Bounds>
 inline void bounds(Geometry const& g, Bounds & b)
 {
     concept::check_concepts_and_equal_dimensions<Geometry const, Bounds>();
-    dispatch::bounds<Geometry, Bounds>::apply(g, b);
+    dispatch::round_outward<Bounds, Geometry>::bounds(g, b);
+}
+
+// Expands Bounds to contain Geometry.
+// Unlike geometry::expand() the result contains Geometry also if
+// the coordinates of Bounds are less precise than the coordinates of Geometry.
+template <typename Bounds, typename Geometry>
+inline void expand(Bounds & b, Geometry const& g)
+{
+    geometry::expand(b, g);
+    dispatch::round_outward<Bounds, Geometry>::apply(b, g);
 }
 
 namespace dispatch {
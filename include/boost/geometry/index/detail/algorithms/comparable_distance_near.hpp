@@ -1,8 +1,8 @@
 // Boost.Geometry Index
 //
-// squared distance between point and nearest point of the box or point
+// comparable distance between point and nearest point of the box or point
 //
-// Copyright (c) 2011-2014 Adam Wulkiewicz, Lodz, Poland.
+// Copyright (c) 2011-2015 Adam Wulkiewicz, Lodz, Poland.
 //
 // Use, modification and distribution is subject to the Boost Software License,
 // Version 1.0. (See accompanying file LICENSE_1_0.txt or copy at
@@ -11,6 +11,16 @@
 #ifndef BOOST_GEOMETRY_INDEX_DETAIL_ALGORITHMS_COMPARABLE_DISTANCE_NEAR_HPP
 #define BOOST_GEOMETRY_INDEX_DETAIL_ALGORITHMS_COMPARABLE_DISTANCE_NEAR_HPP
 
+#include <algorithm>
+#include <cmath>
+
+#include <boost/geometry/core/cs.hpp>
+#include <boost/geometry/core/radian_access.hpp>
+#include <boost/geometry/core/radius.hpp>
+#include <boost/geometry/strategies/distance.hpp>
+#include <boost/geometry/util/math.hpp>
+#include <boost/geometry/views/detail/indexed_point_view.hpp>
+
 #include <boost/geometry/index/detail/algorithms/sum_for_indexable.hpp>
 
 namespace boost { namespace geometry { namespace index { namespace detail {
@@ -59,17 +69,172 @@ struct sum_for_indexable_dimension<Point, BoxIndexable, box_tag, comparable_dist
     }
 };
 
+// The haversine of the angle between a point and the nearest point of a box
+// defined by the ranges of longitudes and latitudes. If the point is outside
+// the range of longitudes the nearest point lies on one of the meridian
+// edges of the box, otherwise on the meridian of the point.
+// The result is consistent with the comparable haversine distance of points.
+template <typename CalcT>
+struct spherical_box_haversine
+{
+    template <typename Point, typename Box>
+    static inline CalcT apply(Point const& pt, Box const& b)
+    {
+        CalcT const two_pi = CalcT(2) * geometry::math::pi<CalcT>();
+
+        geometry::detail::indexed_point_view<Box const, min_corner> const min_pt(b);
+        geometry::detail::indexed_point_view<Box const, max_corner> const max_pt(b);
+
+        CalcT const lon = get_as_radian<0>(pt);
+        CalcT const lat = get_as_radian<1>(pt);
+        CalcT const lon_min = get_as_radian<0>(min_pt);
+        CalcT const lat_min = get_as_radian<1>(min_pt);
+        CalcT const lon_max = get_as_radian<0>(max_pt);
+        CalcT const lat_max = get_as_radian<1>(max_pt);
+
+        // the longitude of the point relative to the western edge in [0, 2pi)
+        CalcT lon_diff = std::fmod(lon - lon_min, two_pi);
+        if ( lon_diff < 0 )
+            lon_diff += two_pi;
+
+        if ( lon_diff <= lon_max - lon_min )
+        {
+            if ( lat < lat_min )
+                return geometry::math::hav(lat_min - lat);
+            else if ( lat_max < lat )
+                return geometry::math::hav(lat - lat_max);
+            return 0;
+        }
+
+        return (std::min)(meridian(lat, lon - lon_min, lat_min, lat_max),
+                          meridian(lat, lon - lon_max, lat_min, lat_max));
+    }
+
+private:
+    // the distance to the part of a meridian between lat_min and lat_max
+    static inline CalcT meridian(CalcT const& lat, CalcT const& lon_diff,
+                                 CalcT const& lat_min, CalcT const& lat_max)
+    {
+        CalcT const cos_lat = std::cos(lat);
+        CalcT const hav_lon_diff = geometry::math::hav(lon_diff);
+
+        CalcT result = (std::min)(at(lat, cos_lat, hav_lon_diff, lat_min),
+                                  at(lat, cos_lat, hav_lon_diff, lat_max));
+
+        // the nearest point of the whole meridian, outside [-pi/2, pi/2]
+        // if the point is on the other side of the globe
+        CalcT const lat_nearest = std::atan2(std::sin(lat), cos_lat * std::cos(lon_diff));
+        if ( lat_min < lat_nearest && lat_nearest < lat_max )
+            result = (std::min)(result, at(lat, cos_lat, hav_lon_diff, lat_nearest));
+
+        return result;
+    }
+
+    static inline CalcT at(CalcT const& lat, CalcT const& cos_lat,
+                           CalcT const& hav_lon_diff, CalcT const& lat_m)
+    {
+        return geometry::math::hav(lat_m - lat)
+             + std::cos(lat_m) * cos_lat * hav_lon_diff;
+    }
+};
+
+namespace dispatch {
+
+template <typename Point, typename Indexable,
+          typename IndexableTag = typename tag<Indexable>::type,
+          typename CSTag = typename cs_tag<Indexable>::type>
+struct comparable_distance_near
+{
+    typedef typename geometry::default_comparable_distance_result<Point, Indexable>::type result_type;
+
+    static inline result_type apply(Point const& pt, Indexable const& i)
+    {
+        return geometry::comparable_distance(pt, i);
+    }
+};
+
 template <typename Point, typename Indexable>
-typename geometry::default_comparable_distance_result<Point, Indexable>::type
-comparable_distance_near(Point const& pt, Indexable const& i)
+struct comparable_distance_near<Point, Indexable, box_tag, cartesian_tag>
 {
-    return detail::sum_for_indexable<
+    typedef detail::sum_for_indexable<
         Point,
         Indexable,
-        typename tag<Indexable>::type,
+        box_tag,
         detail::comparable_distance_near_tag,
         dimension<Indexable>::value
-    >::apply(pt, i);
+    > sum_for_indexable_type;
+
+    typedef typename sum_for_indexable_type::result_type result_type;
+
+    static inline result_type apply(Point const& pt, Indexable const& i)
+    {
+        return sum_for_indexable_type::apply(pt, i);
+    }
+};
+
+// The box is defined by the ranges of longitudes and latitudes.
+// The result is the exact distance expressed as the comparable
+// haversine distance of points.
+template <typename Point, typename Indexable>
+struct comparable_distance_near<Point, Indexable, box_tag, spherical_equatorial_tag>
+{
+    typedef typename geometry::point_type<Indexable>::type indexable_point_type;
+    typedef typename geometry::default_comparable_distance_result<
+        Point, indexable_point_type
+    >::type result_type;
+
+    static inline result_type apply(Point const& pt, Indexable const& i)
+    {
+        return spherical_box_haversine<result_type>::apply(pt, i);
+    }
+};
+
+// The box is defined by the ranges of longitudes and geodetic latitudes.
+// The result is the lower bound of the length of the geodesic on the spheroid
+// of the default strategy, expressed as the comparable distance of points.
+// On the spheroid ds >= b^2/a * ds' where ds' is the element of the length
+// on the unit sphere with the same coordinates. The additional factor
+// b/a = 1 - f covers the error of the approximate formulae, e.g. Andoyer's.
+template <typename Point, typename Indexable>
+struct comparable_distance_near<Point, Indexable, box_tag, geographic_tag>
+{
+    typedef typename geometry::point_type<Indexable>::type indexable_point_type;
+    typedef typename strategy::distance::services::default_strategy<
+        point_tag, point_tag, Point, indexable_point_type
+    >::type strategy_type;
+    typedef typename strategy::distance::services::comparable_type<
+        strategy_type
+    >::type comparable_strategy_type;
+    typedef typename geometry::default_comparable_distance_result<
+        Point, indexable_point_type
+    >::type result_type;
+
+    static inline result_type apply(Point const& pt, Indexable const& i)
+    {
+        result_type const hav = spherical_box_haversine<result_type>::apply(pt, i);
+        result_type const angle = result_type(2) * std::asin(std::sqrt(hav));
+
+        strategy_type const strategy;
+        result_type const a = get_radius<0>(strategy.model());
+        result_type const b = get_radius<2>(strategy.model());
+        result_type const distance = angle * b * b * b / (a * a);
+
+        return strategy::distance::services::result_from_distance<
+            comparable_strategy_type, Point, indexable_point_type
+        >::apply(strategy::distance::services::get_comparable<strategy_type>::apply(strategy), distance);
+    }
+};
+
+} // namespace dispatch
+
+// The comparable distance between a point and the nearest point of an Indexable.
+// For boxes it's the lower bound of the distances of geometries contained in the box
+// expressed in the same units as the comparable distance of points.
+template <typename Point, typename Indexable>
+inline typename dispatch::comparable_distance_near<Point, Indexable>::result_type
+comparable_distance_near(Point const& pt, Indexable const& i)
+{
+    return dispatch::comparable_distance_near<Point, Indexable>::apply(pt, i);
 }
 
 }}}} // namespace boost::geometry::index::detail
@@ -125,8 +125,61 @@ struct segment_intersection<Indexable, Point, box_tag>
     }
 };
 
+// The slab test of the box and the segment defined by the origin and the inverted direction,
+// calculated once for a segment tested against many boxes
+
+template <typename Box, size_t I, size_t Dimension>
+struct box_ray_intersection
+{
+    template <typename RelativeDistance>
+    static inline bool apply(Box const& b, RelativeDistance const* origin, RelativeDistance const* inv_dir,
+                             RelativeDistance & t_near, RelativeDistance & t_far)
+    {
+        RelativeDistance tn = ( RelativeDistance(geometry::get<min_corner, I>(b)) - origin[I] ) * inv_dir[I];
+        RelativeDistance tf = ( RelativeDistance(geometry::get<max_corner, I>(b)) - origin[I] ) * inv_dir[I];
+        if ( tf < tn )
+            ::std::swap(tn, tf);
+
+        if ( t_near < tn )
+            t_near = tn;
+        if ( tf < t_far )
+            t_far = tf;
+
+        return 0 <= t_far && t_near <= t_far
+            && box_ray_intersection<Box, I + 1, Dimension>::apply(b, origin, inv_dir, t_near, t_far);
+    }
+};
+
+template <typename Box, size_t Dimension>
+struct box_ray_intersection<Box, Dimension, Dimension>
+{
+    template <typename RelativeDistance>
+    static inline bool apply(Box const& , RelativeDistance const* , RelativeDistance const* ,
+                             RelativeDistance & , RelativeDistance & )
+    {
+        return true;
+    }
+};
+
 } // namespace dispatch
 
+template <typename Box, typename RelativeDistance> inline
+bool box_ray_intersection(Box const& b,
+                          RelativeDistance const* origin,
+                          RelativeDistance const* inv_dir,
+                          RelativeDistance & relative_distance)
+{
+    static const bool check = !::boost::is_integral<RelativeDistance>::value;
+    BOOST_MPL_ASSERT_MSG(check, RELATIVE_DISTANCE_MUST_BE_FLOATING_POINT_TYPE, (RelativeDistance));
+
+    RelativeDistance t_near = -(::std::numeric_limits<RelativeDistance>::max)();
+    RelativeDistance t_far = (::std::numeric_limits<RelativeDistance>::max)();
+
+    return dispatch::box_ray_intersection<Box, 0, dimension<Box>::value>::apply(b, origin, inv_dir, t_near, t_far)
+        && (t_near <= 1)
+        && ( relative_distance = 0 < t_near ? t_near : 0, true );
+}
+
 template <typename Indexable, typename Point, typename RelativeDistance> inline
 bool segment_intersection(Indexable const& b,
                           Point const& p0,
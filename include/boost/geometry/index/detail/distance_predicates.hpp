@@ -108,11 +108,13 @@ struct calculate_distance< nearest<PointRelation>, Indexable, Tag >
 {
     typedef detail::relation<PointRelation> relation;
     typedef typename relation::value_type point_type;
-    typedef typename geometry::default_comparable_distance_result<point_type, Indexable>::type result_type;
+    typedef typename index::detail::dispatch::comparable_distance_near<
+        point_type, Indexable
+    >::result_type result_type;
 
     static inline bool apply(nearest<PointRelation> const& p, Indexable const& i, result_type & result)
     {
-        result = geometry::comparable_distance(relation::value(p.point_or_relation), i);
+        result = index::detail::comparable_distance_near(relation::value(p.point_or_relation), i);
         return true;
     }
 };
@@ -143,6 +145,54 @@ struct calculate_distance< nearest< to_furthest<Point> >, Indexable, value_tag>
     }
 };
 
+// Converts the distance passed by the user into the comparable distance
+// of the same kind as the one returned by comparable_distance_near(),
+// i.e. the comparable distance of points
+template <typename Geometry, typename Indexable>
+struct comparable_distance_from_distance
+{
+    typedef typename geometry::point_type<Geometry>::type point_type;
+    typedef typename geometry::point_type<Indexable>::type indexable_point_type;
+
+    typedef typename geometry::detail::distance::default_strategy<
+        point_type, indexable_point_type
+    >::type strategy_type;
+    typedef typename strategy::distance::services::comparable_type<
+        strategy_type
+    >::type comparable_strategy_type;
+    typedef typename geometry::default_comparable_distance_result<
+        point_type, indexable_point_type
+    >::type result_type;
+
+    template <typename Distance>
+    static inline result_type apply(Distance const& d)
+    {
+        return strategy::distance::services::result_from_distance<
+            comparable_strategy_type,
+            point_type,
+            indexable_point_type
+        >::apply(comparable_strategy_type(), d);
+    }
+};
+
+// nearest() with the maximum distance, Values and nodes further than
+// max_distance are rejected so the branches are pruned from the start
+template <typename PointRelation, typename Distance, typename Indexable, typename Tag>
+struct calculate_distance< bounded_nearest<PointRelation, Distance>, Indexable, Tag >
+{
+    typedef calculate_distance< nearest<PointRelation>, Indexable, Tag > nearest_calculate;
+    typedef typename nearest_calculate::point_type point_type;
+    typedef typename nearest_calculate::result_type result_type;
+
+    static inline bool apply(bounded_nearest<PointRelation, Distance> const& p, Indexable const& i, result_type & result)
+    {
+        if ( !nearest_calculate::apply(p, i, result) )
+            return false;
+
+        return !( comparable_distance_from_distance<point_type, Indexable>::apply(p.max_distance) < result );
+    }
+};
+
 template <typename SegmentOrLinestring, typename Indexable, typename Tag>
 struct calculate_distance< path<SegmentOrLinestring>, Indexable, Tag>
 {
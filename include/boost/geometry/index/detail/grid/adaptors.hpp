@@ -0,0 +1,53 @@
+// Boost.Geometry Index
+//
+// Grid queries range adaptors
+//
+// Copyright (c) 2026 agent.
+//
+// Use, modification and distribution is subject to the Boost Software License,
+// Version 1.0. (See accompanying file LICENSE_1_0.txt or copy at
+// http://www.boost.org/LICENSE_1_0.txt)
+
+#ifndef BOOST_GEOMETRY_INDEX_DETAIL_GRID_ADAPTORS_HPP
+#define BOOST_GEOMETRY_INDEX_DETAIL_GRID_ADAPTORS_HPP
+
+#include <vector>
+
+#include <boost/geometry/index/adaptors/query.hpp>
+
+namespace boost { namespace geometry { namespace index {
+
+template <typename Value, typename IndexableGetter, typename EqualTo, typename Allocator>
+class grid;
+
+namespace adaptors { namespace detail {
+
+template <typename Value, typename IndexableGetter, typename EqualTo, typename Allocator>
+class query_range< index::grid<Value, IndexableGetter, EqualTo, Allocator> >
+{
+public:
+    typedef std::vector<Value> result_type;
+    typedef typename result_type::iterator iterator;
+    typedef typename result_type::const_iterator const_iterator;
+
+    template <typename Predicates> inline
+    query_range(index::grid<Value, IndexableGetter, EqualTo, Allocator> const& grid,
+                Predicates const& pred)
+    {
+        grid.query(pred, std::back_inserter(m_result));
+    }
+
+    inline iterator begin() { return m_result.begin(); }
+    inline iterator end() { return m_result.end(); }
+    inline const_iterator begin() const { return m_result.begin(); }
+    inline const_iterator end() const { return m_result.end(); }
+
+private:
+    result_type m_result;
+};
+
+}} // namespace adaptors::detail
+
+}}} // namespace boost::geometry::index
+
+#endif // BOOST_GEOMETRY_INDEX_DETAIL_GRID_ADAPTORS_HPP
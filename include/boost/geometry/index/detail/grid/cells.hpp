@@ -0,0 +1,256 @@
+// Boost.Geometry Index
+//
+// Grid cells storing values and the pyramid of cells bounds
+//
+// Copyright (c) 2026 agent.
+//
+// Use, modification and distribution is subject to the Boost Software License,
+// Version 1.0. (See accompanying file LICENSE_1_0.txt or copy at
+// http://www.boost.org/LICENSE_1_0.txt)
+
+#ifndef BOOST_GEOMETRY_INDEX_DETAIL_GRID_CELLS_HPP
+#define BOOST_GEOMETRY_INDEX_DETAIL_GRID_CELLS_HPP
+
+#include <boost/container/vector.hpp>
+#include <boost/move/move.hpp>
+#include <boost/mpl/bool.hpp>
+#include <boost/swap.hpp>
+
+#include <boost/geometry/algorithms/assign.hpp>
+#include <boost/geometry/algorithms/expand.hpp>
+#include <boost/geometry/core/access.hpp>
+
+#include <boost/geometry/index/detail/assert.hpp>
+#include <boost/geometry/index/detail/algorithms/bounds.hpp>
+
+namespace boost { namespace geometry { namespace index {
+
+namespace detail { namespace grid {
+
+// The uniform grid of 2^depth cells in each dimension. The values are stored
+// in the cells containing the centers of their bounds, the values outside the
+// domain are stored in the closest cells. Each cell stores the box of its values
+// so the values may be of any size. The coarser levels of the pyramid of cells
+// store the boxes and the numbers of values of 2^dimension finer cells,
+// so the queries may traverse the grid like a complete quadtree (or octree).
+//
+// The cells at level l are identified by the linear indexes
+// i_0 + i_1 * 2^l + i_2 * 2^(2l) + ...
+template <typename Value, typename Box, typename Allocator>
+class cells
+{
+public:
+    typedef typename Allocator::template rebind<Value>::other value_allocator_type;
+    typedef boost::container::vector<Value, value_allocator_type> values_type;
+
+    typedef std::size_t size_type;
+
+    static const std::size_t dimension = geometry::dimension<Box>::value;
+    static const size_type children_count = size_type(1) << dimension;
+
+private:
+    typedef typename Allocator::template rebind<values_type>::other values_allocator_type;
+    typedef boost::container::vector<values_type, values_allocator_type> leafs_type;
+    typedef typename Allocator::template rebind<Box>::other box_allocator_type;
+    typedef boost::container::vector<Box, box_allocator_type> boxes_type;
+    typedef typename Allocator::template rebind<size_type>::other size_allocator_type;
+    typedef boost::container::vector<size_type, size_allocator_type> counts_type;
+
+public:
+    inline cells(Box const& domain, size_type cells_per_dimension, Allocator const& allocator)
+        : m_domain(domain)
+        , m_depth(0)
+        , m_leafs(allocator)
+        , m_boxes(allocator)
+        , m_counts(allocator)
+    {
+        BOOST_GEOMETRY_INDEX_ASSERT(0 < cells_per_dimension, "the number of cells must be greater than 0");
+
+        while ( (size_type(1) << m_depth) < cells_per_dimension )
+            ++m_depth;
+
+        BOOST_GEOMETRY_INDEX_ASSERT(m_depth * dimension < sizeof(size_type) * 8, "too many cells");
+
+        size_type cells_count = 0;
+        for ( size_type l = 0 ; l <= m_depth ; ++l )
+        {
+            m_offsets[l] = cells_count;
+            cells_count += size_type(1) << (l * dimension);
+        }
+
+        Box empty;
+        geometry::assign_inverse(empty);
+        m_boxes.resize(cells_count, empty);                                                         // MAY THROW (A)
+        m_counts.resize(cells_count, 0);                                                            // MAY THROW (A)
+        m_leafs.resize(size_type(1) << (m_depth * dimension),
+                       values_type(value_allocator_type(allocator)));                               // MAY THROW (A)
+
+        init_scale<0>();
+    }
+
+    inline Box const& domain() const { return m_domain; }
+    inline size_type depth() const { return m_depth; }
+
+    inline Box const& box(size_type level, size_type i) const { return m_boxes[m_offsets[level] + i]; }
+    inline size_type count(size_type level, size_type i) const { return m_counts[m_offsets[level] + i]; }
+    inline values_type const& values(size_type i) const { return m_leafs[i]; }
+
+    // the linear index of the k-th child of the cell at level l
+    inline static size_type child(size_type level, size_type i, size_type k)
+    {
+        size_type const side = size_type(1) << level;
+        size_type result = 0;
+        for ( size_type d = 0 ; d < dimension ; ++d )
+        {
+            size_type const id = (i >> (level * d)) & (side - 1);
+            result |= ((id << 1) | ((k >> d) & 1)) << ((level + 1) * d);
+        }
+        return result;
+    }
+
+    // the linear index of the cell at level l containing the cell at the lowest level
+    inline size_type ancestor(size_type level, size_type i) const
+    {
+        size_type const side = size_type(1) << m_depth;
+        size_type const shift = m_depth - level;
+        size_type result = 0;
+        for ( size_type d = 0 ; d < dimension ; ++d )
+        {
+            size_type const id = (i >> (m_depth * d)) & (side - 1);
+            result |= (id >> shift) << (level * d);
+        }
+        return result;
+    }
+
+    // the linear index of the cell at the lowest level in which the value is stored
+    template <typename Indexable>
+    inline size_type leaf_index(Indexable const& indexable) const
+    {
+        Box b;
+        index::detail::bounds(indexable, b);
+        return leaf_index_impl<0>(b);
+    }
+
+    template <typename Indexable>
+    inline void insert(size_type i, Value const& value, Indexable const& indexable)
+    {
+        m_leafs[i].push_back(value);                                                                // MAY THROW (V, A)
+
+        for ( size_type l = 0 ; l <= m_depth ; ++l )
+        {
+            size_type const j = m_offsets[l] + ancestor(l, i);
+            index::detail::expand(m_boxes[j], indexable);
+            ++m_counts[j];
+        }
+    }
+
+    // removes the value at position pos in the cell i and recalculates the boxes of the cells
+    template <typename Translator>
+    inline void erase(size_type i, size_type pos, Translator const& translator)
+    {
+        values_type & values = m_leafs[i];
+        BOOST_GEOMETRY_INDEX_ASSERT(pos < values.size(), "invalid position");
+
+        if ( pos + 1 != values.size() )
+            values[pos] = boost::move(values.back());                                               // MAY THROW (V)
+        values.pop_back();
+
+        Box & leaf_box = m_boxes[m_offsets[m_depth] + i];
+        geometry::assign_inverse(leaf_box);
+        for ( typename values_type::const_iterator it = values.begin() ; it != values.end() ; ++it )
+            index::detail::expand(leaf_box, translator(*it));
+        --m_counts[m_offsets[m_depth] + i];
+
+        for ( size_type l = m_depth ; 0 < l ; --l )
+        {
+            size_type const parent = ancestor(l - 1, i);
+            Box & parent_box = m_boxes[m_offsets[l - 1] + parent];
+            geometry::assign_inverse(parent_box);
+            for ( size_type k = 0 ; k < children_count ; ++k )
+            {
+                size_type const c = child(l - 1, parent, k);
+                if ( 0 < count(l, c) )
+                    geometry::expand(parent_box, box(l, c));
+            }
+            --m_counts[m_offsets[l - 1] + parent];
+        }
+    }
+
+    inline void clear()
+    {
+        Box empty;
+        geometry::assign_inverse(empty);
+        for ( typename boxes_type::iterator it = m_boxes.begin() ; it != m_boxes.end() ; ++it )
+            *it = empty;
+        for ( typename counts_type::iterator it = m_counts.begin() ; it != m_counts.end() ; ++it )
+            *it = 0;
+        for ( typename leafs_type::iterator it = m_leafs.begin() ; it != m_leafs.end() ; ++it )
+            it->clear();
+    }
+
+    inline void swap(cells & other)
+    {
+        boost::swap(m_domain, other.m_domain);
+        boost::swap(m_depth, other.m_depth);
+        for ( size_type l = 0 ; l < max_depth + 1 ; ++l )
+            boost::swap(m_offsets[l], other.m_offsets[l]);
+        for ( std::size_t d = 0 ; d < dimension ; ++d )
+            boost::swap(m_scale[d], other.m_scale[d]);
+        m_leafs.swap(other.m_leafs);
+        m_boxes.swap(other.m_boxes);
+        m_counts.swap(other.m_counts);
+    }
+
+private:
+    template <std::size_t D>
+    inline void init_scale()
+    {
+        double const min = geometry::get<min_corner, D>(m_domain);
+        double const max = geometry::get<max_corner, D>(m_domain);
+        m_scale[D] = min < max ? double(size_type(1) << m_depth) / (max - min) : 0.0;
+        init_scale_next<D + 1>(boost::mpl::bool_<D + 1 < dimension>());
+    }
+
+    template <std::size_t D>
+    inline void init_scale_next(boost::mpl::bool_<true> const&) { init_scale<D>(); }
+    template <std::size_t D>
+    inline void init_scale_next(boost::mpl::bool_<false> const&) {}
+
+    template <std::size_t D, typename B>
+    inline size_type leaf_index_impl(B const& b) const
+    {
+        size_type const side = size_type(1) << m_depth;
+        double const center = ( double(geometry::get<min_corner, D>(b))
+                              + double(geometry::get<max_corner, D>(b)) ) / 2;
+        double const t = (center - double(geometry::get<min_corner, D>(m_domain))) * m_scale[D];
+
+        // also NaN is stored in the first cell
+        size_type const id = !(0 < t) ? 0 : ( side <= t ? side - 1 : size_type(t) );
+
+        return (id << (m_depth * D))
+             + leaf_index_next<D + 1>(b, boost::mpl::bool_<D + 1 < dimension>());
+    }
+
+    template <std::size_t D, typename B>
+    inline size_type leaf_index_next(B const& b, boost::mpl::bool_<true> const&) const { return leaf_index_impl<D>(b); }
+    template <std::size_t D, typename B>
+    inline size_type leaf_index_next(B const& , boost::mpl::bool_<false> const&) const { return 0; }
+
+    // the limit of the number of levels, the number of cells is limited by the size_type anyway
+    static const size_type max_depth = sizeof(size_type) * 8 / dimension;
+
+    Box m_domain;
+    size_type m_depth;
+    size_type m_offsets[max_depth + 1];
+    double m_scale[dimension];
+
+    leafs_type m_leafs;
+    boxes_type m_boxes;
+    counts_type m_counts;
+};
+
+}} // namespace detail::grid
+
+}}} // namespace boost::geometry::index
+
+#endif // BOOST_GEOMETRY_INDEX_DETAIL_GRID_CELLS_HPP
@@ -0,0 +1,380 @@
+// Boost.Geometry Index
+//
+// Grid query iterators
+//
+// Copyright (c) 2026 agent.
+//
+// Use, modification and distribution is subject to the Boost Software License,
+// Version 1.0. (See accompanying file LICENSE_1_0.txt or copy at
+// http://www.boost.org/LICENSE_1_0.txt)
+
+#ifndef BOOST_GEOMETRY_INDEX_DETAIL_GRID_QUERY_ITERATORS_HPP
+#define BOOST_GEOMETRY_INDEX_DETAIL_GRID_QUERY_ITERATORS_HPP
+
+#include <algorithm>
+#include <vector>
+
+#include <boost/geometry/index/detail/rtree/query_iterators.hpp>
+
+namespace boost { namespace geometry { namespace index { namespace detail { namespace grid {
+
+// the types required by the type-erased rtree query iterator
+template <typename Value, typename Allocator>
+struct query_iterator_types
+{
+    typedef typename Allocator::template rebind<Value>::other value_allocator_type;
+
+    typedef Value const& const_reference;
+    typedef typename value_allocator_type::difference_type difference_type;
+    typedef typename value_allocator_type::const_pointer const_pointer;
+};
+
+// Traverses the pyramid of cells depth-first, the cells which boxes don't meet
+// the predicates are skipped.
+template <typename Value, typename Translator, typename Cells, typename Predicates, typename Types>
+class spatial_query_iterator
+{
+    typedef typename Cells::values_type values_type;
+    typedef typename Cells::size_type size_type;
+    typedef std::pair<size_type, size_type> cell_type;
+
+    static const unsigned predicates_len = index::detail::predicates_length<Predicates>::value;
+
+public:
+    typedef std::input_iterator_tag iterator_category;
+    typedef Value value_type;
+    typedef typename Types::const_reference reference;
+    typedef typename Types::difference_type difference_type;
+    typedef typename Types::const_pointer pointer;
+
+    inline spatial_query_iterator(Translator const& t, Predicates const& p)
+        : m_cells(0), m_translator(::boost::addressof(t)), m_pred(p)
+        , m_values(0), m_current(0)
+    {}
+
+    inline spatial_query_iterator(Cells const& cells, Translator const& t, Predicates const& p)
+        : m_cells(::boost::addressof(cells)), m_translator(::boost::addressof(t)), m_pred(p)
+        , m_values(0), m_current(0)
+    {
+        if ( 0 < cells.count(0, 0) )
+            m_stack.push_back(cell_type(0, 0));
+
+        search_value();
+    }
+
+    reference operator*() const
+    {
+        BOOST_GEOMETRY_INDEX_ASSERT(m_values, "not dereferencable");
+        return (*m_values)[m_current];
+    }
+
+    const value_type * operator->() const
+    {
+        return ::boost::addressof(**this);
+    }
+
+    spatial_query_iterator & operator++()
+    {
+        ++m_current;
+        search_value();
+        return *this;
+    }
+
+    spatial_query_iterator operator++(int)
+    {
+        spatial_query_iterator temp = *this;
+        this->operator++();
+        return temp;
+    }
+
+    bool is_end() const
+    {
+        return 0 == m_values;
+    }
+
+    friend bool operator==(spatial_query_iterator const& l, spatial_query_iterator const& r)
+    {
+        return (l.m_values == r.m_values) && (0 == l.m_values || l.m_current == r.m_current);
+    }
+
+    friend bool operator==(spatial_query_iterator const& l, rtree::iterators::end_query_iterator<Value, Types> const& /*r*/)
+    {
+        return l.is_end();
+    }
+
+    friend bool operator==(rtree::iterators::end_query_iterator<Value, Types> const& /*l*/, spatial_query_iterator const& r)
+    {
+        return r.is_end();
+    }
+
+private:
+    void search_value()
+    {
+        for (;;)
+        {
+            // move to the next value in the current cell
+            if ( m_values )
+            {
+                if ( m_current < m_values->size() )
+                {
+                    Value const& v = (*m_values)[m_current];
+                    if ( index::detail::predicates_check<index::detail::value_tag, 0, predicates_len>(m_pred, v, (*m_translator)(v)) )
+                        return;
+
+                    ++m_current;
+                }
+                else
+                {
+                    m_values = 0;
+                }
+            }
+            // move to the next cell
+            else
+            {
+                if ( m_stack.empty() )
+                    return;
+
+                cell_type const c = m_stack.back();
+                m_stack.pop_back();
+
+                // 0 - dummy value
+                if ( !index::detail::predicates_check<index::detail::bounds_tag, 0, predicates_len>(m_pred, 0, m_cells->box(c.first, c.second)) )
+                    continue;
+
+                if ( c.first == m_cells->depth() )
+                {
+                    m_values = ::boost::addressof(m_cells->values(c.second));
+                    m_current = 0;
+                }
+                else
+                {
+                    for ( size_type k = Cells::children_count ; 0 < k ; --k )
+                    {
+                        size_type const child = Cells::child(c.first, c.second, k - 1);
+                        if ( 0 < m_cells->count(c.first + 1, child) )
+                            m_stack.push_back(cell_type(c.first + 1, child));
+                    }
+                }
+            }
+        }
+    }
+
+    Cells const* m_cells;
+    Translator const* m_translator;
+    Predicates m_pred;
+
+    std::vector<cell_type> m_stack;
+    values_type const* m_values;
+    size_type m_current;
+};
+
+// Traverses the pyramid of cells best-first. The priority queue stores both
+// the cells and the values so they're returned in the order of distances and
+// only the cells closer than the k-th value are visited.
+template <typename Value, typename Translator, typename Box, typename Cells, typename Predicates, unsigned DistancePredicateIndex, typename Types>
+class distance_query_iterator
+{
+    typedef typename Cells::values_type values_type;
+    typedef typename Cells::size_type size_type;
+
+    typedef index::detail::predicates_element<DistancePredicateIndex, Predicates> nearest_predicate_access;
+    typedef typename nearest_predicate_access::type nearest_predicate_type;
+    typedef typename index::detail::indexable_type<Translator>::type indexable_type;
+
+    typedef index::detail::calculate_distance<nearest_predicate_type, indexable_type, value_tag> calculate_value_distance;
+    typedef index::detail::calculate_distance<nearest_predicate_type, Box, bounds_tag> calculate_node_distance;
+    typedef typename calculate_node_distance::result_type distance_type;
+
+    static const unsigned predicates_len = index::detail::predicates_length<Predicates>::value;
+
+    struct entry
+    {
+        distance_type distance;
+        size_type level;
+        size_type index;
+        Value const* value;
+    };
+
+    // std heap is a max-heap, values are returned before cells of the same distance
+    struct entry_greater
+    {
+        bool operator()(entry const& l, entry const& r) const
+        {
+            return r.distance < l.distance
+                || ( !(l.distance < r.distance) && l.value == 0 && r.value != 0 );
+        }
+    };
+
+public:
+    typedef std::input_iterator_tag iterator_category;
+    typedef Value value_type;
+    typedef typename Types::const_reference reference;
+    typedef typename Types::difference_type difference_type;
+    typedef typename Types::const_pointer pointer;
+
+    inline distance_query_iterator(Translator const& t, Predicates const& p)
+        : m_cells(0), m_translator(::boost::addressof(t)), m_pred(p)
+        , m_current(0), m_found_count(0)
+    {}
+
+    inline distance_query_iterator(Cells const& cells, Translator const& t, Predicates const& p)
+        : m_cells(::boost::addressof(cells)), m_translator(::boost::addressof(t)), m_pred(p)
+        , m_current(0), m_found_count(0)
+    {
+        BOOST_GEOMETRY_INDEX_ASSERT(0 < max_count(), "k must be greather than 0");
+
+        if ( 0 < cells.count(0, 0) )
+            push_cell(0, 0);
+
+        increment();
+    }
+
+    reference operator*() const
+    {
+        BOOST_GEOMETRY_INDEX_ASSERT(m_current, "not dereferencable");
+        return *m_current;
+    }
+
+    const value_type * operator->() const
+    {
+        return m_current;
+    }
+
+    distance_query_iterator & operator++()
+    {
+        increment();
+        return *this;
+    }
+
+    distance_query_iterator operator++(int)
+    {
+        distance_query_iterator temp = *this;
+        this->operator++();
+        return temp;
+    }
+
+    bool is_end() const
+    {
+        return 0 == m_current;
+    }
+
+    friend bool operator==(distance_query_iterator const& l, distance_query_iterator const& r)
+    {
+        return l.m_current == r.m_current;
+    }
+
+    friend bool operator==(distance_query_iterator const& l, rtree::iterators::end_query_iterator<Value, Types> const& /*r*/)
+    {
+        return l.is_end();
+    }
+
+    friend bool operator==(rtree::iterators::end_query_iterator<Value, Types> const& /*l*/, distance_query_iterator const& r)
+    {
+        return r.is_end();
+    }
+
+private:
+    void increment()
+    {
+        m_current = 0;
+
+        if ( max_count() <= m_found_count )
+        {
+            m_queue.clear();
+            return;
+        }
+
+        while ( !m_queue.empty() )
+        {
+            std::pop_heap(m_queue.begin(), m_queue.end(), entry_greater());
+            entry const e = m_queue.back();
+            m_queue.pop_back();
+
+            if ( e.value )
+            {
+                m_current = e.value;
+                ++m_found_count;
+                return;
+            }
+
+            if ( e.level == m_cells->depth() )
+            {
+                values_type const& values = m_cells->values(e.index);
+                for ( typename values_type::const_iterator it = values.begin() ; it != values.end() ; ++it )
+                    push_value(*it);
+            }
+            else
+            {
+                for ( size_type k = 0 ; k < Cells::children_count ; ++k )
+                {
+                    size_type const child = Cells::child(e.level, e.index, k);
+                    if ( 0 < m_cells->count(e.level + 1, child) )
+                        push_cell(e.level + 1, child);
+                }
+            }
+        }
+    }
+
+    void push_cell(size_type level, size_type i)
+    {
+        Box const& box = m_cells->box(level, i);
+
+        // 0 - dummy value
+        if ( !index::detail::predicates_check<index::detail::bounds_tag, 0, predicates_len>(m_pred, 0, box) )
+            return;
+
+        entry e;
+        if ( !calculate_node_distance::apply(predicate(), box, e.distance) )
+            return;
+
+        e.level = level;
+        e.index = i;
+        e.value = 0;
+        push(e);
+    }
+
+    void push_value(Value const& v)
+    {
+        if ( !index::detail::predicates_check<index::detail::value_tag, 0, predicates_len>(m_pred, v, (*m_translator)(v)) )
+            return;
+
+        typename calculate_value_distance::result_type distance;
+        if ( !calculate_value_distance::apply(predicate(), (*m_translator)(v), distance) )
+            return;
+
+        entry e;
+        e.distance = distance;
+        e.level = 0;
+        e.index = 0;
+        e.value = ::boost::addressof(v);
+        push(e);
+    }
+
+    void push(entry const& e)
+    {
+        m_queue.push_back(e);
+        std::push_heap(m_queue.begin(), m_queue.end(), entry_greater());
+    }
+
+    nearest_predicate_type const& predicate() const
+    {
+        return nearest_predicate_access::get(m_pred);
+    }
+
+    inline unsigned max_count() const
+    {
+        return nearest_predicate_access::get(m_pred).count;
+    }
+
+    Cells const* m_cells;
+    Translator const* m_translator;
+    Predicates m_pred;
+
+    std::vector<entry> m_queue;
+    Value const* m_current;
+    size_type m_found_count;
+};
+
+}}}}} // namespace boost::geometry::index::detail::grid
+
+#endif // BOOST_GEOMETRY_INDEX_DETAIL_GRID_QUERY_ITERATORS_HPP
@@ -81,6 +81,17 @@ struct nearest
     unsigned count;
 };
 
+template <typename PointOrRelation, typename Distance>
+struct bounded_nearest
+    : nearest<PointOrRelation>
+{
+    bounded_nearest(PointOrRelation const& por, unsigned k, Distance const& d)
+        : nearest<PointOrRelation>(por, k)
+        , max_distance(d)
+    {}
+    Distance max_distance;
+};
+
 template <typename SegmentOrLinestring>
 struct path
 {
@@ -255,6 +266,16 @@ struct predicate_check<nearest<DistancePredicates>, value_tag>
     }
 };
 
+template <typename PointOrRelation, typename Distance>
+struct predicate_check<bounded_nearest<PointOrRelation, Distance>, value_tag>
+{
+    template <typename Value, typename Box>
+    static inline bool apply(bounded_nearest<PointOrRelation, Distance> const&, Value const&, Box const&)
+    {
+        return true;
+    }
+};
+
 template <typename Linestring>
 struct predicate_check<path<Linestring>, value_tag>
 {
@@ -447,6 +468,16 @@ struct predicate_check<nearest<DistancePredicates>, bounds_tag>
     }
 };
 
+template <typename PointOrRelation, typename Distance>
+struct predicate_check<bounded_nearest<PointOrRelation, Distance>, bounds_tag>
+{
+    template <typename Value, typename Box>
+    static inline bool apply(bounded_nearest<PointOrRelation, Distance> const&, Value const&, Box const&)
+    {
+        return true;
+    }
+};
+
 template <typename Linestring>
 struct predicate_check<path<Linestring>, bounds_tag>
 {
@@ -457,6 +488,152 @@ struct predicate_check<path<Linestring>, bounds_tag>
     }
 };
 
+// ------------------------------------------------------------------ //
+// predicates_check for covered bounds
+// ------------------------------------------------------------------ //
+
+// Returns true only if the predicate is passed by every Indexable covered
+// by the bounds. False negatives are allowed, in this case the node should
+// be traversed.
+
+template <typename Geometry, typename Tag = typename geometry::tag<Geometry>::type>
+struct bounds_covered_by
+{
+    template <typename Box>
+    static inline bool apply(Box const&, Geometry const&)
+    {
+        return false;
+    }
+};
+
+template <typename Geometry>
+struct bounds_covered_by<Geometry, box_tag>
+{
+    template <typename Box>
+    static inline bool apply(Box const& b, Geometry const& g)
+    {
+        return geometry::covered_by(b, g);
+    }
+};
+
+template <typename Fun, bool Negated>
+struct predicate_check<satisfies<Fun, Negated>, covered_bounds_tag>
+{
+    template <typename Value, typename Box>
+    static bool apply(satisfies<Fun, Negated> const&, Value const&, Box const&)
+    {
+        return false;
+    }
+};
+
+// spatial predicate - default
+template <typename Geometry, typename Tag, bool Negated>
+struct predicate_check<spatial_predicate<Geometry, Tag, Negated>, covered_bounds_tag>
+{
+    typedef spatial_predicate<Geometry, Tag, Negated> Pred;
+
+    template <typename Value, typename Box>
+    static inline bool apply(Pred const&, Value const&, Box const&)
+    {
+        return false;
+    }
+};
+
+// spatial predicate - covered_by
+template <typename Geometry>
+struct predicate_check<spatial_predicate<Geometry, covered_by_tag, false>, covered_bounds_tag>
+{
+    typedef spatial_predicate<Geometry, covered_by_tag, false> Pred;
+
+    template <typename Value, typename Box>
+    static inline bool apply(Pred const& p, Value const&, Box const& b)
+    {
+        return bounds_covered_by<Geometry>::apply(b, p.geometry);
+    }
+};
+
+// spatial predicate - intersects
+template <typename Geometry>
+struct predicate_check<spatial_predicate<Geometry, intersects_tag, false>, covered_bounds_tag>
+{
+    typedef spatial_predicate<Geometry, intersects_tag, false> Pred;
+
+    template <typename Value, typename Box>
+    static inline bool apply(Pred const& p, Value const&, Box const& b)
+    {
+        return bounds_covered_by<Geometry>::apply(b, p.geometry);
+    }
+};
+
+// ------------------------------------------------------------------ //
+// predicates_check for indexables and for values only
+// ------------------------------------------------------------------ //
+
+// Checking the predicates with indexable_tag and then value_only_tag is
+// equivalent to checking them with value_tag. The predicates of Indexables
+// may be checked first, without the Value, which is only needed by
+// satisfies().
+
+template <typename Fun, bool Negated>
+struct predicate_check<satisfies<Fun, Negated>, indexable_tag>
+{
+    template <typename Value, typename Indexable>
+    static inline bool apply(satisfies<Fun, Negated> const&, Value const&, Indexable const&)
+    {
+        return true;
+    }
+};
+
+template <typename Geometry, typename Tag, bool Negated>
+struct predicate_check<spatial_predicate<Geometry, Tag, Negated>, indexable_tag>
+    : predicate_check<spatial_predicate<Geometry, Tag, Negated>, value_tag>
+{};
+
+template <typename DistancePredicates>
+struct predicate_check<nearest<DistancePredicates>, indexable_tag>
+    : predicate_check<nearest<DistancePredicates>, value_tag>
+{};
+
+template <typename PointOrRelation, typename Distance>
+struct predicate_check<bounded_nearest<PointOrRelation, Distance>, indexable_tag>
+    : predicate_check<bounded_nearest<PointOrRelation, Distance>, value_tag>
+{};
+
+template <typename Linestring>
+struct predicate_check<path<Linestring>, indexable_tag>
+    : predicate_check<path<Linestring>, value_tag>
+{};
+
+template <typename Fun, bool Negated>
+struct predicate_check<satisfies<Fun, Negated>, value_only_tag>
+    : predicate_check<satisfies<Fun, Negated>, value_tag>
+{};
+
+template <typename Geometry, typename Tag, bool Negated>
+struct predicate_check<spatial_predicate<Geometry, Tag, Negated>, value_only_tag>
+{
+    template <typename Value, typename Indexable>
+    static inline bool apply(spatial_predicate<Geometry, Tag, Negated> const&, Value const&, Indexable const&)
+    {
+        return true;
+    }
+};
+
+template <typename DistancePredicates>
+struct predicate_check<nearest<DistancePredicates>, value_only_tag>
+    : predicate_check<nearest<DistancePredicates>, value_tag>
+{};
+
+template <typename PointOrRelation, typename Distance>
+struct predicate_check<bounded_nearest<PointOrRelation, Distance>, value_only_tag>
+    : predicate_check<bounded_nearest<PointOrRelation, Distance>, value_tag>
+{};
+
+template <typename Linestring>
+struct predicate_check<path<Linestring>, value_only_tag>
+    : predicate_check<path<Linestring>, value_tag>
+{};
+
 // ------------------------------------------------------------------ //
 // predicates_length
 // ------------------------------------------------------------------ //
@@ -702,12 +879,30 @@ struct predicates_is_distance< nearest<DistancePredicates> >
     static const unsigned value = 1;
 };
 
+template <typename PointOrRelation, typename Distance>
+struct predicates_is_distance< bounded_nearest<PointOrRelation, Distance> >
+{
+    static const unsigned value = 1;
+};
+
 template <typename Linestring>
 struct predicates_is_distance< path<Linestring> >
 {
     static const unsigned value = 1;
 };
 
+template <typename P>
+struct predicates_is_path
+{
+    static const bool value = false;
+};
+
+template <typename Linestring>
+struct predicates_is_path< path<Linestring> >
+{
+    static const bool value = true;
+};
+
 // predicates_count_nearest
 
 template <typename T>
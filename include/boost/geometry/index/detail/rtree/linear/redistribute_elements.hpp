@@ -379,13 +379,13 @@ struct redistribute_elements<Value, Options, Translator, Box, Allocators, linear
                     if ( elements1.size() + remaining <= parameters.get_min_elements() )
                     {
                         elements1.push_back(elem);                                                          // MAY THROW, STRONG (copy)
-                        geometry::expand(box1, indexable);
+                        index::detail::expand(box1, indexable);
                         content1 = index::detail::content(box1);
                     }
                     else if ( elements2.size() + remaining <= parameters.get_min_elements() )
                     {
                         elements2.push_back(elem);                                                          // MAY THROW, STRONG (alloc, copy)
-                        geometry::expand(box2, indexable);
+                        index::detail::expand(box2, indexable);
                         content2 = index::detail::content(box2);
                     }
                     // choose better node and insert element
@@ -394,8 +394,8 @@ struct redistribute_elements<Value, Options, Translator, Box, Allocators, linear
                         // calculate enlarged boxes and areas
                         Box enlarged_box1(box1);
                         Box enlarged_box2(box2);
-                        geometry::expand(enlarged_box1, indexable);
-                        geometry::expand(enlarged_box2, indexable);
+                        index::detail::expand(enlarged_box1, indexable);
+                        index::detail::expand(enlarged_box2, indexable);
                         content_type enlarged_content1 = index::detail::content(enlarged_box1);
                         content_type enlarged_content2 = index::detail::content(enlarged_box2);
 
@@ -0,0 +1,196 @@
+// Boost.Geometry Index
+//
+// R-tree nodes storing aggregates of values
+//
+// Copyright (c) 2026 agent.
+//
+// Use, modification and distribution is subject to the Boost Software License,
+// Version 1.0. (See accompanying file LICENSE_1_0.txt or copy at
+// http://www.boost.org/LICENSE_1_0.txt)
+
+#ifndef BOOST_GEOMETRY_INDEX_DETAIL_RTREE_NODE_AUGMENTED_HPP
+#define BOOST_GEOMETRY_INDEX_DETAIL_RTREE_NODE_AUGMENTED_HPP
+
+#include <boost/utility/addressof.hpp>
+
+namespace boost { namespace geometry { namespace index {
+
+namespace detail { namespace rtree {
+
+// nodes types
+// the same as non-augmented nodes + the aggregate of all values stored in the subtree
+
+template <typename Value, typename Parameters, typename Aggregator, typename Box, typename Allocators>
+struct variant_internal_node<Value, index::augmented<Parameters, Aggregator>, Box, Allocators, node_variant_static_tag>
+    : public variant_internal_node<Value, Parameters, Box, Allocators, node_variant_static_tag>
+{
+    typedef variant_internal_node<Value, Parameters, Box, Allocators, node_variant_static_tag> base_t;
+
+    template <typename Alloc>
+    inline variant_internal_node(Alloc const& al) : base_t(al), aggregate() {}
+
+    typename Aggregator::result_type aggregate;
+};
+
+template <typename Value, typename Parameters, typename Aggregator, typename Box, typename Allocators>
+struct variant_leaf<Value, index::augmented<Parameters, Aggregator>, Box, Allocators, node_variant_static_tag>
+    : public variant_leaf<Value, Parameters, Box, Allocators, node_variant_static_tag>
+{
+    typedef variant_leaf<Value, Parameters, Box, Allocators, node_variant_static_tag> base_t;
+
+    template <typename Alloc>
+    inline variant_leaf(Alloc const& al) : base_t(al), aggregate() {}
+
+    typename Aggregator::result_type aggregate;
+};
+
+template <typename Value, typename Parameters, typename Aggregator, typename Box, typename Allocators>
+struct variant_internal_node<Value, index::augmented<Parameters, Aggregator>, Box, Allocators, node_variant_dynamic_tag>
+    : public variant_internal_node<Value, Parameters, Box, Allocators, node_variant_dynamic_tag>
+{
+    typedef variant_internal_node<Value, Parameters, Box, Allocators, node_variant_dynamic_tag> base_t;
+
+    template <typename Alloc>
+    inline variant_internal_node(Alloc const& al) : base_t(al), aggregate() {}
+
+    typename Aggregator::result_type aggregate;
+};
+
+template <typename Value, typename Parameters, typename Aggregator, typename Box, typename Allocators>
+struct variant_leaf<Value, index::augmented<Parameters, Aggregator>, Box, Allocators, node_variant_dynamic_tag>
+    : public variant_leaf<Value, Parameters, Box, Allocators, node_variant_dynamic_tag>
+{
+    typedef variant_leaf<Value, Parameters, Box, Allocators, node_variant_dynamic_tag> base_t;
+
+    template <typename Alloc>
+    inline variant_leaf(Alloc const& al) : base_t(al), aggregate() {}
+
+    typename Aggregator::result_type aggregate;
+};
+
+template <typename Value, typename Parameters, typename Aggregator, typename Box, typename Allocators>
+struct variant_internal_node<Value, index::augmented<Parameters, Aggregator>, Box, Allocators, node_variant_static_soa_tag>
+    : public variant_internal_node<Value, Parameters, Box, Allocators, node_variant_static_soa_tag>
+{
+    typedef variant_internal_node<Value, Parameters, Box, Allocators, node_variant_static_soa_tag> base_t;
+
+    template <typename Alloc>
+    inline variant_internal_node(Alloc const& al) : base_t(al), aggregate() {}
+
+    typename Aggregator::result_type aggregate;
+};
+
+template <typename Value, typename Parameters, typename Aggregator, typename Box, typename Allocators>
+struct variant_leaf<Value, index::augmented<Parameters, Aggregator>, Box, Allocators, node_variant_static_soa_tag>
+    : public variant_leaf<Value, Parameters, Box, Allocators, node_variant_static_soa_tag>
+{
+    typedef variant_leaf<Value, Parameters, Box, Allocators, node_variant_static_soa_tag> base_t;
+
+    template <typename Alloc>
+    inline variant_leaf(Alloc const& al) : base_t(al), aggregate() {}
+
+    typename Aggregator::result_type aggregate;
+};
+
+// aggregate traits
+
+template <typename Parameters>
+struct aggregate_type
+{
+    typedef void type;
+};
+
+template <typename Parameters, typename Aggregator>
+struct aggregate_type< index::augmented<Parameters, Aggregator> >
+{
+    typedef typename Aggregator::result_type type;
+};
+
+// node's aggregate access
+
+template <typename Value, typename Options, typename Box, typename Allocators>
+struct node_aggregate
+    : public rtree::visitor<Value, typename Options::parameters_type, Box, Allocators, typename Options::node_tag, true>::type
+{
+    typedef typename rtree::internal_node<Value, typename Options::parameters_type, Box, Allocators, typename Options::node_tag>::type internal_node;
+    typedef typename rtree::leaf<Value, typename Options::parameters_type, Box, Allocators, typename Options::node_tag>::type leaf;
+
+    // result_type can't be used since it's the type returned by the visitor
+    typedef typename rtree::aggregate_type<typename Options::parameters_type>::type aggregate_type;
+
+    inline node_aggregate() : result(0) {}
+
+    inline void operator()(internal_node const& n) { result = boost::addressof(n.aggregate); }
+    inline void operator()(leaf const& n) { result = boost::addressof(n.aggregate); }
+
+    aggregate_type const* result;
+};
+
+// updates the aggregate of a node, does nothing for non-augmented parameters
+
+template <typename Value, typename Options, typename Box, typename Allocators,
+          typename Parameters = typename Options::parameters_type>
+struct update_aggregate
+{
+    template <typename Node>
+    static inline void apply(Node &, Parameters const&) {}
+
+    template <typename Node>
+    static inline void copy(Node const&, Node &) {}
+};
+
+template <typename Value, typename Options, typename Box, typename Allocators,
+          typename Parameters, typename Aggregator>
+struct update_aggregate<Value, Options, Box, Allocators, index::augmented<Parameters, Aggregator> >
+{
+    typedef index::augmented<Parameters, Aggregator> parameters_type;
+
+    typedef typename rtree::internal_node<Value, parameters_type, Box, Allocators, typename Options::node_tag>::type internal_node;
+    typedef typename rtree::leaf<Value, parameters_type, Box, Allocators, typename Options::node_tag>::type leaf;
+
+    typedef typename Aggregator::result_type result_type;
+
+    static inline void apply(internal_node & n, parameters_type const& parameters)
+    {
+        typedef typename rtree::elements_type<internal_node>::type elements_type;
+        elements_type const& elements = rtree::elements(n);
+
+        Aggregator const& aggregator = parameters.get_aggregator();
+        result_type result = aggregator.identity();
+        for ( typename elements_type::const_iterator it = elements.begin() ; it != elements.end() ; ++it )
+        {
+            node_aggregate<Value, Options, Box, Allocators> v;
+            rtree::apply_visitor(v, *it->second);
+            result = aggregator.combine(result, *v.result);
+        }
+
+        n.aggregate = result;
+    }
+
+    static inline void apply(leaf & n, parameters_type const& parameters)
+    {
+        typedef typename rtree::elements_type<leaf>::type elements_type;
+        elements_type const& elements = rtree::elements(n);
+
+        Aggregator const& aggregator = parameters.get_aggregator();
+        result_type result = aggregator.identity();
+        for ( typename elements_type::const_iterator it = elements.begin() ; it != elements.end() ; ++it )
+        {
+            result = aggregator.combine(result, aggregator.apply(*it));
+        }
+
+        n.aggregate = result;
+    }
+
+    template <typename Node>
+    static inline void copy(Node const& src, Node & dst)
+    {
+        dst.aggregate = src.aggregate;
+    }
+};
+
+}} // namespace detail::rtree
+
+}}} // namespace boost::geometry::index
+
+#endif // BOOST_GEOMETRY_INDEX_DETAIL_RTREE_NODE_AUGMENTED_HPP
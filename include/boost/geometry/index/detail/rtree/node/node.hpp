@@ -18,6 +18,7 @@
 #include <boost/geometry/index/detail/rtree/node/pairs.hpp>
 #include <boost/geometry/index/detail/rtree/node/auto_deallocator.hpp>
 #include <boost/geometry/index/detail/rtree/node/node_elements.hpp>
+#include <boost/geometry/index/detail/rtree/node/soa_elements.hpp>
 
 //#include <boost/geometry/index/detail/rtree/node/weak_visitor.hpp>
 //#include <boost/geometry/index/detail/rtree/node/weak_dynamic.hpp>
@@ -26,6 +27,8 @@
 #include <boost/geometry/index/detail/rtree/node/variant_visitor.hpp>
 #include <boost/geometry/index/detail/rtree/node/variant_dynamic.hpp>
 #include <boost/geometry/index/detail/rtree/node/variant_static.hpp>
+#include <boost/geometry/index/detail/rtree/node/variant_static_soa.hpp>
+#include <boost/geometry/index/detail/rtree/node/augmented.hpp>
 
 #include <boost/geometry/index/detail/rtree/node/node_auto_ptr.hpp>
 
@@ -56,7 +59,7 @@ inline Box elements_box(FwdIter first, FwdIter last, Translator const& tr)
     ++first;
 
     for ( ; first != last ; ++first )
-        geometry::expand(result, element_indexable(*first, tr));
+        index::detail::expand(result, element_indexable(*first, tr));
 
     return result;
 }
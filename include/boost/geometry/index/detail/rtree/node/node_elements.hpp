@@ -12,6 +12,8 @@
 #define BOOST_GEOMETRY_INDEX_DETAIL_RTREE_NODE_NODE_ELEMENTS_HPP
 
 #include <boost/container/vector.hpp>
+#include <boost/utility/addressof.hpp>
+
 #include <boost/geometry/index/detail/varray.hpp>
 #include <boost/geometry/index/detail/rtree/node/pairs.hpp>
 
@@ -74,6 +76,36 @@ elements(Node const& n)
     return n.elements;
 }
 
+// handle of an element stored in a leaf
+// used by algorithms keeping the elements found in leafs, valid until the leaf is modified
+
+template <typename Elements>
+struct element_handle
+{
+    typedef typename Elements::value_type value_type;
+    typedef value_type const* type;
+
+    static inline type make(Elements const& /*elements*/, typename Elements::const_iterator it)
+    {
+        return boost::addressof(*it);
+    }
+
+    static inline value_type const& get(type const& h)
+    {
+        return *h;
+    }
+};
+
+// separately stored indexables of leaf elements
+// true if the Indexables returned by the Translator are stored in a contiguous array,
+// queries may then check the predicates of Indexables without accessing the values
+
+template <typename Elements, typename Translator>
+struct separate_indexables
+{
+    static const bool value = false;
+};
+
 // elements derived type
 
 template <typename Elements, typename NewValue>
@@ -0,0 +1,373 @@
+// Boost.Geometry Index
+//
+// R-tree leafs elements stored as separate arrays of indexables and payloads
+//
+// Copyright (c) 2026 agent.
+//
+// Use, modification and distribution is subject to the Boost Software License,
+// Version 1.0. (See accompanying file LICENSE_1_0.txt or copy at
+// http://www.boost.org/LICENSE_1_0.txt)
+
+#ifndef BOOST_GEOMETRY_INDEX_DETAIL_RTREE_NODE_SOA_ELEMENTS_HPP
+#define BOOST_GEOMETRY_INDEX_DETAIL_RTREE_NODE_SOA_ELEMENTS_HPP
+
+#include <iterator>
+#include <new>
+#include <utility>
+
+#include <boost/iterator/iterator_facade.hpp>
+#include <boost/mpl/assert.hpp>
+#include <boost/type_traits/aligned_storage.hpp>
+#include <boost/type_traits/alignment_of.hpp>
+
+#include <boost/geometry/index/indexable.hpp>
+#include <boost/geometry/index/detail/assert.hpp>
+#include <boost/geometry/index/detail/translator.hpp>
+#include <boost/geometry/index/detail/varray.hpp>
+
+namespace boost { namespace geometry { namespace index {
+
+namespace detail { namespace rtree {
+
+// The container of at most Capacity std::pairs storing the first and second members
+// in two separate arrays. The elements can't be accessed by reference. Const access
+// returns copies, also through the iterators.
+// Non-const access returns proxies which may be assigned or converted to the values.
+// Since dereferencing doesn't return a reference to the element the iterators are
+// input iterators with random access traversal.
+
+template <typename Value, std::size_t Capacity>
+class soa_varray
+{
+    BOOST_MPL_ASSERT_MSG((false),
+                         VALUES_STORED_IN_SOA_LEAFS_MUST_BE_STD_PAIRS,
+                         (Value));
+};
+
+template <typename Container>
+class soa_reference
+{
+public:
+    typedef typename Container::value_type value_type;
+    typedef typename Container::size_type size_type;
+
+    inline soa_reference(Container & c, size_type i) : m_container(&c), m_index(i) {}
+
+    inline operator value_type() const
+    {
+        return static_cast<Container const&>(*m_container)[m_index];
+    }
+
+    inline soa_reference & operator=(value_type const& v)
+    {
+        m_container->set(m_index, v);                                                               // MAY THROW (copy)
+        return *this;
+    }
+
+    inline soa_reference & operator=(soa_reference const& r)
+    {
+        m_container->set(m_index, value_type(r));                                                   // MAY THROW (copy)
+        return *this;
+    }
+
+private:
+    Container * m_container;
+    size_type m_index;
+};
+
+template <typename Container>
+class soa_const_iterator
+    : public boost::iterator_facade<
+        soa_const_iterator<Container>,
+        typename Container::value_type const,
+        boost::random_access_traversal_tag,
+        typename Container::value_type,
+        typename Container::difference_type
+    >
+{
+public:
+    typedef typename Container::size_type size_type;
+    typedef typename Container::difference_type difference_type;
+
+    inline soa_const_iterator() : m_container(0), m_index(0) {}
+    inline soa_const_iterator(Container const& c, size_type i) : m_container(&c), m_index(i) {}
+
+    inline size_type index() const { return m_index; }
+
+private:
+    friend class boost::iterator_core_access;
+
+    inline typename Container::value_type dereference() const { return (*m_container)[m_index]; }
+    inline bool equal(soa_const_iterator const& o) const { return m_index == o.m_index; }
+    inline void increment() { ++m_index; }
+    inline void decrement() { --m_index; }
+    inline void advance(difference_type n) { m_index += n; }
+    inline difference_type distance_to(soa_const_iterator const& o) const { return difference_type(o.m_index) - difference_type(m_index); }
+
+    Container const* m_container;
+    size_type m_index;
+};
+
+template <typename Container>
+class soa_iterator
+    : public boost::iterator_facade<
+        soa_iterator<Container>,
+        typename Container::value_type,
+        boost::random_access_traversal_tag,
+        soa_reference<Container>,
+        typename Container::difference_type
+    >
+{
+public:
+    typedef typename Container::size_type size_type;
+    typedef typename Container::difference_type difference_type;
+
+    inline soa_iterator() : m_container(0), m_index(0) {}
+    inline soa_iterator(Container & c, size_type i) : m_container(&c), m_index(i) {}
+
+    inline operator soa_const_iterator<Container>() const
+    {
+        return soa_const_iterator<Container>(*m_container, m_index);
+    }
+
+    inline size_type index() const { return m_index; }
+
+private:
+    friend class boost::iterator_core_access;
+
+    inline soa_reference<Container> dereference() const { return soa_reference<Container>(*m_container, m_index); }
+    inline bool equal(soa_iterator const& o) const { return m_index == o.m_index; }
+    inline void increment() { ++m_index; }
+    inline void decrement() { --m_index; }
+    inline void advance(difference_type n) { m_index += n; }
+    inline difference_type distance_to(soa_iterator const& o) const { return difference_type(o.m_index) - difference_type(m_index); }
+
+    Container * m_container;
+    size_type m_index;
+};
+
+template <typename First, typename Second, std::size_t Capacity>
+class soa_varray<std::pair<First, Second>, Capacity>
+{
+public:
+    typedef std::pair<First, Second> value_type;
+    typedef First first_type;
+    typedef Second second_type;
+    typedef std::size_t size_type;
+    typedef std::ptrdiff_t difference_type;
+    typedef soa_reference<soa_varray> reference;
+    typedef value_type const_reference;
+    typedef soa_iterator<soa_varray> iterator;
+    typedef soa_const_iterator<soa_varray> const_iterator;
+
+    inline soa_varray() : m_size(0) {}
+
+    inline soa_varray(soa_varray const& other)
+        : m_size(0)
+    {
+        this->assign(other.begin(), other.end());                                                   // MAY THROW (copy)
+    }
+
+    template <typename Iterator>
+    inline soa_varray(Iterator first, Iterator last)
+        : m_size(0)
+    {
+        this->assign(first, last);                                                                  // MAY THROW (copy)
+    }
+
+    inline soa_varray & operator=(soa_varray const& other)
+    {
+        if ( this != &other )
+            this->assign(other.begin(), other.end());                                               // MAY THROW (copy)
+        return *this;
+    }
+
+    inline ~soa_varray()
+    {
+        this->clear();
+    }
+
+    inline size_type size() const { return m_size; }
+    inline bool empty() const { return 0 == m_size; }
+    inline static size_type capacity() { return Capacity; }
+    inline static size_type max_size() { return Capacity; }
+
+    inline void reserve(size_type count)
+    {
+        BOOST_GEOMETRY_INDEX_ASSERT(count <= Capacity, "size too big");
+        ::boost::ignore_unused_variable_warning(count);
+    }
+
+    inline void push_back(value_type const& value)
+    {
+        BOOST_GEOMETRY_INDEX_ASSERT(m_size < Capacity, "size too big");
+
+        new (this->firsts_ptr() + m_size) First(value.first);                                       // MAY THROW (copy)
+        BOOST_TRY
+        {
+            new (this->seconds_ptr() + m_size) Second(value.second);                                // MAY THROW (copy)
+        }
+        BOOST_CATCH(...)
+        {
+            (this->firsts_ptr() + m_size)->~First();
+            BOOST_RETHROW                                                                           // RETHROW
+        }
+        BOOST_CATCH_END
+
+        ++m_size;
+    }
+
+    inline void pop_back()
+    {
+        BOOST_GEOMETRY_INDEX_ASSERT(0 < m_size, "the container is empty");
+
+        --m_size;
+        (this->firsts_ptr() + m_size)->~First();
+        (this->seconds_ptr() + m_size)->~Second();
+    }
+
+    inline void clear()
+    {
+        while ( 0 < m_size )
+            this->pop_back();
+    }
+
+    template <typename Iterator>
+    inline void assign(Iterator first, Iterator last)
+    {
+        this->clear();
+        for ( ; first != last ; ++first )
+            this->push_back(*first);                                                                // MAY THROW (copy)
+    }
+
+    inline void set(size_type i, value_type const& value)
+    {
+        BOOST_GEOMETRY_INDEX_ASSERT(i < m_size, "index out of bounds");
+
+        this->firsts_ptr()[i] = value.first;                                                        // MAY THROW (copy)
+        this->seconds_ptr()[i] = value.second;                                                      // MAY THROW (copy)
+    }
+
+    inline value_type operator[](size_type i) const
+    {
+        BOOST_GEOMETRY_INDEX_ASSERT(i < m_size, "index out of bounds");
+        return value_type(this->firsts()[i], this->seconds()[i]);
+    }
+
+    inline reference operator[](size_type i)
+    {
+        BOOST_GEOMETRY_INDEX_ASSERT(i < m_size, "index out of bounds");
+        return reference(*this, i);
+    }
+
+    inline value_type front() const { return (*this)[0]; }
+    inline reference front() { return (*this)[0]; }
+    inline value_type back() const { return (*this)[m_size - 1]; }
+    inline reference back() { return (*this)[m_size - 1]; }
+
+    inline iterator begin() { return iterator(*this, 0); }
+    inline iterator end() { return iterator(*this, m_size); }
+    inline const_iterator begin() const { return const_iterator(*this, 0); }
+    inline const_iterator end() const { return const_iterator(*this, m_size); }
+    inline const_iterator cbegin() const { return const_iterator(*this, 0); }
+    inline const_iterator cend() const { return const_iterator(*this, m_size); }
+
+    // the contiguous arrays of the first and second members
+    inline First const* firsts() const { return static_cast<First const*>(m_firsts.address()); }
+    inline Second const* seconds() const { return static_cast<Second const*>(m_seconds.address()); }
+
+private:
+    inline First * firsts_ptr() { return static_cast<First*>(m_firsts.address()); }
+    inline Second * seconds_ptr() { return static_cast<Second*>(m_seconds.address()); }
+
+    boost::aligned_storage<sizeof(First[Capacity]), boost::alignment_of<First[Capacity]>::value> m_firsts;
+    boost::aligned_storage<sizeof(Second[Capacity]), boost::alignment_of<Second[Capacity]>::value> m_seconds;
+    size_type m_size;
+};
+
+// element's indexable getter
+// proxies are converted to values so the indexable is returned by value
+
+template <typename Container, typename Translator>
+typename indexable_type<Translator>::type
+element_indexable(soa_reference<Container> const& el, Translator const& tr)
+{
+    return tr(typename Container::value_type(el));
+}
+
+// handle of an element
+// stores the copy of the element and the address of the first member which identifies it
+
+template <typename First, typename Second>
+struct soa_element_handle
+{
+    std::pair<First, Second> value;
+    First const* id;
+};
+
+template <typename First, typename Second>
+inline bool operator==(soa_element_handle<First, Second> const& l, soa_element_handle<First, Second> const& r)
+{
+    return l.id == r.id;
+}
+
+template <typename First, typename Second, size_t N>
+struct element_handle< soa_varray<std::pair<First, Second>, N> >
+{
+    typedef soa_varray<std::pair<First, Second>, N> elements_type;
+    typedef std::pair<First, Second> value_type;
+    typedef soa_element_handle<First, Second> type;
+
+    static inline type make(elements_type const& elements, typename elements_type::const_iterator it)
+    {
+        type result = { *it, elements.firsts() + it.index() };
+        return result;
+    }
+
+    static inline value_type const& get(type const& h)
+    {
+        return h.value;
+    }
+};
+
+// moving of an element
+// the proxies can't be moved so the element is copied
+
+template <typename Value, std::size_t N>
+inline void move_from_back(soa_varray<Value, N> & container, soa_iterator< soa_varray<Value, N> > it)
+{
+    BOOST_GEOMETRY_INDEX_ASSERT(!container.empty(), "cannot copy from empty container");
+    soa_iterator< soa_varray<Value, N> > back_it = container.end();
+    --back_it;
+    if ( it != back_it )
+    {
+        *it = *back_it;                                                                             // MAY THROW (copy)
+    }
+}
+
+// separately stored indexables
+// the default indexable getter of std::pair returns the first member
+
+template <typename First, typename Second, size_t N, typename EqualTo>
+struct separate_indexables<
+    soa_varray<std::pair<First, Second>, N>,
+    detail::translator<index::indexable< std::pair<First, Second> >, EqualTo>
+>
+{
+    static const bool value = true;
+};
+
+// elements derived type
+// algorithms operating on copies of elements use regular arrays
+
+template <typename OldValue, size_t N, typename NewValue>
+struct container_from_elements_type<soa_varray<OldValue, N>, NewValue>
+{
+    typedef detail::varray<NewValue, N> type;
+};
+
+}} // namespace detail::rtree
+
+}}} // namespace boost::geometry::index
+
+#endif // BOOST_GEOMETRY_INDEX_DETAIL_RTREE_NODE_SOA_ELEMENTS_HPP
@@ -2,7 +2,7 @@
 //
 // R-tree options, algorithms, parameters
 //
-// Copyright (c) 2011-2014 Adam Wulkiewicz, Lodz, Poland.
+// Copyright (c) 2011-2015 Adam Wulkiewicz, Lodz, Poland.
 //
 // Use, modification and distribution is subject to the Boost Software License,
 // Version 1.0. (See accompanying file LICENSE_1_0.txt or copy at
@@ -11,6 +11,12 @@
 #ifndef BOOST_GEOMETRY_INDEX_DETAIL_RTREE_OPTIONS_HPP
 #define BOOST_GEOMETRY_INDEX_DETAIL_RTREE_OPTIONS_HPP
 
+#include <boost/mpl/assert.hpp>
+#include <boost/type_traits/is_floating_point.hpp>
+
+#include <boost/geometry/geometries/box.hpp>
+#include <boost/geometry/geometries/point.hpp>
+
 #include <boost/geometry/index/parameters.hpp>
 
 namespace boost { namespace geometry { namespace index {
@@ -37,6 +43,7 @@ struct rstar_tag {};
 // NodeTag
 struct node_variant_dynamic_tag {};
 struct node_variant_static_tag {};
+struct node_variant_static_soa_tag {};
 //struct node_weak_dynamic_tag {};
 //struct node_weak_static_tag {};
 
@@ -148,6 +155,93 @@ struct options_type< index::dynamic_rstar >
     > type;
 };
 
+template <typename Parameters, typename Aggregator>
+struct options_type< index::augmented<Parameters, Aggregator> >
+{
+    typedef typename options_type<Parameters>::type options_t;
+
+    typedef options<
+        index::augmented<Parameters, Aggregator>,
+        typename options_t::insert_tag,
+        typename options_t::choose_next_node_tag,
+        typename options_t::split_tag,
+        typename options_t::redistribute_tag,
+        typename options_t::node_tag
+    > type;
+};
+
+template <typename Parameters, typename CoordinateType>
+struct options_type< index::reduced_precision<Parameters, CoordinateType> >
+{
+    typedef typename options_type<Parameters>::type options_t;
+
+    typedef options<
+        index::reduced_precision<Parameters, CoordinateType>,
+        typename options_t::insert_tag,
+        typename options_t::choose_next_node_tag,
+        typename options_t::split_tag,
+        typename options_t::redistribute_tag,
+        typename options_t::node_tag
+    > type;
+};
+
+template <typename Parameters>
+struct options_type< index::soa_leafs<Parameters> >
+{
+    typedef typename options_type<Parameters>::type options_t;
+
+    BOOST_MPL_ASSERT_MSG(
+        (boost::is_same<typename options_t::node_tag, node_variant_static_tag>::value),
+        SOA_LEAFS_REQUIRE_PARAMETERS_WITH_COMPILE_TIME_MAX_ELEMENTS,
+        (Parameters));
+
+    typedef options<
+        index::soa_leafs<Parameters>,
+        typename options_t::insert_tag,
+        typename options_t::choose_next_node_tag,
+        typename options_t::split_tag,
+        typename options_t::redistribute_tag,
+        node_variant_static_soa_tag
+    > type;
+};
+
+// The type of the boxes stored in nodes
+
+template <typename Bounds, typename Parameters>
+struct node_box_type
+{
+    typedef Bounds type;
+};
+
+template <typename Bounds, typename Parameters, typename Aggregator>
+struct node_box_type< Bounds, index::augmented<Parameters, Aggregator> >
+    : node_box_type<Bounds, Parameters>
+{};
+
+template <typename Bounds, typename Parameters>
+struct node_box_type< Bounds, index::soa_leafs<Parameters> >
+    : node_box_type<Bounds, Parameters>
+{};
+
+template <typename Bounds, typename Parameters, typename CoordinateType>
+struct node_box_type< Bounds, index::reduced_precision<Parameters, CoordinateType> >
+{
+    BOOST_MPL_ASSERT_MSG(
+        (boost::is_floating_point<CoordinateType>::value),
+        REDUCED_PRECISION_COORDINATE_TYPE_MUST_BE_FLOATING_POINT,
+        (CoordinateType));
+
+    typedef typename geometry::point_type<Bounds>::type point_type;
+
+    typedef geometry::model::box<
+        geometry::model::point<
+            CoordinateType,
+            geometry::dimension<point_type>::value,
+            typename geometry::coordinate_system<point_type>::type
+        >
+    > type;
+};
+
 }} // namespace detail::rtree
 
 }}} // namespace boost::geometry::index
@@ -85,6 +85,29 @@ struct nth_element_and_half_boxes<Dimension, Dimension>
     static inline void apply(EIt , EIt , EIt , Box const& , Box & , Box & , std::size_t ) {}
 };
 
+// The centroids of Indexables more precise than Box are calculated from their bounds,
+// converting coordinates beyond the range of Box would throw
+template <typename Box, typename Indexable, typename Point>
+inline void centroid(Indexable const& indexable, Point & pt, boost::mpl::bool_<true> /*is_exact*/)
+{
+    geometry::centroid(indexable, pt);
+}
+
+template <typename Box, typename Indexable, typename Point>
+inline void centroid(Indexable const& indexable, Point & pt, boost::mpl::bool_<false> /*is_exact*/)
+{
+    Box b;
+    index::detail::bounds(indexable, b);
+    geometry::centroid(b, pt);
+}
+
+template <typename Box, typename Indexable, typename Point>
+inline void centroid(Indexable const& indexable, Point & pt)
+{
+    pack_utils::centroid<Box>(indexable, pt,
+        boost::mpl::bool_<index::detail::dispatch::is_exact_bounds<Box, Indexable>::value>());
+}
+
 } // namespace pack_utils
 
 // STR leafs number are calculated as rcount/max
@@ -167,10 +190,10 @@ public:
             // CONSIDER: alternative - ignore invalid indexable or throw an exception
             BOOST_GEOMETRY_INDEX_ASSERT(detail::is_valid(indexable), "Indexable is invalid");
 
-            geometry::expand(hint_box, indexable);
+            index::detail::expand(hint_box, indexable);
 
             point_type pt;
-            geometry::centroid(indexable, pt);
+            pack_utils::centroid<Box>(indexable, pt);
             entries.push_back(std::make_pair(pt, first));
         }
 
@@ -216,9 +239,11 @@ private:
             for ( ; first != last ; ++first )
             {
                 rtree::elements(l).push_back(*(first->second));                                             // MAY THROW (A?,C)
-                geometry::expand(elements_box, translator(*(first->second)));
+                index::detail::expand(elements_box, translator(*(first->second)));
             }
 
+            rtree::update_aggregate<Value, Options, Box, Allocators>::apply(l, parameters);
+
             auto_remover.release();
             return internal_element(elements_box, n);
         }
@@ -244,6 +269,8 @@ private:
                           rtree::elements(in), elements_box,
                           parameters, translator, allocators);
 
+        rtree::update_aggregate<Value, Options, Box, Allocators>::apply(in, parameters);
+
         auto_remover.release();
         return internal_element(elements_box, n);
     }
@@ -277,7 +304,7 @@ private:
             elements.push_back(el);                                                 // MAY THROW (A?,C) - however in normal conditions shouldn't
             auto_remover.release();
 
-            geometry::expand(elements_box, el.first);
+            index::detail::expand(elements_box, el.first);
             return;
         }
         
@@ -59,7 +59,7 @@ inline void pick_seeds(Elements const& elements,
             box_type enlarged_box;
             //geometry::convert(ind1, enlarged_box);
             detail::bounds(ind1, enlarged_box);
-            geometry::expand(enlarged_box, ind2);
+            index::detail::expand(enlarged_box, ind2);
 
             bounded_indexable_view bounded_ind1(ind1);
             bounded_indexable_view bounded_ind2(ind2);
@@ -209,13 +209,13 @@ struct redistribute_elements<Value, Options, Translator, Box, Allocators, quadra
                 if ( insert_into_group1 )
                 {
                     elements1.push_back(elem);                                                              // MAY THROW, STRONG (copy)
-                    geometry::expand(box1, indexable);
+                    index::detail::expand(box1, indexable);
                     content1 = index::detail::content(box1);
                 }
                 else
                 {
                     elements2.push_back(elem);                                                              // MAY THROW, STRONG (alloc, copy)
-                    geometry::expand(box2, indexable);
+                    index::detail::expand(box2, indexable);
                     content2 = index::detail::content(box2);
                 }
 
@@ -267,8 +267,8 @@ struct redistribute_elements<Value, Options, Translator, Box, Allocators, quadra
             // calculate enlarged boxes and areas
             Box enlarged_box1(box1);
             Box enlarged_box2(box2);
-            geometry::expand(enlarged_box1, indexable);
-            geometry::expand(enlarged_box2, indexable);
+            index::detail::expand(enlarged_box1, indexable);
+            index::detail::expand(enlarged_box2, indexable);
             content_type enlarged_content1 = index::detail::content(enlarged_box1);
             content_type enlarged_content2 = index::detail::content(enlarged_box2);
 
@@ -0,0 +1,463 @@
+// Boost.Geometry Index
+//
+// R-tree local repacking of overlapping subtrees
+//
+// Copyright (c) 2026 agent.
+//
+// Use, modification and distribution is subject to the Boost Software License,
+// Version 1.0. (See accompanying file LICENSE_1_0.txt or copy at
+// http://www.boost.org/LICENSE_1_0.txt)
+
+#ifndef BOOST_GEOMETRY_INDEX_DETAIL_RTREE_REPACK_HPP
+#define BOOST_GEOMETRY_INDEX_DETAIL_RTREE_REPACK_HPP
+
+#include <algorithm>
+#include <vector>
+
+#include <boost/geometry/index/detail/algorithms/intersection_content.hpp>
+
+#include <boost/geometry/index/detail/rtree/pack_create.hpp>
+
+namespace boost { namespace geometry { namespace index { namespace detail { namespace rtree {
+
+// The position of the next subtree examined by rtree::repack(), kept between the calls.
+// It's the index of the subtree among the nodes of the same height in the preorder.
+struct repack_cursor
+{
+    repack_cursor()
+        : height(0), index(0)
+    {}
+
+    std::size_t height;
+    std::size_t index;
+};
+
+namespace visitors {
+
+// Counts the values stored in a subtree and checks if the children
+// of any internal node in the subtree overlap
+template <typename Value, typename Options, typename Translator, typename Box, typename Allocators>
+class repack_overlap
+    : public rtree::visitor<Value, typename Options::parameters_type, Box, Allocators, typename Options::node_tag, true>::type
+{
+public:
+    typedef typename rtree::internal_node<Value, typename Options::parameters_type, Box, Allocators, typename Options::node_tag>::type internal_node;
+    typedef typename rtree::leaf<Value, typename Options::parameters_type, Box, Allocators, typename Options::node_tag>::type leaf;
+
+    inline repack_overlap()
+        : overlaps(false), values_count(0)
+    {}
+
+    inline void operator()(internal_node const& n)
+    {
+        typedef typename rtree::elements_type<internal_node>::type elements_type;
+        elements_type const& elements = rtree::elements(n);
+
+        if ( !overlaps )
+            overlaps = children_overlap(elements);
+
+        for ( typename elements_type::const_iterator it = elements.begin() ; it != elements.end() ; ++it )
+            rtree::apply_visitor(*this, *it->second);
+    }
+
+    inline void operator()(leaf const& n)
+    {
+        values_count += rtree::elements(n).size();
+    }
+
+    bool overlaps;
+    std::size_t values_count;
+
+private:
+    template <typename Elements>
+    static inline bool children_overlap(Elements const& elements)
+    {
+        for ( typename Elements::const_iterator it1 = elements.begin() ; it1 != elements.end() ; ++it1 )
+            for ( typename Elements::const_iterator it2 = it1 + 1 ; it2 != elements.end() ; ++it2 )
+                if ( 0 < index::detail::intersection_content(it1->first, it2->first) )
+                    return true;
+
+        return false;
+    }
+};
+
+// Gathers the pointers to values stored in a subtree together with their centroids
+template <typename Value, typename Options, typename Translator, typename Box, typename Allocators, typename Entries>
+class repack_entries
+    : public rtree::visitor<Value, typename Options::parameters_type, Box, Allocators, typename Options::node_tag, true>::type
+{
+public:
+    typedef typename rtree::internal_node<Value, typename Options::parameters_type, Box, Allocators, typename Options::node_tag>::type internal_node;
+    typedef typename rtree::leaf<Value, typename Options::parameters_type, Box, Allocators, typename Options::node_tag>::type leaf;
+
+    inline repack_entries(Entries & entries, Box & hint_box, Translator const& tr)
+        : m_entries(entries), m_hint_box(hint_box), m_tr(tr)
+    {}
+
+    inline void operator()(internal_node const& n)
+    {
+        typedef typename rtree::elements_type<internal_node>::type elements_type;
+        elements_type const& elements = rtree::elements(n);
+
+        for ( typename elements_type::const_iterator it = elements.begin() ; it != elements.end() ; ++it )
+            rtree::apply_visitor(*this, *it->second);
+    }
+
+    inline void operator()(leaf const& n)
+    {
+        typedef typename rtree::elements_type<leaf>::type elements_type;
+        elements_type const& elements = rtree::elements(n);
+
+        for ( typename elements_type::const_iterator it = elements.begin() ; it != elements.end() ; ++it )
+        {
+            Value const& v = *it;
+            typename Translator::result_type indexable = m_tr(v);
+            index::detail::expand(m_hint_box, indexable);
+
+            typename Entries::value_type::first_type pt;
+            geometry::centroid(indexable, pt);
+            m_entries.push_back(std::make_pair(pt, rtree::element_handle<elements_type>::make(elements, it))); // MAY THROW (A)
+        }
+    }
+
+private:
+    Entries & m_entries;
+    Box & m_hint_box;
+    Translator const& m_tr;
+};
+
+} // namespace visitors
+
+// Repacks the subtrees which children overlap.
+// The subtrees of the same height are examined one after another, starting at the cursor
+// and continuing in the next call, until the number of their values would exceed the budget.
+// The height is the greatest one for which the maximum number of values stored in
+// a subtree isn't greater than the budget, so at least one subtree is examined in each call.
+// If the budget isn't less than the number of values the whole tree is examined.
+// The values of an overlapping subtree are distributed among the nodes created the same way
+// as in the packing algorithm. The height of the subtree is not changed so the rest
+// of the tree is not modified, except for the root with a single child which is removed.
+template <typename Value, typename Options, typename Translator, typename Box, typename Allocators>
+class repack
+{
+    typedef typename rtree::node<Value, typename Options::parameters_type, Box, Allocators, typename Options::node_tag>::type node;
+    typedef typename rtree::internal_node<Value, typename Options::parameters_type, Box, Allocators, typename Options::node_tag>::type internal_node;
+    typedef typename rtree::leaf<Value, typename Options::parameters_type, Box, Allocators, typename Options::node_tag>::type leaf;
+
+    typedef typename Allocators::node_pointer node_pointer;
+    typedef rtree::node_auto_ptr<Value, Options, Translator, Box, Allocators> node_auto_ptr;
+    typedef typename Allocators::size_type size_type;
+
+    typedef typename geometry::point_type<Box>::type point_type;
+    typedef typename Options::parameters_type parameters_type;
+    static const std::size_t dimension = geometry::dimension<point_type>::value;
+
+    typedef typename rtree::elements_type<internal_node>::type internal_elements;
+    typedef typename internal_elements::value_type internal_element;
+
+    typedef rtree::element_handle<typename rtree::elements_type<leaf>::type> value_handle;
+    typedef std::pair<point_type, typename value_handle::type> entry_type;
+    typedef std::vector<entry_type> entries_type;
+
+    typedef visitors::repack_overlap<Value, Options, Translator, Box, Allocators> overlap_visitor;
+
+    struct window
+    {
+        window(size_type h, size_type first, size_type max)
+            : height(h), first_index(first), next_index(0)
+            , max_values(max), values_count(0), repacked_count(0), examined(false), full(false)
+        {}
+
+        size_type height;
+        size_type first_index;
+        size_type next_index;
+        size_type max_values;
+        size_type values_count;
+        size_type repacked_count;
+        bool examined;
+        bool full;
+    };
+
+public:
+    // returns the number of repacked values
+    inline static
+    size_type apply(node_pointer & root, size_type & leafs_level, size_type values_count,
+                    repack_cursor & cursor, size_type max_values,
+                    parameters_type const& parameters, Translator const& translator, Allocators & allocators)
+    {
+        if ( 0 == leafs_level || 0 == max_values )
+            return 0;
+
+        // the whole tree
+        if ( values_count <= max_values )
+        {
+            cursor = repack_cursor();
+
+            overlap_visitor overlap_v;
+            rtree::apply_visitor(overlap_v, *root);
+
+            if ( !overlap_v.overlaps )
+                return 0;
+
+            apply(rtree::get<internal_node>(*root), leafs_level, true,
+                  parameters, translator, allocators);                                                  // MAY THROW, STRONG (V, E: alloc, copy, N: alloc)
+            collapse_root(root, leafs_level, allocators);
+
+            return values_count;
+        }
+
+        // the greatest height of subtrees which can't store more than max_values,
+        // below the root, subtrees of leafs can't be repacked
+        size_type height = 0;
+        for ( size_type subtree_max = parameters.get_max_elements() ;
+              height + 1 < leafs_level && subtree_max <= max_values / parameters.get_max_elements() ; )
+        {
+            subtree_max *= parameters.get_max_elements();
+            ++height;
+        }
+
+        if ( 0 == height )
+            return 0;
+
+        if ( cursor.height != height )
+        {
+            cursor.height = height;
+            cursor.index = 0;
+        }
+
+        window w(height, cursor.index, max_values);
+        visit(rtree::get<internal_node>(*root), leafs_level, w,
+              parameters, translator, allocators);                                                      // MAY THROW, STRONG (V, E: alloc, copy, N: alloc)
+
+        // start from the beginning if the subtrees after the cursor were removed
+        if ( !w.examined && 0 < w.first_index )
+        {
+            w = window(height, 0, max_values);
+            visit(rtree::get<internal_node>(*root), leafs_level, w,
+                  parameters, translator, allocators);                                                  // MAY THROW, STRONG (V, E: alloc, copy, N: alloc)
+        }
+
+        cursor.index = w.full ? w.next_index : 0;
+
+        return w.repacked_count;
+    }
+
+private:
+    // visits the subtrees of the window's height in the preorder, until the budget is used
+    inline static
+    void visit(internal_node & n, size_type height, window & w,
+               parameters_type const& parameters, Translator const& translator, Allocators & allocators)
+    {
+        internal_elements & elements = rtree::elements(n);
+
+        if ( height > w.height + 1 )
+        {
+            for ( typename internal_elements::iterator it = elements.begin() ;
+                  it != elements.end() && !w.full ; ++it )
+            {
+                visit(rtree::get<internal_node>(*it->second), height - 1, w,
+                      parameters, translator, allocators);
+            }
+            return;
+        }
+
+        // the children are the subtrees of the window's height, skip the ones before the cursor
+        if ( w.next_index + elements.size() <= w.first_index )
+        {
+            w.next_index += elements.size();
+            return;
+        }
+
+        for ( typename internal_elements::iterator it = elements.begin() ;
+              it != elements.end() ; ++it, ++w.next_index )
+        {
+            if ( w.next_index < w.first_index )
+                continue;
+
+            internal_node & child = rtree::get<internal_node>(*it->second);
+
+            overlap_visitor overlap_v;
+            overlap_v(child);
+
+            if ( w.max_values - w.values_count < overlap_v.values_count )
+            {
+                w.full = true;
+                return;
+            }
+
+            w.values_count += overlap_v.values_count;
+            w.examined = true;
+
+            if ( overlap_v.overlaps )
+            {
+                apply(child, w.height, false, parameters, translator, allocators);                      // MAY THROW, STRONG (V, E: alloc, copy, N: alloc)
+                w.repacked_count += overlap_v.values_count;
+            }
+        }
+    }
+
+    // replaces the root having a single child with this child
+    inline static
+    void collapse_root(node_pointer & root, size_type & leafs_level, Allocators & allocators)
+    {
+        while ( 0 < leafs_level )
+        {
+            internal_elements & elements = rtree::elements(rtree::get<internal_node>(*root));
+            if ( elements.size() != 1 )
+                return;
+
+            node_pointer child = elements.front().second;
+            elements.clear();
+            rtree::destroy_node<Allocators, internal_node>::apply(allocators, root);
+            root = child;
+            --leafs_level;
+        }
+    }
+
+    // replaces the children of the node with the new ones storing the same values
+    inline static
+    void apply(internal_node & n, size_type height, bool is_root,
+               parameters_type const& parameters, Translator const& translator, Allocators & allocators)
+    {
+        typedef typename rtree::container_from_elements_type<
+            internal_elements, internal_element
+        >::type old_elements_type;
+
+        internal_elements & elements = rtree::elements(n);
+
+        entries_type entries;
+        Box hint_box;
+        geometry::assign_inverse(hint_box);
+        visitors::repack_entries<Value, Options, Translator, Box, Allocators, entries_type>
+            entries_v(entries, hint_box, translator);
+        entries_v(n);                                                                                // MAY THROW (A)
+
+        old_elements_type old_elements(elements.begin(), elements.end());                               // MAY THROW (A)
+        elements.clear();
+
+        BOOST_TRY
+        {
+            std::size_t const children_count = calculate_children_count(entries.size(), height,
+                                                                         is_root ? 1 : parameters.get_min_elements(),
+                                                                         parameters);
+            per_children(entries.begin(), entries.end(), hint_box, entries.size(), children_count,
+                         height - 1, elements, parameters, translator, allocators);                     // MAY THROW (V, E: alloc, copy, N: alloc)
+        }
+        BOOST_CATCH(...)
+        {
+            rtree::destroy_elements<Value, Options, Translator, Box, Allocators>::apply(elements, allocators);
+            elements.clear();
+            // memory is already reserved so this shouldn't throw
+            elements.assign(old_elements.begin(), old_elements.end());
+            BOOST_RETHROW                                                                                 // RETHROW
+        }
+        BOOST_CATCH_END
+
+        rtree::destroy_elements<Value, Options, Translator, Box, Allocators>::apply(old_elements, allocators);
+
+        rtree::update_aggregate<Value, Options, Box, Allocators>::apply(n, parameters);
+    }
+
+    // the number of children such that each child stores between min^height and max^height values
+    inline static
+    std::size_t calculate_children_count(std::size_t values_count, std::size_t height, std::size_t min_children,
+                                         parameters_type const& parameters)
+    {
+        std::size_t subtree_max = parameters.get_max_elements();
+        for ( std::size_t h = 1 ; h < height && subtree_max < values_count ; ++h )
+            subtree_max *= parameters.get_max_elements();
+
+        std::size_t result = (values_count + subtree_max - 1) / subtree_max;
+        return (std::max)(result, (std::min)(min_children, values_count));
+    }
+
+    // creates children_count nodes of equal numbers of values, splitting the entries
+    // along the longest edge of the hint box like the packing algorithm
+    template <typename EIt> inline static
+    void per_children(EIt first, EIt last, Box const& hint_box,
+                      std::size_t values_count, std::size_t children_count, size_type height,
+                      internal_elements & elements,
+                      parameters_type const& parameters, Translator const& translator, Allocators & allocators)
+    {
+        BOOST_GEOMETRY_INDEX_ASSERT(0 < children_count && children_count <= values_count, "unexpected parameters");
+
+        if ( children_count == 1 )
+        {
+            internal_element el = per_node(first, last, hint_box, values_count, height,
+                                           parameters, translator, allocators);                         // MAY THROW (V, E: alloc, copy, N: alloc)
+
+            node_auto_ptr auto_remover(el.second, allocators);
+            elements.push_back(el);                                                                     // MAY THROW (A?,C)
+            auto_remover.release();
+            return;
+        }
+
+        // the first values_count % children_count children store one more value
+        std::size_t const left_children = children_count / 2;
+        std::size_t const left_count = left_children * (values_count / children_count)
+                                     + (std::min)(left_children, values_count % children_count);
+        EIt median = first + left_count;
+
+        typename coordinate_type<Box>::type greatest_length;
+        std::size_t greatest_dim_index = 0;
+        pack_utils::biggest_edge<dimension>::apply(hint_box, greatest_length, greatest_dim_index);
+        Box left, right;
+        pack_utils::nth_element_and_half_boxes<0, dimension>
+            ::apply(first, median, last, hint_box, left, right, greatest_dim_index);
+
+        per_children(first, median, left, left_count, left_children, height,
+                     elements, parameters, translator, allocators);
+        per_children(median, last, right, values_count - left_count, children_count - left_children, height,
+                     elements, parameters, translator, allocators);
+    }
+
+    template <typename EIt> inline static
+    internal_element per_node(EIt first, EIt last, Box const& hint_box,
+                              std::size_t values_count, size_type height,
+                              parameters_type const& parameters, Translator const& translator, Allocators & allocators)
+    {
+        if ( height == 0 )
+        {
+            node_pointer n = rtree::create_node<Allocators, leaf>::apply(allocators);                   // MAY THROW (A)
+            node_auto_ptr auto_remover(n, allocators);
+            leaf & l = rtree::get<leaf>(*n);
+
+            rtree::elements(l).reserve(values_count);                                                   // MAY THROW (A)
+            Box elements_box;
+            geometry::assign_inverse(elements_box);
+            for ( ; first != last ; ++first )
+            {
+                rtree::elements(l).push_back(value_handle::get(first->second));                         // MAY THROW (A?,C)
+                index::detail::expand(elements_box, translator(value_handle::get(first->second)));
+            }
+
+            rtree::update_aggregate<Value, Options, Box, Allocators>::apply(l, parameters);
+
+            auto_remover.release();
+            return internal_element(elements_box, n);
+        }
+
+        node_pointer n = rtree::create_node<Allocators, internal_node>::apply(allocators);              // MAY THROW (A)
+        node_auto_ptr auto_remover(n, allocators);
+        internal_node & in = rtree::get<internal_node>(*n);
+
+        std::size_t const children_count = calculate_children_count(values_count, height,
+                                                                     parameters.get_min_elements(),
+                                                                     parameters);
+        rtree::elements(in).reserve(children_count);                                                    // MAY THROW (A)
+
+        per_children(first, last, hint_box, values_count, children_count, height - 1,
+                     rtree::elements(in), parameters, translator, allocators);                          // MAY THROW (V, E: alloc, copy, N: alloc)
+
+        rtree::update_aggregate<Value, Options, Box, Allocators>::apply(in, parameters);
+
+        Box elements_box = rtree::elements_box<Box>(rtree::elements(in).begin(), rtree::elements(in).end(), translator);
+
+        auto_remover.release();
+        return internal_element(elements_box, n);
+    }
+};
+
+}}}}} // namespace boost::geometry::index::detail::rtree
+
+#endif // BOOST_GEOMETRY_INDEX_DETAIL_RTREE_REPACK_HPP
@@ -85,7 +85,7 @@ private:
 
             // expanded child node's box
             Box box_exp(ch_i.first);
-            geometry::expand(box_exp, indexable);
+            index::detail::expand(box_exp, indexable);
 
             // areas difference
             content_type content = index::detail::content(box_exp);
@@ -151,7 +151,7 @@ private:
 
             Box box_exp(ch_i.first);
             // calculate expanded box of child node ch_i
-            geometry::expand(box_exp, indexable);
+            index::detail::expand(box_exp, indexable);
 
             content_type overlap_diff = 0;
 
@@ -206,7 +206,7 @@ private:
 
             // expanded child node's box
             Box box_exp(ch_i.first);
-            geometry::expand(box_exp, indexable);
+            index::detail::expand(box_exp, indexable);
 
             // areas difference
             content_type content = index::detail::content(box_exp);
@@ -228,6 +228,10 @@ struct level_insert_base
         {
             base::split(n);                                                                                 // MAY THROW (V, E: alloc, copy, N: alloc)
         }
+        else
+        {
+            base::update_aggregate(n);
+        }
     }
 
     template <typename Node>
@@ -239,6 +243,9 @@ struct level_insert_base
             base::m_traverse_data.current_element().first =
                 elements_box<Box>(rtree::elements(n).begin(), rtree::elements(n).end(), base::m_translator);
         }
+
+        // the node or its children could be modified
+        base::update_aggregate(n);
     }
 
     size_type result_relative_level;
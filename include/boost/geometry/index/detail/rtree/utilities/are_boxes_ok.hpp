@@ -65,7 +65,7 @@ public:
         for( typename elements_type::const_iterator it = elements.begin() + 1;
             it != elements.end() ; ++it)
         {
-            geometry::expand(box_exp, it->first);
+            index::detail::expand(box_exp, it->first);
         }
         
         if ( m_exact_match )
@@ -89,13 +89,11 @@ public:
             }
         
             Box box_exp;
-            geometry::convert(
-                index::detail::return_ref_or_bounds(m_tr(elements.front())),
-                box_exp);
+            index::detail::bounds(m_tr(elements.front()), box_exp);
             for(typename elements_type::const_iterator it = elements.begin() + 1;
                 it != elements.end() ; ++it)
             {
-                geometry::expand(box_exp, m_tr(*it));
+                index::detail::expand(box_exp, m_tr(*it));
             }
 
             if ( m_exact_match )
@@ -0,0 +1,90 @@
+// Boost.Geometry Index
+//
+// R-tree aggregate query visitor implementation
+//
+// Copyright (c) 2026 agent.
+//
+// Use, modification and distribution is subject to the Boost Software License,
+// Version 1.0. (See accompanying file LICENSE_1_0.txt or copy at
+// http://www.boost.org/LICENSE_1_0.txt)
+
+#ifndef BOOST_GEOMETRY_INDEX_DETAIL_RTREE_VISITORS_AGGREGATE_QUERY_HPP
+#define BOOST_GEOMETRY_INDEX_DETAIL_RTREE_VISITORS_AGGREGATE_QUERY_HPP
+
+namespace boost { namespace geometry { namespace index {
+
+namespace detail { namespace rtree { namespace visitors {
+
+// Combines the aggregates of values meeting predicates.
+// The aggregates stored in nodes are used if all values stored in a node
+// meet predicates, otherwise the node is traversed.
+template <typename Value, typename Options, typename Translator, typename Box, typename Allocators, typename Predicates>
+struct aggregate_query
+    : public rtree::visitor<Value, typename Options::parameters_type, Box, Allocators, typename Options::node_tag, true>::type
+{
+    typedef typename Options::parameters_type parameters_type;
+
+    typedef typename rtree::node<Value, parameters_type, Box, Allocators, typename Options::node_tag>::type node;
+    typedef typename rtree::internal_node<Value, parameters_type, Box, Allocators, typename Options::node_tag>::type internal_node;
+    typedef typename rtree::leaf<Value, parameters_type, Box, Allocators, typename Options::node_tag>::type leaf;
+
+    typedef typename parameters_type::aggregator_type aggregator_type;
+    typedef typename aggregator_type::result_type aggregate_type;
+
+    static const unsigned predicates_len = index::detail::predicates_length<Predicates>::value;
+
+    inline aggregate_query(parameters_type const& parameters, Translator const& t, Predicates const& p)
+        : aggregator(parameters.get_aggregator()), tr(t), pred(p), result(aggregator.identity())
+    {}
+
+    inline void operator()(internal_node const& n)
+    {
+        typedef typename rtree::elements_type<internal_node>::type elements_type;
+        elements_type const& elements = rtree::elements(n);
+
+        for (typename elements_type::const_iterator it = elements.begin();
+            it != elements.end(); ++it)
+        {
+            // if all values stored in the node meet predicates use the node's aggregate
+            // 0 - dummy value
+            if ( index::detail::predicates_check<index::detail::covered_bounds_tag, 0, predicates_len>(pred, 0, it->first) )
+            {
+                node_aggregate<Value, Options, Box, Allocators> v;
+                rtree::apply_visitor(v, *it->second);
+                result = aggregator.combine(result, *v.result);
+            }
+            // if node meets predicates
+            else if ( index::detail::predicates_check<index::detail::bounds_tag, 0, predicates_len>(pred, 0, it->first) )
+            {
+                rtree::apply_visitor(*this, *it->second);
+            }
+        }
+    }
+
+    inline void operator()(leaf const& n)
+    {
+        typedef typename rtree::elements_type<leaf>::type elements_type;
+        elements_type const& elements = rtree::elements(n);
+
+        for (typename elements_type::const_iterator it = elements.begin();
+            it != elements.end(); ++it)
+        {
+            // if value meets predicates
+            if ( index::detail::predicates_check<index::detail::value_tag, 0, predicates_len>(pred, *it, tr(*it)) )
+                result = aggregator.combine(result, aggregator.apply(*it));
+        }
+    }
+
+    aggregator_type const& aggregator;
+    Translator const& tr;
+
+    Predicates pred;
+
+    aggregate_type result;
+};
+
+}}} // namespace detail::rtree::visitors
+
+}}} // namespace boost::geometry::index
+
+#endif // BOOST_GEOMETRY_INDEX_DETAIL_RTREE_VISITORS_AGGREGATE_QUERY_HPP
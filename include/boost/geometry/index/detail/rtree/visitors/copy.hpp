@@ -55,6 +55,8 @@ public:
             auto_result.release();
         }
 
+        rtree::update_aggregate<Value, Options, Box, Allocators>::copy(n, rtree::get<internal_node>(*new_node));
+
         result = new_node.get();
         new_node.release();
     }
@@ -75,6 +77,8 @@ public:
             elements_dst.push_back(*it);                                                                // MAY THROW, STRONG (V: alloc, copy)
         }
 
+        rtree::update_aggregate<Value, Options, Box, Allocators>::copy(l, rtree::get<leaf>(*new_node));
+
         result = new_node.get();
         new_node.release();
     }
@@ -97,7 +97,8 @@ template <
     typename Allocators,
     typename Predicates,
     unsigned DistancePredicateIndex,
-    typename OutIter
+    typename OutIter,
+    typename Statistics = index::detail::no_query_statistics
 >
 class distance_query
     : public rtree::visitor<Value, typename Options::parameters_type, Box, Allocators, typename Options::node_tag, true>::type
@@ -120,10 +121,12 @@ public:
 
     static const unsigned predicates_len = index::detail::predicates_length<Predicates>::value;
 
-    inline distance_query(parameters_type const& parameters, Translator const& translator, Predicates const& pred, OutIter out_it)
+    inline distance_query(parameters_type const& parameters, Translator const& translator, Predicates const& pred, OutIter out_it,
+                          Statistics const& stats = Statistics())
         : m_parameters(parameters), m_translator(translator)
         , m_pred(pred)
         , m_result(nearest_predicate_access::get(m_pred).count, out_it)
+        , m_stats(stats)
     {}
 
     inline void operator()(internal_node const& n)
@@ -141,10 +144,14 @@ public:
         
         elements_type const& elements = rtree::elements(n);
 
+        m_stats.visit_node();
+
         // fill array of nodes meeting predicates
         for (typename elements_type::const_iterator it = elements.begin();
             it != elements.end(); ++it)
         {
+            m_stats.check_predicates();
+
             // if current node meets predicates
             // 0 - dummy value
             if ( index::detail::predicates_check<index::detail::bounds_tag, 0, predicates_len>(m_pred, 0, it->first) )
@@ -176,18 +183,24 @@ public:
         // sort array
         std::sort(active_branch_list.begin(), active_branch_list.end(), abl_less);
 
+        m_stats.push_branches(active_branch_list.size());
+
         // recursively visit nodes
-        for ( typename active_branch_list_type::const_iterator it = active_branch_list.begin();
-              it != active_branch_list.end() ; ++it )
+        typename active_branch_list_type::const_iterator it = active_branch_list.begin();
+        for ( ; it != active_branch_list.end() ; ++it )
         {
             // if current node is further than furthest neighbor, the rest of nodes also will be further
             if ( m_result.has_enough_neighbors() &&
                  is_node_prunable(m_result.greatest_comparable_distance(), it->first) )
                 break;
 
+            m_stats.pop_branches(1);
+
             rtree::apply_visitor(*this, *(it->second));
         }
 
+        m_stats.pop_branches(active_branch_list.end() - it);
+
         // ALTERNATIVE VERSION - use heap instead of sorted container
         // It seems to be faster for greater MaxElements and slower otherwise
         // CONSIDER: using one global container/heap for active branches
@@ -220,32 +233,79 @@ public:
     {
         typedef typename rtree::elements_type<leaf>::type elements_type;
         elements_type const& elements = rtree::elements(n);
-        
+
+        m_stats.visit_leaf();
+
+        this->query_values(elements,
+            boost::mpl::bool_<rtree::separate_indexables<elements_type, Translator>::value>());
+    }
+
+    inline size_t finish()
+    {
+        size_t const found_count = m_result.finish();
+        m_stats.found(found_count);
+        return found_count;
+    }
+
+private:
+    template <typename Elements>
+    inline void query_values(Elements const& elements, boost::mpl::false_ /*separate_indexables*/)
+    {
         // search leaf for closest value meeting predicates
-        for (typename elements_type::const_iterator it = elements.begin();
+        for (typename Elements::const_iterator it = elements.begin();
             it != elements.end(); ++it)
         {
+            m_stats.check_predicates();
+
+            Value const& v = *it;
+
             // if value meets predicates
-            if ( index::detail::predicates_check<index::detail::value_tag, 0, predicates_len>(m_pred, *it, m_translator(*it)) )
+            if ( index::detail::predicates_check<index::detail::value_tag, 0, predicates_len>(m_pred, v, m_translator(v)) )
             {
                 // calculate values distance for distance predicate
                 value_distance_type value_distance;
                 // if distance is ok
-                if ( calculate_value_distance::apply(predicate(), m_translator(*it), value_distance) )
+                if ( calculate_value_distance::apply(predicate(), m_translator(v), value_distance) )
                 {
                     // store value
-                    m_result.store(*it, value_distance);
+                    m_result.store(v, value_distance);
                 }
             }
         }
     }
 
-    inline size_t finish()
+    // the predicates of Indexables and the distances are checked in the array of Indexables,
+    // values are created only for the Indexables closer than the furthest neighbor found so far
+    template <typename Elements>
+    inline void query_values(Elements const& elements, boost::mpl::true_ /*separate_indexables*/)
     {
-        return m_result.finish();
+        typedef typename Elements::first_type element_indexable_type;
+        element_indexable_type const* indexables = elements.firsts();
+
+        for (typename Elements::size_type i = 0 ; i < elements.size() ; ++i)
+        {
+            m_stats.check_predicates();
+
+            // 0 - dummy value
+            if ( !index::detail::predicates_check<index::detail::indexable_tag, 0, predicates_len>(m_pred, 0, indexables[i]) )
+                continue;
+
+            value_distance_type value_distance;
+            if ( !calculate_value_distance::apply(predicate(), indexables[i], value_distance) )
+                continue;
+
+            // the value would be rejected by the result anyway
+            if ( m_result.has_enough_neighbors() &&
+                 !(value_distance < m_result.greatest_comparable_distance()) )
+                continue;
+
+            Value const v = elements[i];
+
+            if ( index::detail::predicates_check<index::detail::value_only_tag, 0, predicates_len>(m_pred, v, indexables[i]) )
+                m_result.store(v, value_distance);
+        }
     }
 
-private:
     static inline bool abl_less(
         std::pair<node_distance_type, typename Allocators::node_pointer> const& p1,
         std::pair<node_distance_type, typename Allocators::node_pointer> const& p2)
@@ -276,6 +336,8 @@ private:
 
     Predicates m_pred;
     distance_query_result<Value, Translator, value_distance_type, OutIter> m_result;
+
+    Statistics m_stats;
 };
 
 template <
@@ -315,6 +377,8 @@ public:
     typedef typename rtree::elements_type<internal_node>::type internal_elements;
     typedef typename internal_elements::const_iterator internal_iterator;
     typedef typename rtree::elements_type<leaf>::type leaf_elements;
+    typedef rtree::element_handle<leaf_elements> value_handle;
+    typedef std::pair<value_distance_type, typename value_handle::type> neighbor_data;
 
     typedef std::pair<node_distance_type, node_pointer> branch_data;
     typedef typename index::detail::rtree::container_from_elements_type<
@@ -349,7 +413,7 @@ public:
 
     const_reference dereference() const
     {
-        return *(neighbors[current_neighbor].second);
+        return value_handle::get(neighbors[current_neighbor].second);
     }
 
     void initialize(node_pointer root)
@@ -489,43 +553,91 @@ public:
         // store distance to the furthest neighbour
         bool not_enough_neighbors = neighbors.size() < max_count();
         value_distance_type greatest_distance = !not_enough_neighbors ? neighbors.back().first : (std::numeric_limits<value_distance_type>::max)();
-        
+
+        this->query_values(elements, not_enough_neighbors, greatest_distance,
+            boost::mpl::bool_<rtree::separate_indexables<elements_type, Translator>::value>());
+
+        // sort array
+        std::sort(neighbors.begin(), neighbors.end(), neighbors_less);
+        // remove furthest values
+        if ( max_count() < neighbors.size() )
+            neighbors.resize(max_count());
+    }
+
+private:
+    template <typename Elements>
+    inline void query_values(Elements const& elements,
+                             bool not_enough_neighbors,
+                             value_distance_type const& greatest_distance,
+                             boost::mpl::false_ /*separate_indexables*/)
+    {
         // search leaf for closest value meeting predicates
-        for ( typename elements_type::const_iterator it = elements.begin() ; it != elements.end() ; ++it)
+        for ( typename Elements::const_iterator it = elements.begin() ; it != elements.end() ; ++it)
         {
+            Value const& v = *it;
+
             // if value meets predicates
-            if ( index::detail::predicates_check<index::detail::value_tag, 0, predicates_len>(m_pred, *it, (*m_translator)(*it)) )
+            if ( index::detail::predicates_check<index::detail::value_tag, 0, predicates_len>(m_pred, v, (*m_translator)(v)) )
             {
                 // calculate values distance for distance predicate
                 value_distance_type value_distance;
                 // if distance is ok
-                if ( calculate_value_distance::apply(predicate(), (*m_translator)(*it), value_distance) )
+                if ( calculate_value_distance::apply(predicate(), (*m_translator)(v), value_distance) )
                 {
                     // if there is not enough values or current value is closer than furthest neighbour
                     if ( not_enough_neighbors || value_distance < greatest_distance )
                     {
-                        neighbors.push_back(std::make_pair(value_distance, boost::addressof(*it)));
+                        neighbors.push_back(neighbor_data(value_distance, value_handle::make(elements, it)));
                     }
                 }
             }
         }
+    }
 
-        // sort array
-        std::sort(neighbors.begin(), neighbors.end(), neighbors_less);
-        // remove furthest values
-        if ( max_count() < neighbors.size() )
-            neighbors.resize(max_count());
+    // the predicates of Indexables and the distances are checked in the array of Indexables,
+    // values are created only for the Indexables closer than the furthest neighbour
+    template <typename Elements>
+    inline void query_values(Elements const& elements,
+                             bool not_enough_neighbors,
+                             value_distance_type const& greatest_distance,
+                             boost::mpl::true_ /*separate_indexables*/)
+    {
+        typedef typename Elements::first_type element_indexable_type;
+        element_indexable_type const* indexables = elements.firsts();
+
+        for ( typename Elements::const_iterator it = elements.begin() ; it != elements.end() ; ++it)
+        {
+            element_indexable_type const& indexable = indexables[it.index()];
+
+            // 0 - dummy value
+            if ( !index::detail::predicates_check<index::detail::indexable_tag, 0, predicates_len>(m_pred, 0, indexable) )
+                continue;
+
+            value_distance_type value_distance;
+            if ( !calculate_value_distance::apply(predicate(), indexable, value_distance) )
+                continue;
+
+            // if there is enough values and current value isn't closer than furthest neighbour
+            if ( !not_enough_neighbors && !(value_distance < greatest_distance) )
+                continue;
+
+            Value const v = *it;
+
+            if ( index::detail::predicates_check<index::detail::value_only_tag, 0, predicates_len>(m_pred, v, indexable) )
+            {
+                neighbors.push_back(neighbor_data(value_distance, value_handle::make(elements, it)));
+            }
+        }
     }
 
-private:
     static inline bool abl_less(std::pair<node_distance_type, typename Allocators::node_pointer> const& p1,
                                 std::pair<node_distance_type, typename Allocators::node_pointer> const& p2)
     {
         return p1.first < p2.first;
     }
 
-    static inline bool neighbors_less(std::pair<value_distance_type, const Value *> const& p1,
-                                      std::pair<value_distance_type, const Value *> const& p2)
+    static inline bool neighbors_less(neighbor_data const& p1,
+                                      neighbor_data const& p2)
     {
         return p1.first < p2.first;
     }
@@ -568,7 +680,7 @@ private:
     Predicates m_pred;
 
     internal_stack_type internal_stack;
-    std::vector< std::pair<value_distance_type, const Value *> > neighbors;
+    std::vector<neighbor_data> neighbors;
     size_type current_neighbor;
     node_distance_type next_closest_node_distance;
 };
@@ -60,7 +60,7 @@ public:
 
             // expanded child node's box
             Box box_exp(ch_i.first);
-            geometry::expand(box_exp, indexable);
+            index::detail::expand(box_exp, indexable);
 
             // areas difference
             content_type content = index::detail::content(box_exp);
@@ -272,7 +272,7 @@ protected:
             apply(n, rtree::element_indexable(m_element, m_translator), m_parameters, m_leafs_level - m_traverse_data.current_level);
 
         // expand the node to contain value
-        geometry::expand(
+        index::detail::expand(
             rtree::elements(n)[choosen_node_index].first,
             rtree::element_indexable(m_element, m_translator));
 
@@ -296,6 +296,16 @@ protected:
             // Furthermore it may be empty root - internal node.
             split(n);                                                                                           // MAY THROW (V, E: alloc, copy, N:alloc)
         }
+        else
+        {
+            update_aggregate(n);
+        }
+    }
+
+    template <typename Node>
+    inline void update_aggregate(Node & n) const
+    {
+        rtree::update_aggregate<Value, Options, Box, Allocators>::apply(n, m_parameters);
     }
 
     template <typename Visitor>
@@ -342,6 +352,9 @@ protected:
         // for exception safety
         node_auto_ptr additional_node_ptr(additional_nodes[0].second, m_allocators);
 
+        update_aggregate(n);
+        update_aggregate(rtree::get<Node>(*additional_nodes[0].second));
+
         // node is not the root - just add the new node
         if ( !m_traverse_data.current_is_root() )
         {
@@ -371,6 +384,8 @@ protected:
             }
             BOOST_CATCH_END
 
+            update_aggregate(rtree::get<internal_node>(*new_root));
+
             m_root_node = new_root.get();
             ++m_leafs_level;
 
@@ -0,0 +1,304 @@
+// Boost.Geometry Index
+//
+// R-tree path query visitor implementation
+//
+// Copyright (c) 2026 agent.
+//
+// Use, modification and distribution is subject to the Boost Software License,
+// Version 1.0. (See accompanying file LICENSE_1_0.txt or copy at
+// http://www.boost.org/LICENSE_1_0.txt)
+
+#ifndef BOOST_GEOMETRY_INDEX_DETAIL_RTREE_VISITORS_PATH_QUERY_HPP
+#define BOOST_GEOMETRY_INDEX_DETAIL_RTREE_VISITORS_PATH_QUERY_HPP
+
+namespace boost { namespace geometry { namespace index {
+
+namespace detail { namespace rtree { namespace visitors {
+
+// The k values closest to the begin of the path.
+// The segments of the path are prepared once for the whole query. In each node
+// the segments are tested in order against all children not intersected yet,
+// so the children are tested only against the segments preceding the first
+// intersection. The rest of segments isn't tested if the distance to the
+// begin of a segment is greater than the distance of the k-th value found so far.
+template <
+    typename Value,
+    typename Options,
+    typename Translator,
+    typename Box,
+    typename Allocators,
+    typename Predicates,
+    unsigned DistancePredicateIndex,
+    typename OutIter,
+    typename Statistics = index::detail::no_query_statistics
+>
+class path_query
+    : public rtree::visitor<Value, typename Options::parameters_type, Box, Allocators, typename Options::node_tag, true>::type
+{
+public:
+    typedef typename Options::parameters_type parameters_type;
+
+    typedef typename rtree::node<Value, parameters_type, Box, Allocators, typename Options::node_tag>::type node;
+    typedef typename rtree::internal_node<Value, parameters_type, Box, Allocators, typename Options::node_tag>::type internal_node;
+    typedef typename rtree::leaf<Value, parameters_type, Box, Allocators, typename Options::node_tag>::type leaf;
+
+    typedef index::detail::predicates_element<DistancePredicateIndex, Predicates> path_predicate_access;
+    typedef typename path_predicate_access::type path_predicate_type;
+    typedef typename indexable_type<Translator>::type indexable_type;
+
+    typedef index::detail::calculate_distance<path_predicate_type, Box, bounds_tag> calculate_node_distance;
+    typedef typename calculate_node_distance::result_type distance_type;
+
+    BOOST_MPL_ASSERT_MSG((boost::is_same<typename tag<indexable_type>::type, box_tag>::value),
+                         NOT_IMPLEMENTED_FOR_THIS_INDEXABLE,
+                         (indexable_type));
+
+    static const unsigned predicates_len = index::detail::predicates_length<Predicates>::value;
+    static const std::size_t dimension = geometry::dimension<Box>::value;
+
+    inline path_query(parameters_type const& parameters, Translator const& translator, Predicates const& pred, OutIter out_it,
+                      Statistics const& stats = Statistics())
+        : m_parameters(parameters), m_translator(translator)
+        , m_pred(pred)
+        , m_result(path_predicate_access::get(m_pred).count, out_it)
+        , m_stats(stats)
+    {
+        init_segments(path_predicate_access::get(m_pred).geometry);
+    }
+
+    inline void operator()(internal_node const& n)
+    {
+        typedef typename rtree::elements_type<internal_node>::type elements_type;
+        typedef typename elements_type::const_iterator elements_iterator;
+
+        typedef typename index::detail::rtree::container_from_elements_type<
+            elements_type,
+            std::pair<distance_type, typename Allocators::node_pointer>
+        >::type active_branch_list_type;
+        typedef typename index::detail::rtree::container_from_elements_type<
+            elements_type,
+            elements_iterator
+        >::type children_type;
+
+        elements_type const& elements = rtree::elements(n);
+
+        m_stats.visit_node();
+
+        // children meeting other predicates
+        children_type children;
+        children.reserve(m_parameters.get_max_elements());
+        for ( elements_iterator it = elements.begin() ; it != elements.end() ; ++it )
+        {
+            m_stats.check_predicates();
+
+            // 0 - dummy value
+            if ( index::detail::predicates_check<index::detail::bounds_tag, 0, predicates_len>(m_pred, 0, it->first) )
+                children.push_back(it);
+        }
+
+        active_branch_list_type active_branch_list;
+        active_branch_list.reserve(m_parameters.get_max_elements());
+
+        // test the segments against the children not intersected by previous segments
+        for ( typename segments_type::const_iterator sit = m_segments.begin() ;
+              sit != m_segments.end() && !children.empty() ; ++sit )
+        {
+            if ( is_prunable(sit->start) )
+                break;
+
+            for ( std::size_t i = 0 ; i < children.size() ; )
+            {
+                distance_type relative_distance;
+                if ( index::detail::box_ray_intersection(children[i]->first, sit->origin, sit->inv_dir, relative_distance) )
+                {
+                    distance_type const dist = sit->start + sit->length * relative_distance;
+                    if ( !is_prunable(dist) )
+                        active_branch_list.push_back(std::make_pair(dist, children[i]->second));
+
+                    children[i] = children.back();
+                    children.pop_back();
+                }
+                else
+                {
+                    ++i;
+                }
+            }
+        }
+
+        if ( active_branch_list.empty() )
+            return;
+
+        std::sort(active_branch_list.begin(), active_branch_list.end(), abl_less);
+
+        m_stats.push_branches(active_branch_list.size());
+
+        typename active_branch_list_type::const_iterator it = active_branch_list.begin();
+        for ( ; it != active_branch_list.end() ; ++it )
+        {
+            // the rest of nodes is further than the furthest value
+            if ( is_prunable(it->first) )
+                break;
+
+            m_stats.pop_branches(1);
+
+            rtree::apply_visitor(*this, *(it->second));
+        }
+
+        m_stats.pop_branches(active_branch_list.end() - it);
+    }
+
+    inline void operator()(leaf const& n)
+    {
+        typedef typename rtree::elements_type<leaf>::type elements_type;
+        elements_type const& elements = rtree::elements(n);
+
+        m_stats.visit_leaf();
+
+        for (typename elements_type::const_iterator it = elements.begin();
+            it != elements.end(); ++it)
+        {
+            m_stats.check_predicates();
+
+            Value const& v = *it;
+
+            if ( index::detail::predicates_check<index::detail::value_tag, 0, predicates_len>(m_pred, v, m_translator(v)) )
+            {
+                indexable_type const& indexable = m_translator(v);
+
+                for ( typename segments_type::const_iterator sit = m_segments.begin() ;
+                      sit != m_segments.end() && !is_prunable(sit->start) ; ++sit )
+                {
+                    distance_type relative_distance;
+                    if ( index::detail::box_ray_intersection(indexable, sit->origin, sit->inv_dir, relative_distance) )
+                    {
+                        m_result.store(v, sit->start + sit->length * relative_distance);
+                        break;
+                    }
+                }
+            }
+        }
+    }
+
+    inline size_t finish()
+    {
+        size_t const found_count = m_result.finish();
+        m_stats.found(found_count);
+        return found_count;
+    }
+
+private:
+    struct segment_data
+    {
+        distance_type origin[dimension];
+        distance_type inv_dir[dimension];
+        distance_type start;
+        distance_type length;
+    };
+
+    typedef std::vector<segment_data> segments_type;
+
+    template <typename Point>
+    inline void push_segment(Point const& p0, Point const& p1, distance_type const& start, distance_type const& length)
+    {
+        BOOST_STATIC_ASSERT(dimension == geometry::dimension<Point>::value);
+
+        segment_data s;
+        assign_segment_data<Point, 0>::apply(s, p0, p1);
+        s.start = start;
+        s.length = length;
+        m_segments.push_back(s);
+    }
+
+    template <typename Point, std::size_t I, std::size_t D = dimension>
+    struct assign_segment_data
+    {
+        static inline void apply(segment_data & s, Point const& p0, Point const& p1)
+        {
+            s.origin[I] = geometry::get<I>(p0);
+            s.inv_dir[I] = distance_type(1) / ( distance_type(geometry::get<I>(p1)) - distance_type(geometry::get<I>(p0)) );
+            assign_segment_data<Point, I + 1, D>::apply(s, p0, p1);
+        }
+    };
+
+    template <typename Point, std::size_t D>
+    struct assign_segment_data<Point, D, D>
+    {
+        static inline void apply(segment_data & , Point const& , Point const& ) {}
+    };
+
+    template <typename Geometry>
+    inline void init_segments(Geometry const& g)
+    {
+        init_segments(g, typename tag<Geometry>::type());
+    }
+
+    // the distance along a segment is relative
+    template <typename Segment>
+    inline void init_segments(Segment const& segment, segment_tag)
+    {
+        typedef typename point_type<Segment>::type point_type;
+        point_type p1, p2;
+        geometry::detail::assign_point_from_index<0>(segment, p1);
+        geometry::detail::assign_point_from_index<1>(segment, p2);
+        push_segment(p1, p2, 0, 1);
+    }
+
+    // the distance along a linestring of more than 2 points is the length,
+    // same as in path_intersection()
+    template <typename Linestring>
+    inline void init_segments(Linestring const& path, linestring_tag)
+    {
+        typedef typename ::boost::range_const_iterator<Linestring>::type const_iterator;
+
+        std::size_t const count = ::boost::size(path);
+        if ( count < 2 )
+            return;
+
+        m_segments.reserve(count - 1);
+
+        if ( count == 2 )
+        {
+            push_segment(*::boost::begin(path), *(::boost::begin(path) + 1), 0, 1);
+            return;
+        }
+
+        distance_type start = 0;
+        const_iterator it0 = ::boost::begin(path);
+        const_iterator it1 = ::boost::begin(path) + 1;
+        const_iterator last = ::boost::end(path);
+        for ( ; it1 != last ; ++it0, ++it1 )
+        {
+            distance_type const length = geometry::distance(*it0, *it1);
+            push_segment(*it0, *it1, start, length);
+            start += length;
+        }
+    }
+
+    inline bool is_prunable(distance_type const& d) const
+    {
+        return m_result.has_enough_neighbors()
+            && m_result.greatest_comparable_distance() <= d;
+    }
+
+    static inline bool abl_less(
+        std::pair<distance_type, typename Allocators::node_pointer> const& p1,
+        std::pair<distance_type, typename Allocators::node_pointer> const& p2)
+    {
+        return p1.first < p2.first;
+    }
+
+    parameters_type const& m_parameters;
+    Translator const& m_translator;
+
+    Predicates m_pred;
+    distance_query_result<Value, Translator, distance_type, OutIter> m_result;
+    segments_type m_segments;
+
+    Statistics m_stats;
+};
+
+}}} // namespace detail::rtree::visitors
+
+}}} // namespace boost::geometry::index
+
+#endif // BOOST_GEOMETRY_INDEX_DETAIL_RTREE_VISITORS_PATH_QUERY_HPP
@@ -100,6 +100,8 @@ public:
                 m_is_underflow = store_underflowed_node(elements, underfl_el_it, relative_level);                       // MAY THROW (E: alloc, copy)
             }
 
+            rtree::update_aggregate<Value, Options, Box, Allocators>::apply(n, m_parameters);
+
             // n is not root - adjust aabb
             if ( 0 != m_parent )
             {
@@ -140,7 +142,9 @@ public:
         // find value and remove it
         for ( typename elements_type::iterator it = elements.begin() ; it != elements.end() ; ++it )
         {
-            if ( m_translator.equals(*it, m_value) )
+            // bound to a copy of the value if the elements aren't stored as values
+            Value const& v = *it;
+            if ( m_translator.equals(v, m_value) )
             {
                 rtree::move_from_back(elements, it);                                                           // MAY THROW (V: copy)
                 elements.pop_back();
@@ -157,6 +161,8 @@ public:
             // calc underflow
             m_is_underflow = elements.size() < m_parameters.get_min_elements();
 
+            rtree::update_aggregate<Value, Options, Box, Allocators>::apply(n, m_parameters);
+
             // n is not root - adjust aabb
             if ( 0 != m_parent )
             {
@@ -285,12 +291,15 @@ private:
         {
             for ( ; it != elements.end() ; ++it )
             {
+                // bound to a copy of the element if the elements aren't stored as values
+                typename elements_type::value_type const& element = *it;
+
                 visitors::insert<
                     typename elements_type::value_type,
                     Value, Options, Translator, Box, Allocators,
                     typename Options::insert_tag
                 > insert_v(
-                    m_root_node, m_leafs_level, *it,
+                    m_root_node, m_leafs_level, element,
                     m_parameters, m_translator, m_allocators,
                     node_relative_level - 1);
 
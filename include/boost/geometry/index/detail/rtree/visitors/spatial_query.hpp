@@ -15,7 +15,8 @@ namespace boost { namespace geometry { namespace index {
 
 namespace detail { namespace rtree { namespace visitors {
 
-template <typename Value, typename Options, typename Translator, typename Box, typename Allocators, typename Predicates, typename OutIter>
+template <typename Value, typename Options, typename Translator, typename Box, typename Allocators, typename Predicates, typename OutIter,
+          typename Statistics = index::detail::no_query_statistics>
 struct spatial_query
     : public rtree::visitor<Value, typename Options::parameters_type, Box, Allocators, typename Options::node_tag, true>::type
 {
@@ -27,8 +28,9 @@ struct spatial_query
 
     static const unsigned predicates_len = index::detail::predicates_length<Predicates>::value;
 
-    inline spatial_query(Translator const& t, Predicates const& p, OutIter out_it)
-        : tr(t), pred(p), out_iter(out_it), found_count(0)
+    inline spatial_query(Translator const& t, Predicates const& p, OutIter out_it,
+                         Statistics const& s = Statistics())
+        : tr(t), pred(p), out_iter(out_it), found_count(0), stats(s)
     {}
 
     inline void operator()(internal_node const& n)
@@ -36,10 +38,14 @@ struct spatial_query
         typedef typename rtree::elements_type<internal_node>::type elements_type;
         elements_type const& elements = rtree::elements(n);
 
+        stats.visit_node();
+
         // traverse nodes meeting predicates
         for (typename elements_type::const_iterator it = elements.begin();
             it != elements.end(); ++it)
         {
+            stats.check_predicates();
+
             // if node meets predicates
             // 0 - dummy value
             if ( index::detail::predicates_check<index::detail::bounds_tag, 0, predicates_len>(pred, 0, it->first) )
@@ -52,27 +58,72 @@ struct spatial_query
         typedef typename rtree::elements_type<leaf>::type elements_type;
         elements_type const& elements = rtree::elements(n);
 
+        stats.visit_leaf();
+
+        this->query_values(elements,
+            boost::mpl::bool_<rtree::separate_indexables<elements_type, Translator>::value>());
+    }
+
+private:
+    template <typename Elements>
+    inline void query_values(Elements const& elements, boost::mpl::false_ /*separate_indexables*/)
+    {
         // get all values meeting predicates
-        for (typename elements_type::const_iterator it = elements.begin();
+        for (typename Elements::const_iterator it = elements.begin();
             it != elements.end(); ++it)
         {
+            stats.check_predicates();
+
+            Value const& v = *it;
+
             // if value meets predicates
-            if ( index::detail::predicates_check<index::detail::value_tag, 0, predicates_len>(pred, *it, tr(*it)) )
+            if ( index::detail::predicates_check<index::detail::value_tag, 0, predicates_len>(pred, v, tr(v)) )
+                this->found(v);
+        }
+    }
+
+    // the predicates of Indexables are checked in the array of Indexables,
+    // values are created only for the Indexables meeting them
+    template <typename Elements>
+    inline void query_values(Elements const& elements, boost::mpl::true_ /*separate_indexables*/)
+    {
+        typedef typename Elements::first_type indexable_type;
+        indexable_type const* indexables = elements.firsts();
+
+        for (size_type i = 0 ; i < elements.size() ; ++i)
+        {
+            stats.check_predicates();
+
+            // 0 - dummy value
+            if ( index::detail::predicates_check<index::detail::indexable_tag, 0, predicates_len>(pred, 0, indexables[i]) )
             {
-                *out_iter = *it;
-                ++out_iter;
+                Value const v = elements[i];
 
-                ++found_count;
+                if ( index::detail::predicates_check<index::detail::value_only_tag, 0, predicates_len>(pred, v, indexables[i]) )
+                    this->found(v);
             }
         }
     }
 
+    inline void found(Value const& v)
+    {
+        *out_iter = v;
+        ++out_iter;
+
+        ++found_count;
+        stats.found(1);
+    }
+
+public:
+
     Translator const& tr;
 
     Predicates pred;
 
     OutIter out_iter;
     size_type found_count;
+
+    Statistics stats;
 };
 
 template <typename Value, typename Options, typename Translator, typename Box, typename Allocators, typename Predicates>
@@ -91,6 +142,7 @@ public:
     typedef typename rtree::elements_type<internal_node>::type::const_iterator internal_iterator;
     typedef typename rtree::elements_type<leaf>::type leaf_elements;
     typedef typename rtree::elements_type<leaf>::type::const_iterator leaf_iterator;
+    typedef rtree::element_handle<leaf_elements> value_handle;
 
     static const unsigned predicates_len = index::detail::predicates_length<Predicates>::value;
 
@@ -98,6 +150,7 @@ public:
         : m_translator(::boost::addressof(t))
         , m_pred(p)
         , m_values(0)
+        , m_current_value()
     {}
 
     inline void operator()(internal_node const& n)
@@ -117,7 +170,7 @@ public:
     const_reference dereference() const
     {
         BOOST_GEOMETRY_INDEX_ASSERT(m_values, "not dereferencable");
-        return *m_current;
+        return value_handle::get(m_current_value);
     }
 
     void initialize(node_pointer root)
@@ -142,9 +195,12 @@ public:
                 if ( m_current != m_values->end() )
                 {
                     // return if next value is found
-                    Value const& v = *m_current;
-                    if ( index::detail::predicates_check<index::detail::value_tag, 0, predicates_len>(m_pred, v, (*m_translator)(v)) )
+                    if ( this->check_current(
+                            boost::mpl::bool_<rtree::separate_indexables<leaf_elements, Translator>::value>()) )
+                    {
+                        m_current_value = value_handle::make(*m_values, m_current);
                         return;
+                    }
 
                     ++m_current;
                 }
@@ -183,6 +239,26 @@ public:
         return 0 == m_values;
     }
 
+private:
+    inline bool check_current(boost::mpl::false_ /*separate_indexables*/) const
+    {
+        Value const& v = *m_current;
+        return index::detail::predicates_check<index::detail::value_tag, 0, predicates_len>(m_pred, v, (*m_translator)(v));
+    }
+
+    // the value is created only if its Indexable meets the predicates
+    inline bool check_current(boost::mpl::true_ /*separate_indexables*/) const
+    {
+        typedef typename leaf_elements::first_type indexable_type;
+        indexable_type const& i = m_values->firsts()[m_current.index()];
+
+        // 0 - dummy value
+        return index::detail::predicates_check<index::detail::indexable_tag, 0, predicates_len>(m_pred, 0, i)
+            && index::detail::predicates_check<index::detail::value_only_tag, 0, predicates_len>(m_pred, *m_current, i);
+    }
+
+public:
+
     friend bool operator==(spatial_query_incremental const& l, spatial_query_incremental const& r)
     {
         return (l.m_values == r.m_values) && (0 == l.m_values || l.m_current == r.m_current );
@@ -197,6 +273,7 @@ private:
     std::vector< std::pair<internal_iterator, internal_iterator> > m_internal_stack;
     const leaf_elements * m_values;
     leaf_iterator m_current;
+    typename value_handle::type m_current_value;
 };
 
 }}} // namespace detail::rtree::visitors
@@ -17,6 +17,9 @@ namespace detail {
 
 struct value_tag {};
 struct bounds_tag {};
+struct covered_bounds_tag {};
+struct indexable_tag {};
+struct value_only_tag {};
 
 } // namespace detail
 
@@ -0,0 +1,900 @@
+// Boost.Geometry Index
+//
+// Uniform grid implementation
+//
+// Copyright (c) 2026 agent.
+//
+// Use, modification and distribution is subject to the Boost Software License,
+// Version 1.0. (See accompanying file LICENSE_1_0.txt or copy at
+// http://www.boost.org/LICENSE_1_0.txt)
+
+#ifndef BOOST_GEOMETRY_INDEX_GRID_HPP
+#define BOOST_GEOMETRY_INDEX_GRID_HPP
+
+// STD
+#include <iterator>
+
+// Boost
+#include <boost/mpl/bool.hpp>
+#include <boost/mpl/if.hpp>
+#include <boost/range.hpp>
+#include <boost/swap.hpp>
+#include <boost/type_traits/is_convertible.hpp>
+
+// Boost.Geometry
+#include <boost/geometry/algorithms/detail/comparable_distance/interface.hpp>
+#include <boost/geometry/algorithms/centroid.hpp>
+#include <boost/geometry/algorithms/covered_by.hpp>
+#include <boost/geometry/algorithms/disjoint.hpp>
+#include <boost/geometry/algorithms/equals.hpp>
+#include <boost/geometry/algorithms/intersects.hpp>
+#include <boost/geometry/algorithms/overlaps.hpp>
+#include <boost/geometry/algorithms/touches.hpp>
+#include <boost/geometry/algorithms/within.hpp>
+
+#include <boost/geometry/geometries/point.hpp>
+#include <boost/geometry/geometries/box.hpp>
+
+#include <boost/geometry/strategies/strategies.hpp>
+
+// Boost.Geometry.Index
+#include <boost/geometry/index/detail/config_begin.hpp>
+
+#include <boost/geometry/index/detail/assert.hpp>
+
+#include <boost/geometry/index/indexable.hpp>
+#include <boost/geometry/index/equal_to.hpp>
+
+#include <boost/geometry/index/detail/translator.hpp>
+
+#include <boost/geometry/index/predicates.hpp>
+#include <boost/geometry/index/distance_predicates.hpp>
+
+#include <boost/geometry/index/detail/meta.hpp>
+#include <boost/geometry/index/detail/utilities.hpp>
+
+#include <boost/geometry/index/detail/algorithms/is_valid.hpp>
+
+#include <boost/geometry/index/detail/grid/cells.hpp>
+#include <boost/geometry/index/detail/grid/query_iterators.hpp>
+#include <boost/geometry/index/detail/grid/adaptors.hpp>
+
+/*!
+\defgroup grid_functions Grid free functions (boost::geometry::index::)
+*/
+
+namespace boost { namespace geometry { namespace index {
+
+/*!
+\brief The uniform grid spatial index.
+
+The alternative to the R-tree for the data which is distributed roughly uniformly in a known
+domain, e.g. moving points in a simulation. The domain is divided into the same number of cells
+in each dimension and each value is stored in the cell containing the center of its Indexable.
+Values outside the domain are stored in the closest border cells. The insertion and removal are
+therefore cheap and don't reorganize the structure. The bounds of the cells are hierarchically
+grouped like in a quadtree (or octree) so the queries visit only the cells containing values
+meeting the predicates.
+
+The grid supports the same predicates and the same query interface as the R-tree, i.e.
+query(), qbegin() and qend().
+
+\par IndexableGetter
+The object of IndexableGetter type translates from Value to Indexable each time the grid requires it.
+See the description of the \c rtree.
+
+\par EqualTo
+The object of EqualTo type compares Values and returns <tt>true</tt> if they're equal.
+See the description of the \c rtree.
+
+\tparam Value           The type of objects stored in the container.
+\tparam IndexableGetter The function object extracting Indexable from Value.
+\tparam EqualTo         The function object comparing objects of type Value.
+\tparam Allocator       The allocator used to allocate/deallocate memory, construct/destroy cells and Values.
+*/
+template <
+    typename Value,
+    typename IndexableGetter = index::indexable<Value>,
+    typename EqualTo = index::equal_to<Value>,
+    typename Allocator = std::allocator<Value>
+>
+class grid
+{
+public:
+    /*! \brief The type of Value stored in the container. */
+    typedef Value value_type;
+    /*! \brief The function object extracting Indexable from Value. */
+    typedef IndexableGetter indexable_getter;
+    /*! \brief The function object comparing objects of type Value. */
+    typedef EqualTo value_equal;
+    /*! \brief The type of allocator used by the container. */
+    typedef Allocator allocator_type;
+
+    /*! \brief The Indexable type to which Value is translated. */
+    typedef typename index::detail::indexable_type<
+        detail::translator<IndexableGetter, EqualTo>
+    >::type indexable_type;
+
+    /*! \brief The Box type used by the grid. */
+    typedef geometry::model::box<
+                geometry::model::point<
+                    typename coordinate_type<indexable_type>::type,
+                    dimension<indexable_type>::value,
+                    typename coordinate_system<indexable_type>::type
+                >
+            >
+    bounds_type;
+
+private:
+
+    typedef detail::translator<IndexableGetter, EqualTo> translator_type;
+    typedef detail::grid::cells<value_type, bounds_type, allocator_type> cells_type;
+    typedef detail::grid::query_iterator_types<value_type, allocator_type> query_iterator_types;
+
+public:
+
+    /*! \brief Type of reference to const Value. */
+    typedef Value const& const_reference;
+    /*! \brief Type of difference type. */
+    typedef typename query_iterator_types::difference_type difference_type;
+    /*! \brief Unsigned integral type used by the container. */
+    typedef typename cells_type::size_type size_type;
+
+    /*! \brief Type of const query iterator. */
+    typedef index::detail::rtree::iterators::query_iterator<value_type, query_iterator_types> const_query_iterator;
+
+public:
+
+    /*!
+    \brief The constructor.
+
+    The number of cells in each dimension is rounded up to the power of 2.
+
+    \param domain               The box in which the values are expected.
+    \param cells_per_dimension  The number of cells in each dimension.
+    \param getter               The function object extracting Indexable from Value.
+    \param equal                The function object comparing Values.
+    \param allocator            The allocator object.
+
+    \par Throws
+    If allocation throws.
+    */
+    inline explicit grid(bounds_type const& domain,
+                         size_type cells_per_dimension = 64,
+                         indexable_getter const& getter = indexable_getter(),
+                         value_equal const& equal = value_equal(),
+                         allocator_type const& allocator = allocator_type())
+        : m_translator(getter, equal)
+        , m_cells(domain, cells_per_dimension, allocator)
+        , m_values_count(0)
+        , m_allocator(allocator)
+    {}
+
+    /*!
+    \brief The constructor.
+
+    \param first                The beginning of the range of Values.
+    \param last                 The end of the range of Values.
+    \param domain               The box in which the values are expected.
+    \param cells_per_dimension  The number of cells in each dimension.
+    \param getter               The function object extracting Indexable from Value.
+    \param equal                The function object comparing Values.
+    \param allocator            The allocator object.
+
+    \par Throws
+    \li If Value copy constructor throws.
+    \li If allocation throws.
+    */
+    template<typename Iterator>
+    inline grid(Iterator first, Iterator last,
+                bounds_type const& domain,
+                size_type cells_per_dimension = 64,
+                indexable_getter const& getter = indexable_getter(),
+                value_equal const& equal = value_equal(),
+                allocator_type const& allocator = allocator_type())
+        : m_translator(getter, equal)
+        , m_cells(domain, cells_per_dimension, allocator)
+        , m_values_count(0)
+        , m_allocator(allocator)
+    {
+        this->insert(first, last);
+    }
+
+    /*!
+    \brief The constructor.
+
+    \param rng                  The range of Values.
+    \param domain               The box in which the values are expected.
+    \param cells_per_dimension  The number of cells in each dimension.
+    \param getter               The function object extracting Indexable from Value.
+    \param equal                The function object comparing Values.
+    \param allocator            The allocator object.
+
+    \par Throws
+    \li If Value copy constructor throws.
+    \li If allocation throws.
+    */
+    template<typename Range>
+    inline grid(Range const& rng,
+                bounds_type const& domain,
+                size_type cells_per_dimension = 64,
+                indexable_getter const& getter = indexable_getter(),
+                value_equal const& equal = value_equal(),
+                allocator_type const& allocator = allocator_type())
+        : m_translator(getter, equal)
+        , m_cells(domain, cells_per_dimension, allocator)
+        , m_values_count(0)
+        , m_allocator(allocator)
+    {
+        this->insert(::boost::begin(rng), ::boost::end(rng));
+    }
+
+    /*!
+    \brief Insert a value to the index.
+
+    \param value    The value which will be stored in the container.
+
+    \par Throws
+    \li If Value copy constructor throws.
+    \li If allocation throws.
+    */
+    inline void insert(value_type const& value)
+    {
+        BOOST_GEOMETRY_INDEX_ASSERT(detail::is_valid(m_translator(value)),
+                                    "Indexable is invalid");
+
+        m_cells.insert(m_cells.leaf_index(m_translator(value)), value, m_translator(value));     // MAY THROW (V, A)
+        ++m_values_count;
+    }
+
+    /*!
+    \brief Insert a range of values to the index.
+
+    \param first    The beginning of the range of values.
+    \param last     The end of the range of values.
+
+    \par Throws
+    \li If Value copy constructor throws.
+    \li If allocation throws.
+    */
+    template <typename Iterator>
+    inline void insert(Iterator first, Iterator last)
+    {
+        for ( ; first != last ; ++first )
+            this->insert(*first);
+    }
+
+    /*!
+    \brief Insert a value created using convertible object or a range of values to the index.
+
+    \param conv_or_rng      An object of type convertible to value_type or a range of values.
+
+    \par Throws
+    \li If Value copy constructor throws.
+    \li If allocation throws.
+    */
+    template <typename ConvertibleOrRange>
+    inline void insert(ConvertibleOrRange const& conv_or_rng)
+    {
+        typedef boost::mpl::bool_
+            <
+                boost::is_convertible<ConvertibleOrRange, value_type>::value
+            > is_conv_t;
+
+        this->insert_dispatch(conv_or_rng, is_conv_t());
+    }
+
+    /*!
+    \brief Remove a value from the container.
+
+    In contrast to the \c std::set or <tt>std::map erase()</tt> method
+    this method removes only one value from the container.
+
+    \param value    The value which will be removed from the container.
+
+    \return         1 if the value was removed, 0 otherwise.
+
+    \par Throws
+    If Value copy assignment throws.
+    */
+    inline size_type remove(value_type const& value)
+    {
+        size_type const i = m_cells.leaf_index(m_translator(value));
+        typename cells_type::values_type const& values = m_cells.values(i);
+
+        for ( size_type pos = 0 ; pos < values.size() ; ++pos )
+        {
+            if ( m_translator.equals(values[pos], value) )
+            {
+                m_cells.erase(i, pos, m_translator);                                                // MAY THROW (V)
+                --m_values_count;
+                return 1;
+            }
+        }
+
+        return 0;
+    }
+
+    /*!
+    \brief Remove a range of values from the container.
+
+    It removes values equal to these passed as a range. This method removes only one
+    value for each one passed in the range, not all equal values.
+
+    \param first    The beginning of the range of values.
+    \param last     The end of the range of values.
+
+    \return         The number of removed values.
+
+    \par Throws
+    If Value copy assignment throws.
+    */
+    template <typename Iterator>
+    inline size_type remove(Iterator first, Iterator last)
+    {
+        size_type result = 0;
+        for ( ; first != last ; ++first )
+            result += this->remove(*first);
+        return result;
+    }
+
+    /*!
+    \brief Remove value corresponding to an object convertible to it or a range of values from the container.
+
+    \param conv_or_rng      The object of type convertible to value_type or a range of values.
+
+    \return         The number of removed values.
+
+    \par Throws
+    If Value copy assignment throws.
+    */
+    template <typename ConvertibleOrRange>
+    inline size_type remove(ConvertibleOrRange const& conv_or_rng)
+    {
+        typedef boost::mpl::bool_
+            <
+                boost::is_convertible<ConvertibleOrRange, value_type>::value
+            > is_conv_t;
+
+        return this->remove_dispatch(conv_or_rng, is_conv_t());
+    }
+
+    /*!
+    \brief Finds values meeting passed predicates e.g. nearest to some Point and/or intersecting some Box.
+
+    This query function performs spatial and k-nearest neighbor searches in the same way as
+    <tt>rtree::query()</tt>, the same predicates may be passed.
+
+    \par Throws
+    If Value copy constructor or copy assignment throws.
+    If allocation throws.
+
+    \warning
+    Only one \c nearest() perdicate may be passed to the query. Passing more of them results in compile-time error.
+
+    \param predicates   Predicates.
+    \param out_it       The output iterator, e.g. generated by std::back_inserter().
+
+    \return             The number of values found.
+    */
+    template <typename Predicates, typename OutIter>
+    size_type query(Predicates const& predicates, OutIter out_it) const
+    {
+        static const unsigned distance_predicates_count = detail::predicates_count_distance<Predicates>::value;
+        BOOST_MPL_ASSERT_MSG((distance_predicates_count <= 1), PASS_ONLY_ONE_DISTANCE_PREDICATE, (Predicates));
+
+        size_type result = 0;
+        for ( typename qbegin_result<Predicates>::type it = qbegin_(predicates) ; !it.is_end() ; ++it, ++result )
+        {
+            *out_it = *it;
+            ++out_it;
+        }
+        return result;
+    }
+
+    /*!
+    \brief Returns the query iterator pointing at the begin of the query range.
+
+    This method returns the iterator which may be used to perform iterative queries. For the information
+    about the predicates which may be passed to this method see query().
+
+    \par Throws
+    If predicates copy throws.
+    If allocation throws.
+
+    \param predicates   Predicates.
+
+    \return             The iterator pointing at the begin of the query range.
+    */
+    template <typename Predicates>
+    const_query_iterator qbegin(Predicates const& predicates) const
+    {
+        return const_query_iterator(qbegin_(predicates));
+    }
+
+    /*!
+    \brief Returns the query iterator pointing at the end of the query range.
+
+    \par Throws
+    Nothing
+
+    \return             The iterator pointing at the end of the query range.
+    */
+    const_query_iterator qend() const
+    {
+        return const_query_iterator();
+    }
+
+    /*!
+    \brief Returns the number of stored values.
+
+    \return         The number of stored values.
+
+    \par Throws
+    Nothing.
+    */
+    inline size_type size() const
+    {
+        return m_values_count;
+    }
+
+    /*!
+    \brief Query if the container is empty.
+
+    \return         true if the container is empty.
+
+    \par Throws
+    Nothing.
+    */
+    inline bool empty() const
+    {
+        return 0 == m_values_count;
+    }
+
+    /*!
+    \brief Removes all values stored in the container.
+
+    The cells are kept.
+
+    \par Throws
+    Nothing.
+    */
+    inline void clear()
+    {
+        m_cells.clear();
+        m_values_count = 0;
+    }
+
+    /*!
+    \brief Returns the box able to contain all values stored in the container.
+
+    Returns the box able to contain all values stored in the container.
+    If the container is empty the result of \c geometry::assign_inverse() is returned.
+
+    \return     The box able to contain all values stored in the container or an invalid box if
+                there are no values in the container.
+
+    \par Throws
+    Nothing.
+    */
+    inline bounds_type bounds() const
+    {
+        return m_cells.box(0, 0);
+    }
+
+    /*!
+    \brief Returns the domain passed in the constructor.
+
+    \return     The box divided into cells.
+
+    \par Throws
+    Nothing.
+    */
+    inline bounds_type const& domain() const
+    {
+        return m_cells.domain();
+    }
+
+    /*!
+    \brief Swaps contents of two grids.
+
+    \param other    The grid which content will be swapped with this grid content.
+
+    \par Throws
+    If allocators swap throws.
+    */
+    void swap(grid & other)
+    {
+        boost::swap(m_translator, other.m_translator);
+        m_cells.swap(other.m_cells);
+        boost::swap(m_values_count, other.m_values_count);
+        boost::swap(m_allocator, other.m_allocator);
+    }
+
+    /*!
+    \brief Returns the function object used to extract the Indexable from the Value.
+
+    \return     The indexable_getter object.
+
+    \par Throws
+    Nothing.
+    */
+    indexable_getter indexable_get() const
+    {
+        return m_translator;
+    }
+
+    /*!
+    \brief Returns the function object used to compare Values.
+
+    \return     The value_equal function.
+
+    \par Throws
+    Nothing.
+    */
+    value_equal value_eq() const
+    {
+        return m_translator;
+    }
+
+    /*!
+    \brief Returns allocator used by the grid.
+
+    \return     The allocator.
+
+    \par Throws
+    If allocator copy constructor throws.
+    */
+    allocator_type get_allocator() const
+    {
+        return m_allocator;
+    }
+
+#ifndef BOOST_GEOMETRY_INDEX_DETAIL_EXPERIMENTAL
+private:
+#endif
+    template <typename Predicates>
+    struct qbegin_result
+    {
+        typedef typename boost::mpl::if_c<
+            detail::predicates_count_distance<Predicates>::value == 0,
+            detail::grid::spatial_query_iterator<value_type, translator_type, cells_type, Predicates, query_iterator_types>,
+            detail::grid::distance_query_iterator<
+                value_type, translator_type, bounds_type, cells_type, Predicates,
+                detail::predicates_find_distance<Predicates>::value, query_iterator_types
+            >
+        >::type type;
+    };
+
+    /*!
+    \brief Returns the query iterator of the type specific to the Predicates.
+
+    \param predicates   Predicates.
+
+    \return             The iterator pointing at the begin of the query range.
+    */
+    template <typename Predicates>
+    typename qbegin_result<Predicates>::type
+    qbegin_(Predicates const& predicates) const
+    {
+        static const unsigned distance_predicates_count = detail::predicates_count_distance<Predicates>::value;
+        BOOST_MPL_ASSERT_MSG((distance_predicates_count <= 1), PASS_ONLY_ONE_DISTANCE_PREDICATE, (Predicates));
+
+        typedef typename qbegin_result<Predicates>::type iterator_type;
+
+        if ( 0 == m_values_count )
+            return iterator_type(m_translator, predicates);
+
+        return iterator_type(m_cells, m_translator, predicates);
+    }
+
+private:
+    template <typename ValueConvertible>
+    inline void insert_dispatch(ValueConvertible const& val_conv,
+                                boost::mpl::bool_<true> const& /*is_convertible*/)
+    {
+        this->insert(value_type(val_conv));
+    }
+
+    template <typename Range>
+    inline void insert_dispatch(Range const& rng,
+                                boost::mpl::bool_<false> const& /*is_convertible*/)
+    {
+        BOOST_MPL_ASSERT_MSG((detail::is_range<Range>::value),
+                             PASSED_OBJECT_IS_NOT_CONVERTIBLE_TO_VALUE_NOR_A_RANGE,
+                             (Range));
+
+        this->insert(boost::const_begin(rng), boost::const_end(rng));
+    }
+
+    template <typename ValueConvertible>
+    inline size_type remove_dispatch(ValueConvertible const& val_conv,
+                                     boost::mpl::bool_<true> const& /*is_convertible*/)
+    {
+        return this->remove(value_type(val_conv));
+    }
+
+    template <typename Range>
+    inline size_type remove_dispatch(Range const& rng,
+                                     boost::mpl::bool_<false> const& /*is_convertible*/)
+    {
+        BOOST_MPL_ASSERT_MSG((detail::is_range<Range>::value),
+                             PASSED_OBJECT_IS_NOT_CONVERTIBLE_TO_VALUE_NOR_A_RANGE,
+                             (Range));
+
+        return this->remove(boost::const_begin(rng), boost::const_end(rng));
+    }
+
+    translator_type m_translator;
+    cells_type m_cells;
+    size_type m_values_count;
+    allocator_type m_allocator;
+};
+
+/*!
+\brief Insert a value to the index.
+
+It calls <tt>grid::insert(value_type const&)</tt>.
+
+\ingroup grid_functions
+
+\param g    The spatial index.
+\param v    The value which will be stored in the index.
+*/
+template <typename Value, typename IndexableGetter, typename EqualTo, typename Allocator>
+inline void insert(grid<Value, IndexableGetter, EqualTo, Allocator> & g, Value const& v)
+{
+    g.insert(v);
+}
+
+/*!
+\brief Insert a range of values to the index.
+
+It calls <tt>grid::insert(Iterator, Iterator)</tt>.
+
+\ingroup grid_functions
+
+\param g        The spatial index.
+\param first    The beginning of the range of values.
+\param last     The end of the range of values.
+*/
+template<typename Value, typename IndexableGetter, typename EqualTo, typename Allocator,
+         typename Iterator>
+inline void insert(grid<Value, IndexableGetter, EqualTo, Allocator> & g,
+                   Iterator first, Iterator last)
+{
+    g.insert(first, last);
+}
+
+/*!
+\brief Insert a value created using convertible object or a range of values to the index.
+
+It calls <tt>grid::insert(ConvertibleOrRange const&)</tt>.
+
+\ingroup grid_functions
+
+\param g                The spatial index.
+\param conv_or_rng      The object of type convertible to value_type or a range of values.
+*/
+template<typename Value, typename IndexableGetter, typename EqualTo, typename Allocator,
+         typename ConvertibleOrRange>
+inline void insert(grid<Value, IndexableGetter, EqualTo, Allocator> & g,
+                   ConvertibleOrRange const& conv_or_rng)
+{
+    g.insert(conv_or_rng);
+}
+
+/*!
+\brief Remove a value from the container.
+
+It calls <tt>grid::remove(value_type const&)</tt>.
+
+\ingroup grid_functions
+
+\param g    The spatial index.
+\param v    The value which will be removed from the index.
+
+\return     1 if value was removed, 0 otherwise.
+*/
+template <typename Value, typename IndexableGetter, typename EqualTo, typename Allocator>
+inline typename grid<Value, IndexableGetter, EqualTo, Allocator>::size_type
+remove(grid<Value, IndexableGetter, EqualTo, Allocator> & g, Value const& v)
+{
+    return g.remove(v);
+}
+
+/*!
+\brief Remove a range of values from the container.
+
+It calls <tt>grid::remove(Iterator, Iterator)</tt>.
+
+\ingroup grid_functions
+
+\param g        The spatial index.
+\param first    The beginning of the range of values.
+\param last     The end of the range of values.
+
+\return         The number of removed values.
+*/
+template<typename Value, typename IndexableGetter, typename EqualTo, typename Allocator,
+         typename Iterator>
+inline typename grid<Value, IndexableGetter, EqualTo, Allocator>::size_type
+remove(grid<Value, IndexableGetter, EqualTo, Allocator> & g,
+       Iterator first, Iterator last)
+{
+    return g.remove(first, last);
+}
+
+/*!
+\brief Remove a value corresponding to an object convertible to it or a range of values from the container.
+
+It calls <tt>grid::remove(ConvertibleOrRange const&)</tt>.
+
+\ingroup grid_functions
+
+\param g                The spatial index.
+\param conv_or_rng      The object of type convertible to value_type or the range of values.
+
+\return         The number of removed values.
+*/
+template<typename Value, typename IndexableGetter, typename EqualTo, typename Allocator,
+         typename ConvertibleOrRange>
+inline typename grid<Value, IndexableGetter, EqualTo, Allocator>::size_type
+remove(grid<Value, IndexableGetter, EqualTo, Allocator> & g,
+       ConvertibleOrRange const& conv_or_rng)
+{
+    return g.remove(conv_or_rng);
+}
+
+/*!
+\brief Finds values meeting passed predicates e.g. nearest to some Point and/or intersecting some Box.
+
+It calls <tt>grid::query(Predicates const&, OutIter)</tt>.
+
+\ingroup grid_functions
+
+\param g            The grid.
+\param predicates   Predicates.
+\param out_it       The output iterator, e.g. generated by std::back_inserter().
+
+\return             The number of values found.
+*/
+template <typename Value, typename IndexableGetter, typename EqualTo, typename Allocator,
+          typename Predicates, typename OutIter> inline
+typename grid<Value, IndexableGetter, EqualTo, Allocator>::size_type
+query(grid<Value, IndexableGetter, EqualTo, Allocator> const& g,
+      Predicates const& predicates,
+      OutIter out_it)
+{
+    return g.query(predicates, out_it);
+}
+
+/*!
+\brief Returns the query iterator pointing at the begin of the query range.
+
+It calls <tt>grid::qbegin(Predicates const&)</tt>.
+
+\ingroup grid_functions
+
+\param g            The grid.
+\param predicates   Predicates.
+
+\return             The iterator pointing at the begin of the query range.
+*/
+template <typename Value, typename IndexableGetter, typename EqualTo, typename Allocator,
+          typename Predicates> inline
+typename grid<Value, IndexableGetter, EqualTo, Allocator>::const_query_iterator
+qbegin(grid<Value, IndexableGetter, EqualTo, Allocator> const& g,
+       Predicates const& predicates)
+{
+    return g.qbegin(predicates);
+}
+
+/*!
+\brief Returns the query iterator pointing at the end of the query range.
+
+It calls <tt>grid::qend()</tt>.
+
+\ingroup grid_functions
+
+\return             The iterator pointing at the end of the query range.
+*/
+template <typename Value, typename IndexableGetter, typename EqualTo, typename Allocator> inline
+typename grid<Value, IndexableGetter, EqualTo, Allocator>::const_query_iterator
+qend(grid<Value, IndexableGetter, EqualTo, Allocator> const& g)
+{
+    return g.qend();
+}
+
+/*!
+\brief Remove all values from the index.
+
+It calls \c grid::clear().
+
+\ingroup grid_functions
+
+\param g        The spatial index.
+*/
+template <typename Value, typename IndexableGetter, typename EqualTo, typename Allocator>
+inline void clear(grid<Value, IndexableGetter, EqualTo, Allocator> & g)
+{
+    g.clear();
+}
+
+/*!
+\brief Get the number of values stored in the index.
+
+It calls \c grid::size().
+
+\ingroup grid_functions
+
+\param g        The spatial index.
+
+\return         The number of values stored in the index.
+*/
+template <typename Value, typename IndexableGetter, typename EqualTo, typename Allocator>
+inline size_t size(grid<Value, IndexableGetter, EqualTo, Allocator> const& g)
+{
+    return g.size();
+}
+
+/*!
+\brief Query if there are no values stored in the index.
+
+It calls \c grid::empty().
+
+\ingroup grid_functions
+
+\param g        The spatial index.
+
+\return         true if there are no values in the index.
+*/
+template <typename Value, typename IndexableGetter, typename EqualTo, typename Allocator>
+inline bool empty(grid<Value, IndexableGetter, EqualTo, Allocator> const& g)
+{
+    return g.empty();
+}
+
+/*!
+\brief Get the box containing all stored values or an invalid box if the index has no values.
+
+It calls \c grid::bounds().
+
+\ingroup grid_functions
+
+\param g        The spatial index.
+
+\return         The box containing all stored values or an invalid box.
+*/
+template <typename Value, typename IndexableGetter, typename EqualTo, typename Allocator>
+inline typename grid<Value, IndexableGetter, EqualTo, Allocator>::bounds_type
+bounds(grid<Value, IndexableGetter, EqualTo, Allocator> const& g)
+{
+    return g.bounds();
+}
+
+/*!
+\brief Exchanges the contents of the container with those of other.
+
+It calls \c grid::swap().
+
+\ingroup grid_functions
+
+\param l     The first grid.
+\param r     The second grid.
+*/
+template <typename Value, typename IndexableGetter, typename EqualTo, typename Allocator>
+inline void swap(grid<Value, IndexableGetter, EqualTo, Allocator> & l,
+                 grid<Value, IndexableGetter, EqualTo, Allocator> & r)
+{
+    l.swap(r);
+}
+
+}}} // namespace boost::geometry::index
+
+// TODO: don't include the implementation at the end of the file
+#include <boost/geometry/algorithms/detail/comparable_distance/implementation.hpp>
+
+#include <boost/geometry/index/detail/config_end.hpp>
+
+#endif // BOOST_GEOMETRY_INDEX_GRID_HPP
@@ -248,6 +248,121 @@ private:
     size_t m_overlap_cost_threshold;
 };
 
+/*!
+\brief R-tree parameters storing an additional summary of values in each node.
+
+Any other parameters may be augmented. The nodes of the r-tree store the result
+of the aggregation of all values stored in the subtree, which is maintained
+by insertion, removal and packing. The aggregate of the values meeting spatial
+predicates may then be calculated without traversing fully covered nodes.
+
+Aggregator must define the type of the result and three member functions:
+\li <tt>result_type identity() const</tt> - the neutral element,
+\li <tt>result_type apply(Value const&) const</tt> - the summary of a single value,
+\li <tt>result_type combine(result_type const&, result_type const&) const</tt> - associative
+    combination of two summaries (a monoid operation).
+
+\tparam Parameters     Parameters of r-tree creation algorithm, e.g. linear, dynamic_rstar.
+\tparam Aggregator     The type of the aggregator.
+*/
+template <typename Parameters, typename Aggregator>
+class augmented
+    : public Parameters
+{
+public:
+    typedef Parameters parameters_type;
+    typedef Aggregator aggregator_type;
+    typedef typename Aggregator::result_type aggregate_type;
+
+    /*!
+    \brief The constructor.
+
+    \param parameters     Parameters of r-tree creation algorithm.
+    \param aggregator     The aggregator.
+    */
+    explicit augmented(Parameters const& parameters = Parameters(),
+                       Aggregator const& aggregator = Aggregator())
+        : Parameters(parameters)
+        , m_aggregator(aggregator)
+    {}
+
+    Aggregator const& get_aggregator() const { return m_aggregator; }
+
+private:
+    Aggregator m_aggregator;
+};
+
+/*!
+\brief R-tree parameters storing the boxes of nodes using less precise coordinates.
+
+Any other parameters may be used. The boxes of child nodes stored in internal nodes
+use CoordinateType instead of the coordinate type of the Indexable, e.g. for a 2D index
+of points using \c double coordinates a box takes 16 bytes instead of 32. The values and
+their Indexables stored in leafs are not modified.
+
+The coordinates are rounded outwards so the boxes always contain the corresponding
+subtrees and the results of the queries are the same as for the full precision.
+Less precise boxes may only overlap more which could result in slower queries.
+Coordinates of Indexables beyond the range of CoordinateType are stored as infinities
+on the outer sides of the boxes and as the greatest finite values on the inner sides.
+
+If the parameters are also augmented, \c augmented should be the outer wrapper,
+e.g. <tt>augmented<reduced_precision<linear<16> >, Aggregator></tt>.
+
+\tparam Parameters     Parameters of r-tree creation algorithm, e.g. linear, dynamic_rstar.
+\tparam CoordinateType The floating point type of the coordinates of nodes' boxes.
+*/
+template <typename Parameters, typename CoordinateType = float>
+class reduced_precision
+    : public Parameters
+{
+public:
+    typedef Parameters parameters_type;
+    typedef CoordinateType coordinate_type;
+
+    /*!
+    \brief The constructor.
+
+    \param parameters     Parameters of r-tree creation algorithm.
+    */
+    explicit reduced_precision(Parameters const& parameters = Parameters())
+        : Parameters(parameters)
+    {}
+};
+
+/*!
+\brief R-tree parameters storing the Indexables and the rest of values in separate arrays in leafs.
+
+Any other parameters with compile-time maximum number of elements may be used, e.g. linear, rstar.
+The Value must be a \c std::pair. Leafs store the first members of values in one contiguous
+array and the second members in the other one, e.g. for <tt>std::pair<Box, uint32_t></tt> Boxes
+are not padded and the queries checking the Boxes read only the first array.
+
+Since the values aren't stored as \c std::pairs, the query iterators return the references to
+the copies of values which are valid until the iterator is incremented.
+
+If the parameters are also augmented, \c augmented should be the outer wrapper,
+e.g. <tt>augmented<soa_leafs<linear<16> >, Aggregator></tt>.
+
+\tparam Parameters     Parameters of r-tree creation algorithm, e.g. linear, rstar.
+*/
+template <typename Parameters>
+class soa_leafs
+    : public Parameters
+{
+public:
+    typedef Parameters parameters_type;
+
+    /*!
+    \brief The constructor.
+
+    \param parameters     Parameters of r-tree creation algorithm.
+    */
+    explicit soa_leafs(Parameters const& parameters = Parameters())
+        : Parameters(parameters)
+    {}
+};
+
 }}} // namespace boost::geometry::index
 
 #endif // BOOST_GEOMETRY_INDEX_PARAMETERS_HPP
@@ -295,6 +295,39 @@ nearest(Geometry const& geometry, unsigned k)
     return detail::nearest<Geometry>(geometry, k);
 }
 
+/*!
+\brief Generate nearest() predicate with the maximum distance.
+
+When this predicate is passed to the query, k-nearest neighbour search will be performed
+but only \c Values closer or equal to \c max_distance from the \c Geometry will be returned.
+Nodes further than \c max_distance are pruned from the start, so the query returns less than
+\c k \c Values if there isn't enough of them in range. If used with the query iterator
+the iteration stops at the \c max_distance.
+Internally \c max_distance is converted to the comparable distance of the default strategy
+used by boost::geometry::comparable_distance().
+
+\par Example
+\verbatim
+bgi::query(spatial_index, bgi::nearest(pt, 5, 10.0), std::back_inserter(result));
+bgi::query(spatial_index, bgi::nearest(pt, 5, 10.0) && bgi::intersects(box), std::back_inserter(result));
+\endverbatim
+
+\warning
+Only one \c nearest() predicate may be used in a query.
+
+\ingroup predicates
+
+\param geometry     The geometry from which distance is calculated.
+\param k            The maximum number of values to return.
+\param max_distance The maximum distance between the geometry and returned values.
+*/
+template <typename Geometry, typename Distance> inline
+detail::bounded_nearest<Geometry, Distance>
+nearest(Geometry const& geometry, unsigned k, Distance const& max_distance)
+{
+    return detail::bounded_nearest<Geometry, Distance>(geometry, k, max_distance);
+}
+
 #ifdef BOOST_GEOMETRY_INDEX_DETAIL_EXPERIMENTAL
 
 /*!
@@ -0,0 +1,108 @@
+// Boost.Geometry Index
+//
+// Query statistics
+//
+// Copyright (c) 2026 agent.
+//
+// Use, modification and distribution is subject to the Boost Software License,
+// Version 1.0. (See accompanying file LICENSE_1_0.txt or copy at
+// http://www.boost.org/LICENSE_1_0.txt)
+
+#ifndef BOOST_GEOMETRY_INDEX_QUERY_STATISTICS_HPP
+#define BOOST_GEOMETRY_INDEX_QUERY_STATISTICS_HPP
+
+#include <cstddef>
+
+namespace boost { namespace geometry { namespace index {
+
+/*!
+\brief The counters gathered during the queries.
+
+The object may be passed to the rtree::query() to gather the numbers of nodes
+visited and predicates checked. The counters are accumulated so the object may be
+passed to many queries. The queries performed without this object don't gather
+any statistics and their performance is not affected.
+
+\par Example
+\verbatim
+bgi::query_statistics stats;
+tree.query(bgi::intersects(box), std::back_inserter(result), stats);
+std::cout << stats.nodes_count << ' ' << stats.leafs_count << std::endl;
+\endverbatim
+*/
+struct query_statistics
+{
+    /*!
+    \brief Creates the object with all counters equal to 0.
+    */
+    query_statistics()
+        : nodes_count(0)
+        , leafs_count(0)
+        , predicates_count(0)
+        , values_count(0)
+        , max_queue_size(0)
+    {}
+
+    /*!
+    \brief Sets all counters to 0.
+    */
+    void clear()
+    {
+        *this = query_statistics();
+    }
+
+    /*! \brief The number of visited nodes, including leafs. */
+    std::size_t nodes_count;
+    /*! \brief The number of visited leafs. */
+    std::size_t leafs_count;
+    /*! \brief The number of checks of predicates, for children of internal nodes and for values. */
+    std::size_t predicates_count;
+    /*! \brief The number of returned values. */
+    std::size_t values_count;
+    /*! \brief The greatest number of branches waiting for traversal in k-nearest neighbors queries. */
+    std::size_t max_queue_size;
+};
+
+namespace detail {
+
+// The statistics policy used by default, doing nothing
+struct no_query_statistics
+{
+    inline void visit_node() {}
+    inline void visit_leaf() {}
+    inline void check_predicates() {}
+    inline void found(std::size_t) {}
+    inline void push_branches(std::size_t) {}
+    inline void pop_branches(std::size_t) {}
+};
+
+// The statistics policy gathering the counters in query_statistics
+class query_statistics_counter
+{
+public:
+    inline explicit query_statistics_counter(query_statistics & stats)
+        : m_stats(&stats), m_queue_size(0)
+    {}
+
+    inline void visit_node() { ++m_stats->nodes_count; }
+    inline void visit_leaf() { ++m_stats->nodes_count; ++m_stats->leafs_count; }
+    inline void check_predicates() { ++m_stats->predicates_count; }
+    inline void found(std::size_t count) { m_stats->values_count += count; }
+    inline void push_branches(std::size_t count)
+    {
+        m_queue_size += count;
+        if ( m_stats->max_queue_size < m_queue_size )
+            m_stats->max_queue_size = m_queue_size;
+    }
+    inline void pop_branches(std::size_t count) { m_queue_size -= count; }
+
+private:
+    query_statistics * m_stats;
+    std::size_t m_queue_size;
+};
+
+} // namespace detail
+
+}}} // namespace boost::geometry::index
+
+#endif // BOOST_GEOMETRY_INDEX_QUERY_STATISTICS_HPP
@@ -14,9 +14,11 @@
 
 // STD
 #include <algorithm>
+#include <iterator>
 
 // Boost
 #include <boost/tuple/tuple.hpp>
+#include <boost/type_traits/is_void.hpp>
 #include <boost/move/move.hpp>
 
 // Boost.Geometry
@@ -50,6 +52,7 @@
 
 #include <boost/geometry/index/predicates.hpp>
 #include <boost/geometry/index/distance_predicates.hpp>
+#include <boost/geometry/index/query_statistics.hpp>
 #include <boost/geometry/index/detail/rtree/adaptors.hpp>
 
 #include <boost/geometry/index/detail/meta.hpp>
@@ -64,8 +67,11 @@
 #include <boost/geometry/index/detail/rtree/visitors/destroy.hpp>
 #include <boost/geometry/index/detail/rtree/visitors/spatial_query.hpp>
 #include <boost/geometry/index/detail/rtree/visitors/distance_query.hpp>
+#include <boost/geometry/index/detail/rtree/visitors/path_query.hpp>
 #include <boost/geometry/index/detail/rtree/visitors/count.hpp>
 #include <boost/geometry/index/detail/rtree/visitors/children_box.hpp>
+#include <boost/geometry/index/detail/rtree/visitors/values_count.hpp>
+#include <boost/geometry/index/detail/rtree/visitors/aggregate_query.hpp>
 
 #include <boost/geometry/index/detail/rtree/linear/linear.hpp>
 #include <boost/geometry/index/detail/rtree/quadratic/quadratic.hpp>
@@ -73,6 +79,7 @@
 //#include <boost/geometry/extensions/index/detail/rtree/kmeans/kmeans.hpp>
 
 #include <boost/geometry/index/detail/rtree/pack_create.hpp>
+#include <boost/geometry/index/detail/rtree/repack.hpp>
 
 #include <boost/geometry/index/inserter.hpp>
 
@@ -173,11 +180,14 @@ public:
             >
     bounds_type;
 
+    /*! \brief The type of the summary of values, defined only if the parameters are augmented. */
+    typedef typename detail::rtree::aggregate_type<Parameters>::type aggregate_type;
+
 private:
 
     typedef detail::translator<IndexableGetter, EqualTo> translator_type;
 
-    typedef bounds_type box_type;
+    typedef typename detail::rtree::node_box_type<bounds_type, Parameters>::type box_type;
     typedef typename detail::rtree::options_type<Parameters>::type options_type;
     typedef typename options_type::node_tag node_tag;
     typedef detail::rtree::allocators<allocator_type, value_type, typename options_type::parameters_type, box_type, node_tag> allocators_type;
@@ -387,6 +397,7 @@ public:
         boost::swap(m_members.values_count, src.m_members.values_count);
         boost::swap(m_members.leafs_level, src.m_members.leafs_level);
         boost::swap(m_members.root, src.m_members.root);
+        boost::swap(m_members.repack_cursor, src.m_members.repack_cursor);
     }
 
     /*!
@@ -413,6 +424,7 @@ public:
             boost::swap(m_members.values_count, src.m_members.values_count);
             boost::swap(m_members.leafs_level, src.m_members.leafs_level);
             boost::swap(m_members.root, src.m_members.root);
+            boost::swap(m_members.repack_cursor, src.m_members.repack_cursor);
         }
         else
         {
@@ -488,6 +500,7 @@ public:
                 boost::swap(m_members.values_count, src.m_members.values_count);
                 boost::swap(m_members.leafs_level, src.m_members.leafs_level);
                 boost::swap(m_members.root, src.m_members.root);
+                boost::swap(m_members.repack_cursor, src.m_members.repack_cursor);
 
                 // NOTE: if propagate is true for std allocators on darwin 4.2.1, glibc++
                 // (allocators stored as base classes of members_holder)
@@ -538,6 +551,7 @@ public:
         boost::swap(m_members.values_count, other.m_members.values_count);
         boost::swap(m_members.leafs_level, other.m_members.leafs_level);
         boost::swap(m_members.root, other.m_members.root);
+        boost::swap(m_members.repack_cursor, other.m_members.repack_cursor);
     }
 
     /*!
@@ -615,6 +629,71 @@ public:
         this->insert_dispatch(conv_or_rng, is_conv_t());
     }
 
+    /*!
+    \brief Merge a range of values into the index.
+
+    If the iterators are at least ForwardIterators and the range contains more than
+    the maximum number of elements in node, the values are packed into a subtree
+    which nodes are then inserted into the R-tree at their levels. This is much faster
+    than inserting the values one by one but the nodes of the packed subtree may overlap
+    the existing nodes, so the queries may be slower than after calling insert().
+    Otherwise the values are inserted one by one.
+
+    \param first    The beginning of the range of values.
+    \param last     The end of the range of values.
+
+    \par Throws
+    \li If Value copy constructor or copy assignment throws.
+    \li If allocation throws or returns invalid value.
+
+    \warning
+    This operation only guarantees that there will be no memory leaks.
+    After an exception is thrown the R-tree may be left in an inconsistent state,
+    elements must not be inserted or removed. Other operations are allowed however
+    some of them may return invalid data.
+    */
+    template <typename Iterator>
+    inline void merge(Iterator first, Iterator last)
+    {
+        typedef boost::mpl::bool_
+            <
+                boost::is_convertible
+                    <
+                        typename std::iterator_traits<Iterator>::iterator_category,
+                        std::forward_iterator_tag
+                    >::value
+            > is_forward_t;
+
+        this->raw_merge(first, last, is_forward_t());
+    }
+
+    /*!
+    \brief Merge a range of values into the index.
+
+    It calls <tt>merge(Iterator, Iterator)</tt> for the begin and end of the range.
+
+    \param rng      The range of values.
+
+    \par Throws
+    \li If Value copy constructor or copy assignment throws.
+    \li If allocation throws or returns invalid value.
+
+    \warning
+    This operation only guarantees that there will be no memory leaks.
+    After an exception is thrown the R-tree may be left in an inconsistent state,
+    elements must not be inserted or removed. Other operations are allowed however
+    some of them may return invalid data.
+    */
+    template <typename Range>
+    inline void merge(Range const& rng)
+    {
+        BOOST_MPL_ASSERT_MSG((detail::is_range<Range>::value),
+                             PASSED_OBJECT_IS_NOT_A_RANGE,
+                             (Range));
+
+        this->merge(boost::const_begin(rng), boost::const_end(rng));
+    }
+
     /*!
     \brief Remove a value from the container.
 
@@ -704,6 +783,70 @@ public:
         return this->remove_dispatch(conv_or_rng, is_conv_t());
     }
 
+    /*!
+    \brief Repacks the subtrees which nodes overlap.
+
+    After many insertions and removals the nodes of the R-tree may overlap more than
+    the nodes of the R-tree created with the packing algorithm which makes the queries slower.
+    This function examines the subtrees of the greatest height for which a subtree can't store
+    more than \c max_values values, one after another, as long as the total number of values
+    of the examined subtrees is not greater than \c max_values. The subtrees in which
+    the children of any node overlap are repacked locally. The next call continues with
+    the next subtree, so the whole R-tree is examined by a series of calls.
+    If \c max_values is not less than the number of stored values, the whole R-tree is examined.
+
+    Beside examining and repacking at most \c max_values values, a call visits the nodes
+    above the examined subtrees which precede them. Their number is proportional to the number
+    of stored values divided by \c max_values. If no subtree below the root can store at most
+    \c max_values values, nothing is repacked.
+    The height of the R-tree and the nodes outside of the repacked subtrees are not modified,
+    except for the root which is removed if it has a single child after repacking.
+
+    \param max_values  The maximum number of values which may be examined and repacked.
+
+    \return            The number of repacked values.
+
+    \par Throws
+    \li If Value copy constructor throws.
+    \li If allocation throws or returns invalid value.
+
+    \warning
+    If an exception is thrown, the subtree being repacked is left unchanged
+    but the subtrees repacked before remain repacked.
+    */
+    inline size_type repack(size_type max_values)
+    {
+        if ( !m_members.root )
+            return 0;
+
+        return detail::rtree::repack<
+                value_type, options_type, translator_type, box_type, allocators_type
+            >::apply(m_members.root, m_members.leafs_level, m_members.values_count,
+                     m_members.repack_cursor, max_values,
+                     m_members.parameters(), m_members.translator(), m_members.allocators());  // MAY THROW
+    }
+
+    /*!
+    \brief Repacks the whole R-tree if any nodes overlap.
+
+    This is equivalent to calling repack() with \c max_values equal to the number of stored values.
+    The R-tree becomes lower if the root would have a single child.
+
+    \return            The number of repacked values.
+
+    \par Throws
+    \li If Value copy constructor throws.
+    \li If allocation throws or returns invalid value.
+
+    \warning
+    If an exception is thrown, the subtree being repacked is left unchanged
+    but the subtrees repacked before remain repacked.
+    */
+    inline size_type repack()
+    {
+        return this->repack(m_members.values_count);
+    }
+
     /*!
     \brief Finds values meeting passed predicates e.g. nearest to some Point and/or intersecting some Box.
 
@@ -742,6 +885,9 @@ public:
     in returning k values to the output iterator. Only one nearest predicate may be passed to the query.
     It may be generated by:
     \li \c boost::geometry::index::nearest().
+
+    The nearest predicate may also define the maximum distance of returned values. Then less than k values
+    may be returned and nodes further than this distance are not traversed.
         
     <b>Connecting predicates</b>
 
@@ -781,7 +927,47 @@ public:
         static const bool is_distance_predicate = 0 < distance_predicates_count;
         BOOST_MPL_ASSERT_MSG((distance_predicates_count <= 1), PASS_ONLY_ONE_DISTANCE_PREDICATE, (Predicates));
 
-        return query_dispatch(predicates, out_it, boost::mpl::bool_<is_distance_predicate>());
+        return query_dispatch(predicates, out_it, boost::mpl::bool_<is_distance_predicate>(),
+                              detail::no_query_statistics());
+    }
+
+    /*!
+    \brief Finds values meeting passed predicates and gathers the statistics of the query.
+
+    This function works as query() but additionally increments the counters stored in the
+    statistics object, e.g. the numbers of visited nodes and checked predicates.
+    The counters are not cleared before the query so the statistics of many queries may be
+    gathered. The query() called without the statistics object doesn't gather them.
+
+    \par Example
+    \verbatim
+    bgi::query_statistics stats;
+    tree.query(bgi::intersects(box), std::back_inserter(result), stats);
+    tree.query(bgi::nearest(pt, 5), std::back_inserter(result), stats);
+    \endverbatim
+
+    \par Throws
+    If Value copy constructor or copy assignment throws.
+    If predicates copy throws.
+
+    \param predicates   Predicates.
+    \param out_it       The output iterator, e.g. generated by std::back_inserter().
+    \param stats        The statistics object.
+
+    \return             The number of values found.
+    */
+    template <typename Predicates, typename OutIter>
+    size_type query(Predicates const& predicates, OutIter out_it, query_statistics & stats) const
+    {
+        if ( !m_members.root )
+            return 0;
+
+        static const unsigned distance_predicates_count = detail::predicates_count_distance<Predicates>::value;
+        static const bool is_distance_predicate = 0 < distance_predicates_count;
+        BOOST_MPL_ASSERT_MSG((distance_predicates_count <= 1), PASS_ONLY_ONE_DISTANCE_PREDICATE, (Predicates));
+
+        return query_dispatch(predicates, out_it, boost::mpl::bool_<is_distance_predicate>(),
+                              detail::query_statistics_counter(stats));
     }
 
     /*!
@@ -1049,6 +1235,9 @@ public:
 
     Returns the box able to contain all values stored in the container.
     If the container is empty the result of \c geometry::assign_inverse() is returned.
+    For \c reduced_precision parameters this is the box of the root node rounded outwards,
+    which may be greater than the envelope of the values. The coordinates of values beyond
+    the range of the less precise type are infinite in this box.
 
     \return     The box able to contain all values stored in the container or an invalid box if
                 there are no values in the container.
@@ -1065,10 +1254,12 @@ public:
             return result;
         }
 
+        box_type box;
         detail::rtree::visitors::children_box<value_type, options_type, translator_type, box_type, allocators_type>
-            box_v(result, m_members.translator());
+            box_v(box, m_members.translator());
         detail::rtree::apply_visitor(box_v, *m_members.root);
 
+        geometry::convert(box, result);
         return result;
     }
 
@@ -1124,6 +1315,83 @@ public:
         return count_v.found_count;
     }
 
+    /*!
+    \brief Returns the aggregate of all values stored in the container.
+
+    This function is available only if the parameters are augmented.
+    The result is taken from the root node. If the container is empty the identity
+    of the aggregator is returned.
+
+    \par Example
+    \verbatim
+    typedef bgi::augmented<bgi::rstar<16>, count_aggregator> params;
+    bgi::rtree<Value, params> tree;
+    // ...
+    std::size_t n = tree.aggregate();
+    \endverbatim
+
+    \return     The aggregate of all values.
+
+    \par Throws
+    If Aggregator copy constructor throws.
+    */
+    aggregate_type aggregate() const
+    {
+        BOOST_MPL_ASSERT_MSG((!boost::is_void<aggregate_type>::value),
+                             PARAMETERS_MUST_BE_AUGMENTED,
+                             (parameters_type));
+
+        if ( !m_members.root )
+            return m_members.parameters().get_aggregator().identity();
+
+        detail::rtree::node_aggregate<value_type, options_type, box_type, allocators_type> aggregate_v;
+        detail::rtree::apply_visitor(aggregate_v, *m_members.root);
+
+        return *aggregate_v.result;
+    }
+
+    /*!
+    \brief Returns the aggregate of values meeting passed predicates.
+
+    This function is available only if the parameters are augmented. Only spatial
+    predicates and satisfies() may be passed. The aggregates stored in nodes are used
+    if all values stored in a node meet the predicates, so the whole subtree
+    isn't traversed. Currently this is the case for intersects() and covered_by()
+    predicates taking a Box. Otherwise the values are aggregated one by one.
+
+    \par Example
+    \verbatim
+    std::size_t n = tree.aggregate(bgi::intersects(box));
+    \endverbatim
+
+    \param predicates   Predicates.
+
+    \return             The aggregate of values meeting predicates.
+
+    \par Throws
+    If Aggregator copy constructor or its member functions throw.
+    */
+    template <typename Predicates>
+    aggregate_type aggregate(Predicates const& predicates) const
+    {
+        BOOST_MPL_ASSERT_MSG((!boost::is_void<aggregate_type>::value),
+                             PARAMETERS_MUST_BE_AUGMENTED,
+                             (parameters_type));
+
+        static const unsigned distance_predicates_count = detail::predicates_count_distance<Predicates>::value;
+        BOOST_MPL_ASSERT_MSG((distance_predicates_count == 0), DISTANCE_PREDICATES_NOT_SUPPORTED, (Predicates));
+
+        if ( !m_members.root )
+            return m_members.parameters().get_aggregator().identity();
+
+        detail::rtree::visitors::aggregate_query<value_type, options_type, translator_type, box_type, allocators_type, Predicates>
+            aggregate_v(m_members.parameters(), m_members.translator(), predicates);
+
+        detail::rtree::apply_visitor(aggregate_v, *m_members.root);
+
+        return aggregate_v.result;
+    }
+
     /*!
     \brief Returns parameters.
 
@@ -1260,6 +1528,143 @@ private:
         ++m_members.values_count;
     }
 
+    /*!
+    \brief Insert values one by one.
+
+    \par Exception-safety
+    basic
+    */
+    template <typename Iterator>
+    inline void raw_merge(Iterator first, Iterator last,
+                          boost::mpl::bool_<false> const& /*is_forward*/)
+    {
+        if ( !m_members.root )
+            this->raw_create();
+
+        for ( ; first != last ; ++first )
+            this->raw_insert(*first);
+    }
+
+    /*!
+    \brief Pack values into a subtree and graft it into the container.
+
+    \par Exception-safety
+    basic
+    */
+    template <typename Iterator>
+    inline void raw_merge(Iterator first, Iterator last,
+                          boost::mpl::bool_<true> const& /*is_forward*/)
+    {
+        // small ranges are inserted one by one
+        if ( static_cast<size_type>(std::distance(first, last)) <= m_members.parameters().get_max_elements() )
+        {
+            this->raw_merge(first, last, boost::mpl::bool_<false>());
+            return;
+        }
+
+        typedef detail::rtree::pack<value_type, options_type, translator_type, box_type, allocators_type> pack;
+        size_type vc = 0, ll = 0;
+        node_pointer subtree = pack::apply(first, last, vc, ll,
+                                           m_members.parameters(), m_members.translator(), m_members.allocators()); // MAY THROW, STRONG
+
+        if ( !m_members.root )
+        {
+            m_members.root = subtree;
+            m_members.values_count = vc;
+            m_members.leafs_level = ll;
+            return;
+        }
+
+        this->raw_graft(subtree, ll);                                                                   // MAY THROW, BASIC
+    }
+
+    /*!
+    \brief Insert the elements of the subtree's root into the tree and destroy the root.
+
+    The elements of the root of a subtree taller than the tree are grafted recursively,
+    so the nodes of the subtree are always inserted at a level existing in the tree
+    and the values stored in the tree are never moved to the subtree.
+
+    \par Exception-safety
+    basic
+    */
+    inline void raw_graft(node_pointer subtree, size_type subtree_leafs_level)
+    {
+        BOOST_GEOMETRY_INDEX_ASSERT(m_members.root, "The root must exist");
+
+        if ( 0 == subtree_leafs_level )
+        {
+            node_auto_ptr auto_remover(subtree, m_members.allocators());
+
+            typedef typename detail::rtree::elements_type<leaf>::type elements_type;
+            elements_type const& elements = detail::rtree::elements(detail::rtree::get<leaf>(*subtree));
+
+            for ( typename elements_type::const_iterator it = elements.begin() ; it != elements.end() ; ++it )
+            {
+                // the insert visitor keeps a reference, leaf iterators may return values
+                value_type const& value = *it;
+
+                detail::rtree::visitors::insert<
+                    value_type,
+                    value_type, options_type, translator_type, box_type, allocators_type,
+                    typename options_type::insert_tag
+                > insert_v(m_members.root, m_members.leafs_level, value,
+                           m_members.parameters(), m_members.translator(), m_members.allocators());
+
+                detail::rtree::apply_visitor(insert_v, *m_members.root);                                // MAY THROW (V, E: alloc, copy, N: alloc)
+
+                ++m_members.values_count;
+            }
+
+            return;
+        }
+
+        typedef typename detail::rtree::elements_type<internal_node>::type elements_type;
+        elements_type & elements = detail::rtree::elements(detail::rtree::get<internal_node>(*subtree));
+
+        typename elements_type::iterator it = elements.begin();
+        BOOST_TRY
+        {
+            for ( ; it != elements.end() ; ++it )
+            {
+                // the leafs level of the tree may be increased by the previous insertions
+                if ( m_members.leafs_level < subtree_leafs_level )
+                {
+                    this->raw_graft(it->second, subtree_leafs_level - 1);                               // MAY THROW, BASIC
+                    continue;
+                }
+
+                detail::rtree::visitors::values_count<value_type, options_type, box_type, allocators_type> count_v;
+                detail::rtree::apply_visitor(count_v, *it->second);
+
+                detail::rtree::visitors::insert<
+                    typename elements_type::value_type,
+                    value_type, options_type, translator_type, box_type, allocators_type,
+                    typename options_type::insert_tag
+                > insert_v(m_members.root, m_members.leafs_level, *it,
+                           m_members.parameters(), m_members.translator(), m_members.allocators(),
+                           subtree_leafs_level);
+
+                detail::rtree::apply_visitor(insert_v, *m_members.root);                                // MAY THROW (V, E: alloc, copy, N: alloc)
+
+                m_members.values_count += count_v.result;
+            }
+        }
+        BOOST_CATCH(...)
+        {
+            // the element which insertion failed is destroyed by the visitor or by raw_graft()
+            ++it;
+            detail::rtree::destroy_elements<value_type, options_type, translator_type, box_type, allocators_type>
+                ::apply(it, elements.end(), m_members.allocators());
+            elements.clear();
+            detail::rtree::destroy_node<allocators_type, internal_node>::apply(m_members.allocators(), subtree);
+            BOOST_RETHROW                                                                                 // RETHROW
+        }
+        BOOST_CATCH_END
+
+        detail::rtree::destroy_node<allocators_type, internal_node>::apply(m_members.allocators(), subtree);
+    }
+
     /*!
     \brief Remove the value from the container.
 
@@ -1329,6 +1734,7 @@ private:
         }
         t.m_members.values_count = 0;
         t.m_members.leafs_level = 0;
+        t.m_members.repack_cursor = detail::rtree::repack_cursor();
     }
 
     /*!
@@ -1369,6 +1775,7 @@ private:
         dst.m_members.root = copy_v.result;
         dst.m_members.values_count = src.m_members.values_count;
         dst.m_members.leafs_level = src.m_members.leafs_level;
+        dst.m_members.repack_cursor = src.m_members.repack_cursor;
     }
 
     /*!
@@ -1457,11 +1864,12 @@ private:
     \par Exception-safety
     strong
     */
-    template <typename Predicates, typename OutIter>
-    size_type query_dispatch(Predicates const& predicates, OutIter out_it, boost::mpl::bool_<false> const& /*is_distance_predicate*/) const
+    template <typename Predicates, typename OutIter, typename Statistics>
+    size_type query_dispatch(Predicates const& predicates, OutIter out_it, boost::mpl::bool_<false> const& /*is_distance_predicate*/,
+                             Statistics const& stats) const
     {
-        detail::rtree::visitors::spatial_query<value_type, options_type, translator_type, box_type, allocators_type, Predicates, OutIter>
-            find_v(m_members.translator(), predicates, out_it);
+        detail::rtree::visitors::spatial_query<value_type, options_type, translator_type, box_type, allocators_type, Predicates, OutIter, Statistics>
+            find_v(m_members.translator(), predicates, out_it, stats);
 
         detail::rtree::apply_visitor(find_v, *m_members.root);
 
@@ -1474,20 +1882,28 @@ private:
     \par Exception-safety
     strong
     */
-    template <typename Predicates, typename OutIter>
-    size_type query_dispatch(Predicates const& predicates, OutIter out_it, boost::mpl::bool_<true> const& /*is_distance_predicate*/) const
+    template <typename Predicates, typename OutIter, typename Statistics>
+    size_type query_dispatch(Predicates const& predicates, OutIter out_it, boost::mpl::bool_<true> const& /*is_distance_predicate*/,
+                             Statistics const& stats) const
     {
         static const unsigned distance_predicate_index = detail::predicates_find_distance<Predicates>::value;
-        detail::rtree::visitors::distance_query<
-            value_type,
-            options_type,
-            translator_type,
-            box_type,
-            allocators_type,
-            Predicates,
-            distance_predicate_index,
-            OutIter
-        > distance_v(m_members.parameters(), m_members.translator(), predicates, out_it);
+        static const bool is_path_predicate = detail::predicates_is_path<
+            typename detail::predicates_element<distance_predicate_index, Predicates>::type
+        >::value;
+
+        typedef typename boost::mpl::if_c<
+            is_path_predicate,
+            detail::rtree::visitors::path_query<
+                value_type, options_type, translator_type, box_type, allocators_type,
+                Predicates, distance_predicate_index, OutIter, Statistics
+            >,
+            detail::rtree::visitors::distance_query<
+                value_type, options_type, translator_type, box_type, allocators_type,
+                Predicates, distance_predicate_index, OutIter, Statistics
+            >
+        >::type distance_visitor_type;
+
+        distance_visitor_type distance_v(m_members.parameters(), m_members.translator(), predicates, out_it, stats);
 
         detail::rtree::apply_visitor(distance_v, *m_members.root);
 
@@ -1543,6 +1959,7 @@ private:
         size_type values_count;
         size_type leafs_level;
         node_pointer root;
+        detail::rtree::repack_cursor repack_cursor;
     };
 
     members_holder m_members;
@@ -1602,6 +2019,43 @@ inline void insert(rtree<Value, Parameters, IndexableGetter, EqualTo, Allocator>
     tree.insert(conv_or_rng);
 }
 
+/*!
+\brief Merge a range of values into the index.
+
+It calls <tt>rtree::merge(Iterator, Iterator)</tt>.
+
+\ingroup rtree_functions
+
+\param tree     The spatial index.
+\param first    The beginning of the range of values.
+\param last     The end of the range of values.
+*/
+template<typename Value, typename Parameters, typename IndexableGetter, typename EqualTo, typename Allocator,
+         typename Iterator>
+inline void merge(rtree<Value, Parameters, IndexableGetter, EqualTo, Allocator> & tree,
+                  Iterator first, Iterator last)
+{
+    tree.merge(first, last);
+}
+
+/*!
+\brief Merge a range of values into the index.
+
+It calls <tt>rtree::merge(Range const&)</tt>.
+
+\ingroup rtree_functions
+
+\param tree     The spatial index.
+\param rng      The range of values.
+*/
+template<typename Value, typename Parameters, typename IndexableGetter, typename EqualTo, typename Allocator,
+         typename Range>
+inline void merge(rtree<Value, Parameters, IndexableGetter, EqualTo, Allocator> & tree,
+                  Range const& rng)
+{
+    tree.merge(rng);
+}
+
 /*!
 \brief Remove a value from the container.
 
@@ -1757,6 +2211,40 @@ query(rtree<Value, Parameters, IndexableGetter, EqualTo, Allocator> const& tree,
     return tree.query(predicates, out_it);
 }
 
+/*!
+\brief Finds values meeting passed predicates and gathers the statistics of the query.
+
+It calls \c rtree::query(Predicates const&, OutIter, query_statistics &).
+
+\par Example
+\verbatim
+bgi::query_statistics stats;
+bgi::query(tree, bgi::intersects(box), std::back_inserter(result), stats);
+\endverbatim
+
+\par Throws
+If Value copy constructor or copy assignment throws.
+
+\ingroup rtree_functions
+
+\param tree         The rtree.
+\param predicates   Predicates.
+\param out_it       The output iterator, e.g. generated by std::back_inserter().
+\param stats        The statistics object.
+
+\return             The number of values found.
+*/
+template <typename Value, typename Parameters, typename IndexableGetter, typename EqualTo, typename Allocator,
+          typename Predicates, typename OutIter> inline
+typename rtree<Value, Parameters, IndexableGetter, EqualTo, Allocator>::size_type
+query(rtree<Value, Parameters, IndexableGetter, EqualTo, Allocator> const& tree,
+      Predicates const& predicates,
+      OutIter out_it,
+      query_statistics & stats)
+{
+    return tree.query(predicates, out_it, stats);
+}
+
 /*!
 \brief Returns the query iterator pointing at the begin of the query range.
 
@@ -14,6 +14,7 @@
 #ifndef BOOST_GEOMETRY_IO_HPP
 #define BOOST_GEOMETRY_IO_HPP
 
+#include <boost/geometry/io/wkb/read.hpp>
 #include <boost/geometry/io/wkt/read.hpp>
 #include <boost/geometry/io/wkt/write.hpp>
 
@@ -21,7 +22,7 @@ namespace boost { namespace geometry
 {
 
 struct format_wkt {};
-struct format_wkb {}; // TODO
+struct format_wkb {};
 struct format_dsv {}; // TODO
 
 #ifndef DOXYGEN_NO_DISPATCH
@@ -37,7 +38,16 @@ struct read<format_wkt, Geometry>
 {
     static inline void apply(Geometry& geometry, std::string const& wkt)
     {
-        read_wkt<typename tag<Geometry>::type, Geometry>::apply(wkt, geometry);
+        geometry::read_wkt(wkt, geometry);
+    }
+};
+
+template <typename Geometry>
+struct read<format_wkb, Geometry>
+{
+    static inline void apply(Geometry& geometry, std::string const& wkb)
+    {
+        geometry::read_wkb(wkb.begin(), wkb.end(), geometry);
     }
 };
 
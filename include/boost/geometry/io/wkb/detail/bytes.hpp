@@ -0,0 +1,216 @@
+// Boost.Geometry (aka GGL, Generic Geometry Library)
+
+// Copyright (c) 2026 agent.
+
+// Use, modification and distribution is subject to the Boost Software License,
+// Version 1.0. (See accompanying file LICENSE_1_0.txt or copy at
+// http://www.boost.org/LICENSE_1_0.txt)
+
+#ifndef BOOST_GEOMETRY_IO_WKB_DETAIL_BYTES_HPP
+#define BOOST_GEOMETRY_IO_WKB_DETAIL_BYTES_HPP
+
+#include <cstring>
+#include <limits>
+
+#include <boost/cstdint.hpp>
+#include <boost/static_assert.hpp>
+
+
+namespace boost { namespace geometry
+{
+
+
+#ifndef DOXYGEN_NO_DETAIL
+namespace detail { namespace wkb
+{
+
+// Geometry types, as in the OGC Simple Features specification
+enum geometry_type_code
+{
+    wkb_point = 1,
+    wkb_linestring = 2,
+    wkb_polygon = 3,
+    wkb_multi_point = 4,
+    wkb_multi_linestring = 5,
+    wkb_multi_polygon = 6
+};
+
+// ISO WKB adds 1000 to the type for Z, 2000 for M and 3000 for ZM.
+// EWKB (PostGIS) uses these flags instead, and can contain an SRID
+static boost::uint32_t const iso_z_offset = 1000;
+static boost::uint32_t const ewkb_z_flag = 0x80000000u;
+static boost::uint32_t const ewkb_m_flag = 0x40000000u;
+static boost::uint32_t const ewkb_srid_flag = 0x20000000u;
+
+
+// Doubles are written as their IEEE 754 bits, which are swapped in the
+// same way as integers of 64 bits. The assertions are in templates, so they
+// only fire on platforms without IEEE doubles if WKB is actually used.
+template <typename Double>
+inline boost::uint64_t double_to_bits(Double value)
+{
+    BOOST_STATIC_ASSERT(sizeof(Double) == sizeof(boost::uint64_t)
+                        && std::numeric_limits<Double>::is_iec559);
+
+    boost::uint64_t bits;
+    std::memcpy(&bits, &value, sizeof(bits));
+    return bits;
+}
+
+template <typename Double>
+inline Double bits_to_double(boost::uint64_t bits)
+{
+    BOOST_STATIC_ASSERT(sizeof(Double) == sizeof(boost::uint64_t)
+                        && std::numeric_limits<Double>::is_iec559);
+
+    Double value;
+    std::memcpy(&value, &bits, sizeof(value));
+    return value;
+}
+
+
+// Writes values byte by byte in the byte order of the WKB. The bytes are
+// composed by shifting, so the byte order of the platform does not matter.
+template <typename OutputIterator>
+class byte_writer
+{
+public :
+    byte_writer(OutputIterator out, bool little_endian)
+        : m_out(out)
+        , m_little_endian(little_endian)
+    {}
+
+    inline bool little_endian() const
+    {
+        return m_little_endian;
+    }
+
+    inline void write_byte(unsigned char value)
+    {
+        *m_out++ = value;
+    }
+
+    inline void write_uint32(boost::uint32_t value)
+    {
+        write<4>(value);
+    }
+
+    inline void write_double(double value)
+    {
+        write<8>(double_to_bits(value));
+    }
+
+    inline OutputIterator output() const
+    {
+        return m_out;
+    }
+
+private :
+    template <int Size>
+    inline void write(boost::uint64_t value)
+    {
+        for (int i = 0; i < Size; i++)
+        {
+            int const shift = 8 * (m_little_endian ? i : Size - 1 - i);
+            *m_out++ = static_cast<unsigned char>((value >> shift) & 0xFF);
+        }
+    }
+
+    OutputIterator m_out;
+    bool m_little_endian;
+};
+
+
+// Reads values from a random access range of bytes (char or unsigned char),
+// checking its end once per value
+template <typename Iterator, typename Exception>
+class byte_reader
+{
+public :
+    byte_reader(Iterator first, Iterator last)
+        : m_it(first)
+        , m_end(last)
+        , m_little_endian(true)
+    {}
+
+    inline Iterator position() const
+    {
+        return m_it;
+    }
+
+    inline void set_little_endian(bool little_endian)
+    {
+        m_little_endian = little_endian;
+    }
+
+    inline bool little_endian() const
+    {
+        return m_little_endian;
+    }
+
+    // Checks if count values of size bytes are left, before resizing
+    // containers to a count read from the WKB
+    inline void check(boost::uint32_t count, std::size_t size) const
+    {
+        if (static_cast<std::size_t>(m_end - m_it) / size < count)
+        {
+            throw Exception("Unexpected end of WKB");
+        }
+    }
+
+    inline unsigned char read_byte()
+    {
+        check(1, 1);
+        return static_cast<unsigned char>(*m_it++);
+    }
+
+    inline boost::uint32_t read_uint32()
+    {
+        return static_cast<boost::uint32_t>(read<4>());
+    }
+
+    inline double read_double()
+    {
+        return bits_to_double<double>(read<8>());
+    }
+
+    // Reads a double of which the remaining bytes are checked before
+    inline double read_checked_double()
+    {
+        return bits_to_double<double>(read_unchecked<8>());
+    }
+
+private :
+    template <int Size>
+    inline boost::uint64_t read()
+    {
+        check(1, Size);
+        return read_unchecked<Size>();
+    }
+
+    template <int Size>
+    inline boost::uint64_t read_unchecked()
+    {
+        boost::uint64_t result = 0;
+        for (int i = 0; i < Size; i++)
+        {
+            boost::uint64_t const byte = static_cast<unsigned char>(*m_it++);
+            int const shift = 8 * (m_little_endian ? i : Size - 1 - i);
+            result |= byte << shift;
+        }
+        return result;
+    }
+
+    Iterator m_it;
+    Iterator m_end;
+    bool m_little_endian;
+};
+
+
+}} // namespace detail::wkb
+#endif // DOXYGEN_NO_DETAIL
+
+
+}} // namespace boost::geometry
+
+#endif // BOOST_GEOMETRY_IO_WKB_DETAIL_BYTES_HPP
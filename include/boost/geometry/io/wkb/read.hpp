@@ -0,0 +1,604 @@
+// Boost.Geometry (aka GGL, Generic Geometry Library)
+
+// Copyright (c) 2026 agent.
+
+// Use, modification and distribution is subject to the Boost Software License,
+// Version 1.0. (See accompanying file LICENSE_1_0.txt or copy at
+// http://www.boost.org/LICENSE_1_0.txt)
+
+#ifndef BOOST_GEOMETRY_IO_WKB_READ_HPP
+#define BOOST_GEOMETRY_IO_WKB_READ_HPP
+
+#include <cstddef>
+#include <string>
+
+#include <boost/cstdint.hpp>
+#include <boost/range.hpp>
+#include <boost/type_traits/remove_reference.hpp>
+
+#include <boost/geometry/algorithms/assign.hpp>
+#include <boost/geometry/algorithms/detail/equals/point_point.hpp>
+#include <boost/geometry/algorithms/expand.hpp>
+
+#include <boost/geometry/core/access.hpp>
+#include <boost/geometry/core/closure.hpp>
+#include <boost/geometry/core/coordinate_dimension.hpp>
+#include <boost/geometry/core/coordinate_type.hpp>
+#include <boost/geometry/core/exception.hpp>
+#include <boost/geometry/core/exterior_ring.hpp>
+#include <boost/geometry/core/interior_rings.hpp>
+#include <boost/geometry/core/mutable_range.hpp>
+#include <boost/geometry/core/point_type.hpp>
+#include <boost/geometry/core/ring_type.hpp>
+#include <boost/geometry/core/tags.hpp>
+
+#include <boost/geometry/geometries/concepts/check.hpp>
+
+#include <boost/geometry/util/range.hpp>
+
+#include <boost/geometry/io/wkb/detail/bytes.hpp>
+
+
+namespace boost { namespace geometry
+{
+
+/*!
+\brief Exception showing things wrong with WKB parsing
+\ingroup wkb
+*/
+struct read_wkb_exception : public geometry::exception
+{
+    explicit read_wkb_exception(std::string const& msg)
+        : message(msg)
+    {}
+
+    virtual ~read_wkb_exception() throw() {}
+
+    virtual const char* what() const throw()
+    {
+        return message.c_str();
+    }
+private :
+    std::string message;
+};
+
+
+#ifndef DOXYGEN_NO_DETAIL
+// (wkb: Well Known Binary, defined by OGC for all geometries and implemented
+// by e.g. databases (PostGIS, SpatiaLite, MySQL))
+namespace detail { namespace wkb
+{
+
+// What is stored per point, and the SRID if it was specified (EWKB)
+struct geometry_header
+{
+    geometry_header()
+        : has_z(false)
+        , has_m(false)
+        , srid(0)
+    {}
+
+    inline std::size_t point_size() const
+    {
+        return 8 * (2 + (has_z ? 1 : 0) + (has_m ? 1 : 0));
+    }
+
+    bool has_z;
+    bool has_m;
+    boost::uint32_t srid;
+};
+
+
+template <typename Point, typename Reader>
+inline geometry_header read_header(Reader& reader, boost::uint32_t expected_type)
+{
+    unsigned char const byte_order = reader.read_byte();
+    if (byte_order > 1)
+    {
+        throw read_wkb_exception("Invalid byte order");
+    }
+    reader.set_little_endian(byte_order == 1);
+
+    boost::uint32_t type = reader.read_uint32();
+
+    geometry_header result;
+    result.has_z = (type & ewkb_z_flag) != 0;
+    result.has_m = (type & ewkb_m_flag) != 0;
+    bool const has_srid = (type & ewkb_srid_flag) != 0;
+    type &= ~(ewkb_z_flag | ewkb_m_flag | ewkb_srid_flag);
+
+    // ISO: 1000 for Z, 2000 for M, 3000 for ZM
+    switch (type / iso_z_offset)
+    {
+        case 0 : break;
+        case 1 : result.has_z = true; break;
+        case 2 : result.has_m = true; break;
+        case 3 : result.has_z = true; result.has_m = true; break;
+        default : throw read_wkb_exception("Invalid geometry type");
+    }
+    type %= iso_z_offset;
+
+    if (has_srid)
+    {
+        result.srid = reader.read_uint32();
+    }
+
+    if (type != expected_type)
+    {
+        throw read_wkb_exception("Unexpected geometry type");
+    }
+    if (result.has_z && dimension<Point>::value < 3)
+    {
+        throw read_wkb_exception("Z only allowed for 3 or more dimensions");
+    }
+    return result;
+}
+
+
+// Assigns x, y and (if present) z. Other dimensions are initialized to
+// zero, as in WKT
+template <typename Point,
+          std::size_t Dimension = 0,
+          std::size_t DimensionCount = geometry::dimension<Point>::value>
+struct coordinates_reader
+{
+    template <typename Reader>
+    static inline void apply(Reader& reader, Point& point,
+                std::size_t coordinate_count)
+    {
+        typedef typename coordinate_type<Point>::type coordinate_type;
+
+        set<Dimension>(point, Dimension < coordinate_count
+                ? static_cast<coordinate_type>(reader.read_checked_double())
+                : coordinate_type());
+
+        coordinates_reader<Point, Dimension + 1, DimensionCount>::apply(
+                    reader, point, coordinate_count);
+    }
+};
+
+template <typename Point, std::size_t DimensionCount>
+struct coordinates_reader<Point, DimensionCount, DimensionCount>
+{
+    template <typename Reader>
+    static inline void apply(Reader&, Point&, std::size_t)
+    {}
+};
+
+
+// Reads a point of which the bytes are checked before
+template <typename Point, typename Reader>
+inline void read_checked_point(Reader& reader, Point& point,
+            geometry_header const& header)
+{
+    coordinates_reader<Point>::apply(reader, point, header.has_z ? 3 : 2);
+    if (header.has_m)
+    {
+        reader.read_checked_double();
+    }
+}
+
+
+// Open rings are stored closed in WKB, so the closing point is dropped
+// (if there are enough points, as in WKT)
+template <typename Range, closure_selector Closure = closure<Range>::value>
+struct drop_closing_point
+{
+    static inline void apply(Range&)
+    {}
+};
+
+template <typename Range>
+struct drop_closing_point<Range, open>
+{
+    static inline void apply(Range& range)
+    {
+        std::size_t const n = boost::size(range);
+        if (n > core_detail::closure::minimum_ring_size<open>::value
+            && detail::equals::equals_point_point(range::front(range),
+                                                  range::back(range)))
+        {
+            range::resize(range, n - 1);
+        }
+    }
+};
+
+
+// Reads the points directly into the range, which is resized once
+template <typename Range>
+struct points_reader
+{
+    template <typename Reader>
+    static inline void apply(Reader& reader, Range& range,
+                geometry_header const& header)
+    {
+        boost::uint32_t const count = reader.read_uint32();
+        reader.check(count, header.point_size());
+
+        range::resize(range, count);
+
+        typedef typename boost::range_iterator<Range>::type iterator_type;
+        for (iterator_type it = boost::begin(range);
+             it != boost::end(range);
+             ++it)
+        {
+            read_checked_point(reader, *it, header);
+        }
+    }
+};
+
+
+template <typename Point>
+struct point_parser
+{
+    template <typename Reader>
+    static inline void apply(Reader& reader, Point& point,
+                geometry_header const& header)
+    {
+        reader.check(1, header.point_size());
+        read_checked_point(reader, point, header);
+    }
+};
+
+
+template <typename Linestring>
+struct linestring_parser
+{
+    template <typename Reader>
+    static inline void apply(Reader& reader, Linestring& linestring,
+                geometry_header const& header)
+    {
+        points_reader<Linestring>::apply(reader, linestring, header);
+    }
+};
+
+
+template <typename Ring>
+struct ring_parser
+{
+    template <typename Reader>
+    static inline void apply(Reader& reader, Ring& ring,
+                geometry_header const& header)
+    {
+        boost::uint32_t const count = reader.read_uint32();
+        if (count > 1)
+        {
+            throw read_wkb_exception("Ring should not have interior rings");
+        }
+        if (count == 0)
+        {
+            range::resize(ring, 0);
+            return;
+        }
+        read_ring(reader, ring, header);
+    }
+
+    template <typename Reader, typename RingType>
+    static inline void read_ring(Reader& reader, RingType& ring,
+                geometry_header const& header)
+    {
+        points_reader<RingType>::apply(reader, ring, header);
+        drop_closing_point<RingType>::apply(ring);
+    }
+};
+
+
+template <typename Polygon>
+struct polygon_parser
+{
+    typedef typename ring_return_type<Polygon>::type exterior_type;
+    typedef typename interior_return_type<Polygon>::type interiors_type;
+    typedef typename boost::range_iterator
+        <
+            typename boost::remove_reference<interiors_type>::type
+        >::type interior_iterator;
+
+    template <typename Reader>
+    static inline void apply(Reader& reader, Polygon& polygon,
+                geometry_header const& header)
+    {
+        typedef typename ring_type<Polygon>::type ring_type;
+
+        boost::uint32_t const count = reader.read_uint32();
+        // Each ring has at least its number of points
+        reader.check(count, 4);
+
+        exterior_type exterior = exterior_ring(polygon);
+        interiors_type interiors = interior_rings(polygon);
+        range::resize(interiors, count > 0 ? count - 1 : 0);
+        if (count == 0)
+        {
+            range::resize(exterior, 0);
+            return;
+        }
+
+        ring_parser<ring_type>::read_ring(reader, exterior, header);
+        for (interior_iterator it = boost::begin(interiors);
+             it != boost::end(interiors);
+             ++it)
+        {
+            ring_parser<ring_type>::read_ring(reader, *it, header);
+        }
+    }
+};
+
+
+// Box (Non-OGC), read from a polygon as its envelope
+template <typename Box>
+struct box_parser
+{
+    template <typename Reader>
+    static inline void apply(Reader& reader, Box& box,
+                geometry_header const& header)
+    {
+        typedef typename point_type<Box>::type point_type;
+
+        if (reader.read_uint32() != 1)
+        {
+            throw read_wkb_exception("Box should be a polygon with one ring");
+        }
+        boost::uint32_t const count = reader.read_uint32();
+        if (count == 0)
+        {
+            throw read_wkb_exception("Box should have points");
+        }
+        reader.check(count, header.point_size());
+
+        assign_inverse(box);
+        for (boost::uint32_t i = 0; i < count; i++)
+        {
+            point_type point;
+            read_checked_point(reader, point, header);
+            geometry::expand(box, point);
+        }
+    }
+};
+
+
+// Segment (Non-OGC), read from a linestring of two points
+template <typename Segment>
+struct segment_parser
+{
+    template <typename Reader>
+    static inline void apply(Reader& reader, Segment& segment,
+                geometry_header const& header)
+    {
+        typedef typename point_type<Segment>::type point_type;
+
+        if (reader.read_uint32() != 2)
+        {
+            throw read_wkb_exception("Segment should have 2 points");
+        }
+        reader.check(2, header.point_size());
+
+        point_type p1, p2;
+        read_checked_point(reader, p1, header);
+        read_checked_point(reader, p2, header);
+        geometry::detail::assign_point_to_index<0>(p1, segment);
+        geometry::detail::assign_point_to_index<1>(p2, segment);
+    }
+};
+
+
+// Reads the header, with its own byte order, and the body of a geometry
+template <typename Geometry, template<typename> class Parser, geometry_type_code Code>
+struct geometry_parser
+{
+    template <typename Reader>
+    static inline boost::uint32_t apply(Reader& reader, Geometry& geometry)
+    {
+        typedef typename point_type<Geometry>::type point_type;
+
+        geometry_header const header
+            = read_header<point_type>(reader, static_cast<boost::uint32_t>(Code));
+        Parser<Geometry>::apply(reader, geometry, header);
+        return header.srid;
+    }
+};
+
+
+template <typename MultiGeometry, typename SingleParser, geometry_type_code Code>
+struct multi_parser
+{
+    template <typename Reader>
+    static inline boost::uint32_t apply(Reader& reader, MultiGeometry& geometry)
+    {
+        typedef typename point_type<MultiGeometry>::type point_type;
+        typedef typename boost::range_iterator<MultiGeometry>::type iterator_type;
+
+        geometry_header const header
+            = read_header<point_type>(reader, static_cast<boost::uint32_t>(Code));
+
+        boost::uint32_t const count = reader.read_uint32();
+        // Each geometry has at least its byte order and type
+        reader.check(count, 5);
+
+        range::resize(geometry, count);
+        for (iterator_type it = boost::begin(geometry);
+             it != boost::end(geometry);
+             ++it)
+        {
+            SingleParser::apply(reader, *it);
+        }
+        return header.srid;
+    }
+};
+
+
+}} // namespace detail::wkb
+#endif // DOXYGEN_NO_DETAIL
+
+
+#ifndef DOXYGEN_NO_DISPATCH
+namespace dispatch
+{
+
+template <typename Tag, typename Geometry>
+struct read_wkb {};
+
+
+template <typename Point>
+struct read_wkb<point_tag, Point>
+    : detail::wkb::geometry_parser
+        <
+            Point,
+            detail::wkb::point_parser,
+            detail::wkb::wkb_point
+        >
+{};
+
+template <typename Linestring>
+struct read_wkb<linestring_tag, Linestring>
+    : detail::wkb::geometry_parser
+        <
+            Linestring,
+            detail::wkb::linestring_parser,
+            detail::wkb::wkb_linestring
+        >
+{};
+
+template <typename Ring>
+struct read_wkb<ring_tag, Ring>
+    : detail::wkb::geometry_parser
+        <
+            Ring,
+            detail::wkb::ring_parser,
+            detail::wkb::wkb_polygon
+        >
+{};
+
+template <typename Polygon>
+struct read_wkb<polygon_tag, Polygon>
+    : detail::wkb::geometry_parser
+        <
+            Polygon,
+            detail::wkb::polygon_parser,
+            detail::wkb::wkb_polygon
+        >
+{};
+
+
+template <typename MultiPoint>
+struct read_wkb<multi_point_tag, MultiPoint>
+    : detail::wkb::multi_parser
+        <
+            MultiPoint,
+            read_wkb
+                <
+                    point_tag,
+                    typename boost::range_value<MultiPoint>::type
+                >,
+            detail::wkb::wkb_multi_point
+        >
+{};
+
+template <typename MultiLinestring>
+struct read_wkb<multi_linestring_tag, MultiLinestring>
+    : detail::wkb::multi_parser
+        <
+            MultiLinestring,
+            read_wkb
+                <
+                    linestring_tag,
+                    typename boost::range_value<MultiLinestring>::type
+                >,
+            detail::wkb::wkb_multi_linestring
+        >
+{};
+
+template <typename MultiPolygon>
+struct read_wkb<multi_polygon_tag, MultiPolygon>
+    : detail::wkb::multi_parser
+        <
+            MultiPolygon,
+            read_wkb
+                <
+                    polygon_tag,
+                    typename boost::range_value<MultiPolygon>::type
+                >,
+            detail::wkb::wkb_multi_polygon
+        >
+{};
+
+
+// Box (Non-OGC)
+template <typename Box>
+struct read_wkb<box_tag, Box>
+    : detail::wkb::geometry_parser
+        <
+            Box,
+            detail::wkb::box_parser,
+            detail::wkb::wkb_polygon
+        >
+{};
+
+// Segment (Non-OGC)
+template <typename Segment>
+struct read_wkb<segment_tag, Segment>
+    : detail::wkb::geometry_parser
+        <
+            Segment,
+            detail::wkb::segment_parser,
+            detail::wkb::wkb_linestring
+        >
+{};
+
+
+} // namespace dispatch
+#endif // DOXYGEN_NO_DISPATCH
+
+
+/*!
+\brief Parses OGC Well-Known Binary (WKB) into a geometry (any geometry)
+\ingroup wkb
+\details Both byte orders, ISO WKB (with Z, M or ZM) and PostGIS Extended
+    WKB (with an optional SRID) are read. The coordinates are copied directly
+    into the point containers of the geometry, without intermediate copies.
+    M values are skipped. A Z value is only allowed for points with 3 or more
+    dimensions.
+\tparam Iterator random access iterator over bytes (char or unsigned char)
+\tparam Geometry \tparam_geometry
+\param first iterator to the first byte of the WKB
+\param last iterator after the last byte of the WKB
+\param geometry \param_geometry output geometry
+\return iterator after the last byte read, which is the start of the next
+    geometry if more geometries are stored in one buffer
+*/
+template <typename Iterator, typename Geometry>
+inline Iterator read_wkb(Iterator first, Iterator last, Geometry& geometry)
+{
+    geometry::concept::check<Geometry>();
+
+    detail::wkb::byte_reader<Iterator, read_wkb_exception> reader(first, last);
+    dispatch::read_wkb<typename tag<Geometry>::type, Geometry>::apply(
+            reader, geometry);
+    return reader.position();
+}
+
+/*!
+\brief Parses OGC Well-Known Binary (WKB) or PostGIS Extended WKB (EWKB)
+    into a geometry (any geometry), and returns its SRID
+\ingroup wkb
+\tparam Iterator random access iterator over bytes (char or unsigned char)
+\tparam Geometry \tparam_geometry
+\param first iterator to the first byte of the WKB
+\param last iterator after the last byte of the WKB
+\param geometry \param_geometry output geometry
+\param srid the spatial reference id of the EWKB, or 0 if not specified
+\return iterator after the last byte read
+*/
+template <typename Iterator, typename Geometry>
+inline Iterator read_wkb(Iterator first, Iterator last, Geometry& geometry,
+            boost::uint32_t& srid)
+{
+    geometry::concept::check<Geometry>();
+
+    detail::wkb::byte_reader<Iterator, read_wkb_exception> reader(first, last);
+    srid = dispatch::read_wkb<typename tag<Geometry>::type, Geometry>::apply(
+            reader, geometry);
+    return reader.position();
+}
+
+}} // namespace boost::geometry
+
+#endif // BOOST_GEOMETRY_IO_WKB_READ_HPP
@@ -0,0 +1,15 @@
+// Boost.Geometry (aka GGL, Generic Geometry Library)
+
+// Copyright (c) 2026 agent.
+
+// Use, modification and distribution is subject to the Boost Software License,
+// Version 1.0. (See accompanying file LICENSE_1_0.txt or copy at
+// http://www.boost.org/LICENSE_1_0.txt)
+
+#ifndef BOOST_GEOMETRY_IO_WKB_WKB_HPP
+#define BOOST_GEOMETRY_IO_WKB_WKB_HPP
+
+#include <boost/geometry/io/wkb/read.hpp>
+#include <boost/geometry/io/wkb/write.hpp>
+
+#endif // BOOST_GEOMETRY_IO_WKB_WKB_HPP
@@ -0,0 +1,497 @@
+// Boost.Geometry (aka GGL, Generic Geometry Library)
+
+// Copyright (c) 2026 agent.
+
+// Use, modification and distribution is subject to the Boost Software License,
+// Version 1.0. (See accompanying file LICENSE_1_0.txt or copy at
+// http://www.boost.org/LICENSE_1_0.txt)
+
+#ifndef BOOST_GEOMETRY_IO_WKB_WRITE_HPP
+#define BOOST_GEOMETRY_IO_WKB_WRITE_HPP
+
+#include <cstddef>
+
+#include <boost/cstdint.hpp>
+#include <boost/range.hpp>
+
+#include <boost/geometry/algorithms/assign.hpp>
+#include <boost/geometry/algorithms/detail/equals/point_point.hpp>
+#include <boost/geometry/algorithms/detail/interior_iterator.hpp>
+
+#include <boost/geometry/core/access.hpp>
+#include <boost/geometry/core/coordinate_dimension.hpp>
+#include <boost/geometry/core/exterior_ring.hpp>
+#include <boost/geometry/core/interior_rings.hpp>
+#include <boost/geometry/core/point_type.hpp>
+#include <boost/geometry/core/ring_type.hpp>
+#include <boost/geometry/core/tags.hpp>
+
+#include <boost/geometry/geometries/concepts/check.hpp>
+
+#include <boost/geometry/util/range.hpp>
+
+#include <boost/geometry/io/wkb/detail/bytes.hpp>
+
+
+namespace boost { namespace geometry
+{
+
+/*!
+\brief Byte order of written WKB
+\ingroup wkb
+*/
+enum wkb_byte_order
+{
+    wkb_big_endian = 0, /*!< XDR, most significant byte first */
+    wkb_little_endian = 1 /*!< NDR, least significant byte first */
+};
+
+
+#ifndef DOXYGEN_NO_DETAIL
+namespace detail { namespace wkb
+{
+
+// Writes the byte order and the type of a geometry, flagging Z as ISO WKB,
+// or as EWKB if an SRID is written. The SRID is only written for the
+// outermost geometry.
+template <typename Writer>
+inline void write_header(Writer& writer, geometry_type_code code, bool has_z,
+            bool ewkb, bool write_srid, boost::uint32_t srid)
+{
+    boost::uint32_t type = static_cast<boost::uint32_t>(code);
+    if (ewkb)
+    {
+        if (has_z)
+        {
+            type |= ewkb_z_flag;
+        }
+        if (write_srid)
+        {
+            type |= ewkb_srid_flag;
+        }
+    }
+    else if (has_z)
+    {
+        type += iso_z_offset;
+    }
+
+    writer.write_byte(writer.little_endian() ? 1 : 0);
+    writer.write_uint32(type);
+    if (ewkb && write_srid)
+    {
+        writer.write_uint32(srid);
+    }
+}
+
+
+// Writes x, y and z, if the point has 3 or more dimensions
+template <typename Point,
+          std::size_t Dimension = 0,
+          std::size_t DimensionCount = (geometry::dimension<Point>::value < 3
+                                        ? geometry::dimension<Point>::value
+                                        : 3)>
+struct coordinates_writer
+{
+    template <typename Writer>
+    static inline void apply(Writer& writer, Point const& point)
+    {
+        writer.write_double(static_cast<double>(get<Dimension>(point)));
+        coordinates_writer<Point, Dimension + 1, DimensionCount>::apply(
+                    writer, point);
+    }
+};
+
+template <typename Point, std::size_t DimensionCount>
+struct coordinates_writer<Point, DimensionCount, DimensionCount>
+{
+    template <typename Writer>
+    static inline void apply(Writer&, Point const&)
+    {}
+};
+
+
+// Writes the number of points and the points. Rings are always written
+// closed, as in WKT
+template <typename Range>
+struct points_writer
+{
+    template <typename Writer>
+    static inline void apply(Writer& writer, Range const& range,
+                bool force_closed)
+    {
+        typedef typename point_type<Range>::type point_type;
+        typedef typename boost::range_iterator<Range const>::type iterator_type;
+
+        std::size_t const n = boost::size(range);
+        bool const add_closing_point = force_closed
+            && n > 1
+            && ! detail::equals::equals_point_point(range::front(range),
+                                                    range::back(range));
+
+        writer.write_uint32(static_cast<boost::uint32_t>(
+                    add_closing_point ? n + 1 : n));
+
+        for (iterator_type it = boost::begin(range);
+             it != boost::end(range);
+             ++it)
+        {
+            coordinates_writer<point_type>::apply(writer, *it);
+        }
+
+        if (add_closing_point)
+        {
+            coordinates_writer<point_type>::apply(writer, *boost::begin(range));
+        }
+    }
+};
+
+
+template <typename Point>
+struct point_writer
+{
+    template <typename Writer>
+    static inline void apply(Writer& writer, Point const& point)
+    {
+        coordinates_writer<Point>::apply(writer, point);
+    }
+};
+
+
+template <typename Linestring>
+struct linestring_writer
+{
+    template <typename Writer>
+    static inline void apply(Writer& writer, Linestring const& linestring)
+    {
+        points_writer<Linestring>::apply(writer, linestring, false);
+    }
+};
+
+
+template <typename Ring>
+struct ring_writer
+{
+    template <typename Writer>
+    static inline void apply(Writer& writer, Ring const& ring)
+    {
+        writer.write_uint32(1);
+        points_writer<Ring>::apply(writer, ring, true);
+    }
+};
+
+
+template <typename Polygon>
+struct polygon_writer
+{
+    template <typename Writer>
+    static inline void apply(Writer& writer, Polygon const& polygon)
+    {
+        typedef typename ring_type<Polygon>::type ring_type;
+        typename interior_return_type<Polygon const>::type
+            rings = interior_rings(polygon);
+
+        // An empty polygon has no rings
+        bool const empty = boost::empty(exterior_ring(polygon))
+                        && boost::empty(rings);
+
+        writer.write_uint32(empty ? 0
+                : static_cast<boost::uint32_t>(1 + boost::size(rings)));
+        if (empty)
+        {
+            return;
+        }
+
+        points_writer<ring_type>::apply(writer, exterior_ring(polygon), true);
+        for (typename detail::interior_iterator<Polygon const>::type
+                it = boost::begin(rings); it != boost::end(rings); ++it)
+        {
+            points_writer<ring_type>::apply(writer, *it, true);
+        }
+    }
+};
+
+
+// Box (Non-OGC), written as a closed polygon of five points,
+// in two dimensions
+template <typename Box>
+struct box_writer
+{
+    template <typename Writer>
+    static inline void apply(Writer& writer, Box const& box)
+    {
+        double const x1 = static_cast<double>(get<min_corner, 0>(box));
+        double const y1 = static_cast<double>(get<min_corner, 1>(box));
+        double const x2 = static_cast<double>(get<max_corner, 0>(box));
+        double const y2 = static_cast<double>(get<max_corner, 1>(box));
+
+        writer.write_uint32(1);
+        writer.write_uint32(5);
+        write_xy(writer, x1, y1);
+        write_xy(writer, x1, y2);
+        write_xy(writer, x2, y2);
+        write_xy(writer, x2, y1);
+        write_xy(writer, x1, y1);
+    }
+
+private :
+    template <typename Writer>
+    static inline void write_xy(Writer& writer, double x, double y)
+    {
+        writer.write_double(x);
+        writer.write_double(y);
+    }
+};
+
+
+// Segment (Non-OGC), written as a linestring of two points
+template <typename Segment>
+struct segment_writer
+{
+    template <typename Writer>
+    static inline void apply(Writer& writer, Segment const& segment)
+    {
+        typedef typename point_type<Segment>::type point_type;
+
+        point_type p1, p2;
+        detail::assign_point_from_index<0>(segment, p1);
+        detail::assign_point_from_index<1>(segment, p2);
+
+        writer.write_uint32(2);
+        coordinates_writer<point_type>::apply(writer, p1);
+        coordinates_writer<point_type>::apply(writer, p2);
+    }
+};
+
+
+template <typename Geometry, template<typename> class Writer, geometry_type_code Code>
+struct geometry_writer
+{
+    template <typename ByteWriter>
+    static inline void apply(ByteWriter& writer, Geometry const& geometry,
+                bool ewkb, bool write_srid = false, boost::uint32_t srid = 0)
+    {
+        typedef typename point_type<Geometry>::type point_type;
+
+        write_header(writer, Code, dimension<point_type>::value >= 3,
+                     ewkb, write_srid, srid);
+        Writer<Geometry>::apply(writer, geometry);
+    }
+};
+
+
+// Box is always written in two dimensions
+template <typename Box>
+struct box_geometry_writer
+{
+    template <typename ByteWriter>
+    static inline void apply(ByteWriter& writer, Box const& box,
+                bool ewkb, bool write_srid = false, boost::uint32_t srid = 0)
+    {
+        write_header(writer, wkb_polygon, false, ewkb, write_srid, srid);
+        box_writer<Box>::apply(writer, box);
+    }
+};
+
+
+template <typename MultiGeometry, typename SingleWriter, geometry_type_code Code>
+struct multi_writer
+{
+    template <typename ByteWriter>
+    static inline void apply(ByteWriter& writer, MultiGeometry const& geometry,
+                bool ewkb, bool write_srid = false, boost::uint32_t srid = 0)
+    {
+        typedef typename point_type<MultiGeometry>::type point_type;
+        typedef typename boost::range_iterator
+            <
+                MultiGeometry const
+            >::type iterator_type;
+
+        write_header(writer, Code, dimension<point_type>::value >= 3,
+                     ewkb, write_srid, srid);
+        writer.write_uint32(static_cast<boost::uint32_t>(boost::size(geometry)));
+        for (iterator_type it = boost::begin(geometry);
+             it != boost::end(geometry);
+             ++it)
+        {
+            SingleWriter::apply(writer, *it, ewkb);
+        }
+    }
+};
+
+
+}} // namespace detail::wkb
+#endif // DOXYGEN_NO_DETAIL
+
+
+#ifndef DOXYGEN_NO_DISPATCH
+namespace dispatch
+{
+
+template <typename Tag, typename Geometry>
+struct write_wkb {};
+
+
+template <typename Point>
+struct write_wkb<point_tag, Point>
+    : detail::wkb::geometry_writer
+        <
+            Point,
+            detail::wkb::point_writer,
+            detail::wkb::wkb_point
+        >
+{};
+
+template <typename Linestring>
+struct write_wkb<linestring_tag, Linestring>
+    : detail::wkb::geometry_writer
+        <
+            Linestring,
+            detail::wkb::linestring_writer,
+            detail::wkb::wkb_linestring
+        >
+{};
+
+template <typename Ring>
+struct write_wkb<ring_tag, Ring>
+    : detail::wkb::geometry_writer
+        <
+            Ring,
+            detail::wkb::ring_writer,
+            detail::wkb::wkb_polygon
+        >
+{};
+
+template <typename Polygon>
+struct write_wkb<polygon_tag, Polygon>
+    : detail::wkb::geometry_writer
+        <
+            Polygon,
+            detail::wkb::polygon_writer,
+            detail::wkb::wkb_polygon
+        >
+{};
+
+
+template <typename MultiPoint>
+struct write_wkb<multi_point_tag, MultiPoint>
+    : detail::wkb::multi_writer
+        <
+            MultiPoint,
+            write_wkb
+                <
+                    point_tag,
+                    typename boost::range_value<MultiPoint>::type
+                >,
+            detail::wkb::wkb_multi_point
+        >
+{};
+
+template <typename MultiLinestring>
+struct write_wkb<multi_linestring_tag, MultiLinestring>
+    : detail::wkb::multi_writer
+        <
+            MultiLinestring,
+            write_wkb
+                <
+                    linestring_tag,
+                    typename boost::range_value<MultiLinestring>::type
+                >,
+            detail::wkb::wkb_multi_linestring
+        >
+{};
+
+template <typename MultiPolygon>
+struct write_wkb<multi_polygon_tag, MultiPolygon>
+    : detail::wkb::multi_writer
+        <
+            MultiPolygon,
+            write_wkb
+                <
+                    polygon_tag,
+                    typename boost::range_value<MultiPolygon>::type
+                >,
+            detail::wkb::wkb_multi_polygon
+        >
+{};
+
+
+// Box (Non-OGC)
+template <typename Box>
+struct write_wkb<box_tag, Box>
+    : detail::wkb::box_geometry_writer<Box>
+{};
+
+// Segment (Non-OGC)
+template <typename Segment>
+struct write_wkb<segment_tag, Segment>
+    : detail::wkb::geometry_writer
+        <
+            Segment,
+            detail::wkb::segment_writer,
+            detail::wkb::wkb_linestring
+        >
+{};
+
+
+} // namespace dispatch
+#endif // DOXYGEN_NO_DISPATCH
+
+
+/*!
+\brief Writes a geometry as OGC Well-Known Binary (WKB)
+\ingroup wkb
+\details Points with 3 or more dimensions are written with Z (as ISO WKB),
+    other dimensions are not written. Rings are always written closed. A box
+    is written as a polygon, a segment as a linestring.
+\tparam Geometry \tparam_geometry
+\tparam OutputIterator output iterator of bytes, for example a
+    std::back_insert_iterator of a std::vector<unsigned char> or std::string
+\param geometry \param_geometry
+\param out output iterator
+\param byte_order byte order of the WKB
+\return output iterator after the last byte written
+*/
+template <typename Geometry, typename OutputIterator>
+inline OutputIterator write_wkb(Geometry const& geometry, OutputIterator out,
+            wkb_byte_order byte_order = wkb_little_endian)
+{
+    geometry::concept::check<Geometry const>();
+
+    detail::wkb::byte_writer<OutputIterator> writer(out,
+                byte_order == wkb_little_endian);
+    dispatch::write_wkb<typename tag<Geometry>::type, Geometry>::apply(
+            writer, geometry, false);
+    return writer.output();
+}
+
+/*!
+\brief Writes a geometry as PostGIS Extended Well-Known Binary (EWKB),
+    including its SRID
+\ingroup wkb
+\details Z is flagged as EWKB, and the SRID is written for the geometry but
+    not for its elements, as PostGIS does.
+\tparam Geometry \tparam_geometry
+\tparam OutputIterator output iterator of bytes
+\param geometry \param_geometry
+\param out output iterator
+\param srid spatial reference id
+\param byte_order byte order of the EWKB
+\return output iterator after the last byte written
+*/
+template <typename Geometry, typename OutputIterator>
+inline OutputIterator write_ewkb(Geometry const& geometry, OutputIterator out,
+            boost::uint32_t srid,
+            wkb_byte_order byte_order = wkb_little_endian)
+{
+    geometry::concept::check<Geometry const>();
+
+    detail::wkb::byte_writer<OutputIterator> writer(out,
+                byte_order == wkb_little_endian);
+    dispatch::write_wkb<typename tag<Geometry>::type, Geometry>::apply(
+            writer, geometry, true, true, srid);
+    return writer.output();
+}
+
+}} // namespace boost::geometry
+
+#endif // BOOST_GEOMETRY_IO_WKB_WRITE_HPP
@@ -0,0 +1,212 @@
+// Boost.Geometry (aka GGL, Generic Geometry Library)
+
+// Copyright (c) 2026 agent.
+
+// Use, modification and distribution is subject to the Boost Software License,
+// Version 1.0. (See accompanying file LICENSE_1_0.txt or copy at
+// http://www.boost.org/LICENSE_1_0.txt)
+
+#ifndef BOOST_GEOMETRY_IO_WKT_DETAIL_COORDINATE_PARSER_HPP
+#define BOOST_GEOMETRY_IO_WKT_DETAIL_COORDINATE_PARSER_HPP
+
+#include <string>
+
+#include <boost/cstdint.hpp>
+
+#include <boost/geometry/util/coordinate_cast.hpp>
+
+#include <boost/geometry/io/wkt/detail/tokenizer.hpp>
+
+
+namespace boost { namespace geometry
+{
+
+
+#ifndef DOXYGEN_NO_DETAIL
+namespace detail { namespace wkt
+{
+
+
+// Converts a token to a coordinate with coordinate_cast (by default
+// lexical_cast), which needs a string
+template <typename CoordinateType>
+struct coordinate_parser
+{
+    static inline CoordinateType apply(token const& t)
+    {
+        return coordinate_cast<CoordinateType>::apply(
+                    std::string(t.begin(), t.end()));
+    }
+};
+
+
+// Converts a token to a floating point coordinate without a string, if its
+// digits (at most 19) and its power of ten are exactly representable. Then
+// one multiplication or division is done, which is correctly rounded, so
+// the result is the same as of lexical_cast. Other tokens (too many digits,
+// large exponents, nan, inf, invalid numbers) are converted by
+// coordinate_cast, also throwing the same exceptions.
+template <typename T, int MaxPower, boost::uint64_t MaxMantissa>
+struct floating_coordinate_parser
+{
+    static inline T apply(token const& t)
+    {
+        T result;
+        if (! parse(t.begin(), t.end(), result))
+        {
+            result = coordinate_cast<T>::apply(std::string(t.begin(), t.end()));
+        }
+        return result;
+    }
+
+private :
+
+    static inline bool is_digit(char c)
+    {
+        return c >= '0' && c <= '9';
+    }
+
+    static inline T power_of_ten(int n)
+    {
+        static T const powers[] =
+            {
+                1e0, 1e1, 1e2, 1e3, 1e4, 1e5, 1e6, 1e7, 1e8, 1e9, 1e10,
+                1e11, 1e12, 1e13, 1e14, 1e15, 1e16, 1e17, 1e18, 1e19, 1e20,
+                1e21, 1e22
+            };
+        return powers[n];
+    }
+
+    static inline bool parse(char const* it, char const* end, T& result)
+    {
+        bool const negative = it != end && *it == '-';
+        if (it != end && (*it == '-' || *it == '+'))
+        {
+            ++it;
+        }
+
+        boost::uint64_t mantissa = 0;
+        int digits = 0;
+        int exponent = 0;
+        bool has_digits = false;
+
+        for (; it != end && is_digit(*it); ++it)
+        {
+            has_digits = true;
+            int const d = *it - '0';
+            if (digits < 19)
+            {
+                mantissa = mantissa * 10 + d;
+                if (mantissa > 0)
+                {
+                    digits++;
+                }
+            }
+            else if (d != 0)
+            {
+                return false;
+            }
+            else
+            {
+                exponent++;
+            }
+        }
+
+        if (it != end && *it == '.')
+        {
+            for (++it; it != end && is_digit(*it); ++it)
+            {
+                has_digits = true;
+                int const d = *it - '0';
+                if (digits < 19)
+                {
+                    mantissa = mantissa * 10 + d;
+                    if (mantissa > 0)
+                    {
+                        digits++;
+                    }
+                    exponent--;
+                }
+                else if (d != 0)
+                {
+                    return false;
+                }
+            }
+        }
+
+        if (! has_digits)
+        {
+            return false;
+        }
+
+        if (it != end && (*it == 'e' || *it == 'E'))
+        {
+            ++it;
+            bool const negative_exponent = it != end && *it == '-';
+            if (it != end && (*it == '-' || *it == '+'))
+            {
+                ++it;
+            }
+            if (it == end || ! is_digit(*it))
+            {
+                return false;
+            }
+            int value = 0;
+            for (; it != end && is_digit(*it); ++it)
+            {
+                if (value < 10000)
+                {
+                    value = value * 10 + (*it - '0');
+                }
+            }
+            exponent += negative_exponent ? -value : value;
+        }
+
+        if (it != end || mantissa > MaxMantissa)
+        {
+            return false;
+        }
+
+        if (mantissa == 0)
+        {
+            result = negative ? -T(0) : T(0);
+            return true;
+        }
+
+        if (exponent < -MaxPower || exponent > MaxPower)
+        {
+            return false;
+        }
+
+        T const value = static_cast<T>(mantissa);
+        result = exponent < 0
+            ? value / power_of_ten(-exponent)
+            : value * power_of_ten(exponent);
+        if (negative)
+        {
+            result = -result;
+        }
+        return true;
+    }
+};
+
+
+// 2^53 and 10^22 are exact in double, 2^24 and 10^10 in float
+template <>
+struct coordinate_parser<double>
+    : floating_coordinate_parser<double, 22, UINT64_C(9007199254740992)>
+{};
+
+template <>
+struct coordinate_parser<float>
+    : floating_coordinate_parser<float, 10, UINT64_C(16777216)>
+{};
+
+
+}} // namespace detail::wkt
+#endif // DOXYGEN_NO_DETAIL
+
+
+}} // namespace boost::geometry
+
+#endif // BOOST_GEOMETRY_IO_WKT_DETAIL_COORDINATE_PARSER_HPP
@@ -0,0 +1,210 @@
+// Boost.Geometry (aka GGL, Generic Geometry Library)
+
+// Copyright (c) 2026 agent.
+
+// Use, modification and distribution is subject to the Boost Software License,
+// Version 1.0. (See accompanying file LICENSE_1_0.txt or copy at
+// http://www.boost.org/LICENSE_1_0.txt)
+
+#ifndef BOOST_GEOMETRY_IO_WKT_DETAIL_TOKENIZER_HPP
+#define BOOST_GEOMETRY_IO_WKT_DETAIL_TOKENIZER_HPP
+
+#include <cstddef>
+#include <iterator>
+#include <string>
+
+
+namespace boost { namespace geometry
+{
+
+
+#ifndef DOXYGEN_NO_DETAIL
+namespace detail { namespace wkt
+{
+
+// The characters of the WKT, which are only copied into a string
+// if an exception is thrown
+struct source_range
+{
+    source_range(char const* f, char const* l)
+        : first(f)
+        , last(l)
+    {}
+
+    inline operator std::string() const
+    {
+        return std::string(first, last);
+    }
+
+    char const* first;
+    char const* last;
+};
+
+
+// A token, referring to characters of the WKT. It is a range, so it can be
+// compared with boost::iequals
+class token
+{
+public :
+    typedef char const* iterator;
+    typedef char const* const_iterator;
+
+    token()
+        : m_first(NULL)
+        , m_last(NULL)
+    {}
+
+    token(char const* first, char const* last)
+        : m_first(first)
+        , m_last(last)
+    {}
+
+    inline char const* begin() const { return m_first; }
+    inline char const* end() const { return m_last; }
+
+    inline std::size_t size() const
+    {
+        return static_cast<std::size_t>(m_last - m_first);
+    }
+
+    inline bool operator==(char const* value) const
+    {
+        char const* it = m_first;
+        for (; it != m_last && *value != '\0'; ++it, ++value)
+        {
+            if (*it != *value)
+            {
+                return false;
+            }
+        }
+        return it == m_last && *value == '\0';
+    }
+
+    inline bool operator!=(char const* value) const
+    {
+        return ! operator==(value);
+    }
+
+private :
+    char const* m_first;
+    char const* m_last;
+};
+
+
+// Splits the WKT into tokens in the same way as
+// boost::tokenizer<boost::char_separator<char> >(wkt, char_separator(" ", ",()"))
+// did, so spaces are dropped and ",", "(" and ")" are tokens, but without
+// allocating a string for each token
+class tokenizer
+{
+public :
+    class iterator
+    {
+    public :
+        typedef std::forward_iterator_tag iterator_category;
+        typedef wkt::token value_type;
+        typedef std::ptrdiff_t difference_type;
+        typedef wkt::token const* pointer;
+        typedef wkt::token const& reference;
+
+        iterator()
+            : m_last(NULL)
+        {}
+
+        iterator(char const* first, char const* last)
+            : m_last(last)
+        {
+            next(first);
+        }
+
+        inline reference operator*() const { return m_token; }
+        inline pointer operator->() const { return &m_token; }
+
+        inline iterator& operator++()
+        {
+            next(m_token.end());
+            return *this;
+        }
+
+        inline iterator operator++(int)
+        {
+            iterator result = *this;
+            ++(*this);
+            return result;
+        }
+
+        inline bool operator==(iterator const& other) const
+        {
+            return m_token.begin() == other.m_token.begin();
+        }
+
+        inline bool operator!=(iterator const& other) const
+        {
+            return m_token.begin() != other.m_token.begin();
+        }
+
+    private :
+        static inline bool is_kept_separator(char c)
+        {
+            return c == ',' || c == '(' || c == ')';
+        }
+
+        inline void next(char const* it)
+        {
+            while (it != m_last && *it == ' ')
+            {
+                ++it;
+            }
+
+            char const* first = it;
+            if (it != m_last)
+            {
+                if (is_kept_separator(*it))
+                {
+                    ++it;
+                }
+                else
+                {
+                    while (it != m_last && *it != ' ' && ! is_kept_separator(*it))
+                    {
+                        ++it;
+                    }
+                }
+            }
+            m_token = wkt::token(first, it);
+        }
+
+        wkt::token m_token;
+        char const* m_last;
+    };
+
+    typedef iterator const_iterator;
+
+    tokenizer(char const* first, char const* last)
+        : m_first(first)
+        , m_last(last)
+    {}
+
+    inline iterator begin() const
+    {
+        return iterator(m_first, m_last);
+    }
+
+    inline iterator end() const
+    {
+        return iterator(m_last, m_last);
+    }
+
+private :
+    char const* m_first;
+    char const* m_last;
+};
+
+
+}} // namespace detail::wkt
+#endif // DOXYGEN_NO_DETAIL
+
+
+}} // namespace boost::geometry
+
+#endif // BOOST_GEOMETRY_IO_WKT_DETAIL_TOKENIZER_HPP
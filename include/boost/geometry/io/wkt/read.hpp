@@ -23,7 +23,6 @@
 #include <string>
 
 #include <boost/lexical_cast.hpp>
-#include <boost/tokenizer.hpp>
 
 #include <boost/algorithm/string.hpp>
 #include <boost/mpl/if.hpp>
@@ -49,9 +48,9 @@
 
 #include <boost/geometry/geometries/concepts/check.hpp>
 
-#include <boost/geometry/util/coordinate_cast.hpp>
-
+#include <boost/geometry/io/wkt/detail/coordinate_parser.hpp>
 #include <boost/geometry/io/wkt/detail/prefix.hpp>
+#include <boost/geometry/io/wkt/detail/tokenizer.hpp>
 
 namespace boost { namespace geometry
 {
@@ -71,7 +70,7 @@ struct read_wkt_exception : public geometry::exception
         if (it != end)
         {
             source = " at '";
-            source += it->c_str();
+            source.append(boost::begin(*it), boost::end(*it));
             source += "'";
         }
         complete = message + source + " in '" + wkt.substr(0, 100) + "'";
@@ -103,15 +102,13 @@ private :
 namespace detail { namespace wkt
 {
 
-typedef boost::tokenizer<boost::char_separator<char> > tokenizer;
-
 template <typename Point,
           std::size_t Dimension = 0,
           std::size_t DimensionCount = geometry::dimension<Point>::value>
 struct parsing_assigner
 {
     static inline void apply(tokenizer::iterator& it, tokenizer::iterator end,
-            Point& point, std::string const& wkt)
+            Point& point, source_range const& wkt)
     {
         typedef typename coordinate_type<Point>::type coordinate_type;
 
@@ -122,13 +119,11 @@ struct parsing_assigner
         {
             // Initialize missing coordinates to default constructor (zero)
             // OR
-            // Use lexical_cast for conversion to double/int
-            // Note that it is much slower than atof. However, it is more standard
-            // and in parsing the change in performance falls probably away against
-            // the tokenizing
+            // Convert double/float without allocating a string, and other
+            // types with lexical_cast, with the same results
             set<Dimension>(point, finished
                     ? coordinate_type()
-                    : coordinate_cast<coordinate_type>::apply(*it));
+                    : coordinate_parser<coordinate_type>::apply(*it));
         }
         catch(boost::bad_lexical_cast const& blc)
         {
@@ -152,7 +147,7 @@ template <typename Point, std::size_t DimensionCount>
 struct parsing_assigner<Point, DimensionCount, DimensionCount>
 {
     static inline void apply(tokenizer::iterator&, tokenizer::iterator, Point&,
-                std::string const&)
+                source_range const&)
     {
     }
 };
@@ -161,7 +156,7 @@ struct parsing_assigner<Point, DimensionCount, DimensionCount>
 
 template <typename Iterator>
 inline void handle_open_parenthesis(Iterator& it,
-            Iterator const& end, std::string const& wkt)
+            Iterator const& end, source_range const& wkt)
 {
     if (it == end || *it != "(")
     {
@@ -173,7 +168,7 @@ inline void handle_open_parenthesis(Iterator& it,
 
 template <typename Iterator>
 inline void handle_close_parenthesis(Iterator& it,
-            Iterator const& end, std::string const& wkt)
+            Iterator const& end, source_range const& wkt)
 {
     if (it != end && *it == ")")
     {
@@ -187,7 +182,7 @@ inline void handle_close_parenthesis(Iterator& it,
 
 template <typename Iterator>
 inline void check_end(Iterator& it,
-            Iterator const& end, std::string const& wkt)
+            Iterator const& end, source_range const& wkt)
 {
     if (it != end)
     {
@@ -207,7 +202,7 @@ struct container_inserter
     // Version with output iterator
     template <typename OutputIterator>
     static inline void apply(tokenizer::iterator& it, tokenizer::iterator end,
-        std::string const& wkt, OutputIterator out)
+        source_range const& wkt, OutputIterator out)
     {
         handle_open_parenthesis(it, end, wkt);
 
@@ -301,7 +296,7 @@ struct container_appender
     typedef typename geometry::point_type<Geometry>::type point_type;
 
     static inline void apply(tokenizer::iterator& it, tokenizer::iterator end,
-                             std::string const& wkt, Geometry out)
+                             source_range const& wkt, Geometry out)
     {
         handle_open_parenthesis(it, end, wkt);
 
@@ -336,7 +331,7 @@ template <typename P>
 struct point_parser
 {
     static inline void apply(tokenizer::iterator& it, tokenizer::iterator end,
-        std::string const& wkt, P& point)
+        source_range const& wkt, P& point)
     {
         handle_open_parenthesis(it, end, wkt);
         parsing_assigner<P>::apply(it, end, point, wkt);
@@ -349,7 +344,7 @@ template <typename Geometry>
 struct linestring_parser
 {
     static inline void apply(tokenizer::iterator& it, tokenizer::iterator end,
-                std::string const& wkt, Geometry& geometry)
+                source_range const& wkt, Geometry& geometry)
     {
         container_appender<Geometry&>::apply(it, end, wkt, geometry);
     }
@@ -360,7 +355,7 @@ template <typename Ring>
 struct ring_parser
 {
     static inline void apply(tokenizer::iterator& it, tokenizer::iterator end,
-                std::string const& wkt, Ring& ring)
+                source_range const& wkt, Ring& ring)
     {
         // A ring should look like polygon((x y,x y,x y...))
         // So handle the extra opening/closing parentheses
@@ -383,7 +378,7 @@ struct polygon_parser
     typedef container_appender<ring_return_type> appender;
 
     static inline void apply(tokenizer::iterator& it, tokenizer::iterator end,
-                std::string const& wkt, Polygon& poly)
+                source_range const& wkt, Polygon& poly)
     {
 
         handle_open_parenthesis(it, end, wkt);
@@ -423,7 +418,7 @@ struct polygon_parser
 };
 
 
-inline bool one_of(tokenizer::iterator const& it, std::string const& value,
+inline bool one_of(tokenizer::iterator const& it, char const* value,
             bool& is_present)
 {
     if (boost::iequals(*it, value))
@@ -434,7 +429,7 @@ inline bool one_of(tokenizer::iterator const& it, std::string const& value,
     return false;
 }
 
-inline bool one_of(tokenizer::iterator const& it, std::string const& value,
+inline bool one_of(tokenizer::iterator const& it, char const* value,
             bool& present1, bool& present2)
 {
     if (boost::iequals(*it, value))
@@ -473,12 +468,12 @@ inline void handle_empty_z_m(tokenizer::iterator& it, tokenizer::iterator end,
 
 /*!
 \brief Internal, starts parsing
-\param tokens boost tokens, parsed with separator " " and keeping separator "()"
+\param tokens tokens, parsed with separator " " and keeping separator ",()"
 \param geometry string to compare with first token
 */
 template <typename Geometry>
 inline bool initialize(tokenizer const& tokens,
-            std::string const& geometry_name, std::string const& wkt,
+            char const* geometry_name, source_range const& wkt,
             tokenizer::iterator& it)
 {
     it = tokens.begin();
@@ -519,11 +514,11 @@ inline bool initialize(tokenizer const& tokens,
 template <typename Geometry, template<typename> class Parser, typename PrefixPolicy>
 struct geometry_parser
 {
-    static inline void apply(std::string const& wkt, Geometry& geometry)
+    static inline void apply(source_range const& wkt, Geometry& geometry)
     {
         geometry::clear(geometry);
 
-        tokenizer tokens(wkt, boost::char_separator<char>(" ", ",()"));
+        tokenizer tokens(wkt.first, wkt.last);
         tokenizer::iterator it;
         if (initialize<Geometry>(tokens, PrefixPolicy::apply(), wkt, it))
         {
@@ -537,11 +532,11 @@ struct geometry_parser
 template <typename MultiGeometry, template<typename> class Parser, typename PrefixPolicy>
 struct multi_parser
 {
-    static inline void apply(std::string const& wkt, MultiGeometry& geometry)
+    static inline void apply(source_range const& wkt, MultiGeometry& geometry)
     {
         traits::clear<MultiGeometry>::apply(geometry);
 
-        tokenizer tokens(wkt, boost::char_separator<char>(" ", ",()"));
+        tokenizer tokens(wkt.first, wkt.last);
         tokenizer::iterator it;
         if (initialize<MultiGeometry>(tokens, PrefixPolicy::apply(), wkt, it))
         {
@@ -573,7 +568,7 @@ template <typename P>
 struct noparenthesis_point_parser
 {
     static inline void apply(tokenizer::iterator& it, tokenizer::iterator end,
-        std::string const& wkt, P& point)
+        source_range const& wkt, P& point)
     {
         parsing_assigner<P>::apply(it, end, point, wkt);
     }
@@ -582,11 +577,11 @@ struct noparenthesis_point_parser
 template <typename MultiGeometry, typename PrefixPolicy>
 struct multi_point_parser
 {
-    static inline void apply(std::string const& wkt, MultiGeometry& geometry)
+    static inline void apply(source_range const& wkt, MultiGeometry& geometry)
     {
         traits::clear<MultiGeometry>::apply(geometry);
 
-        tokenizer tokens(wkt, boost::char_separator<char>(" ", ",()"));
+        tokenizer tokens(wkt.first, wkt.last);
         tokenizer::iterator it;
 
         if (initialize<MultiGeometry>(tokens, PrefixPolicy::apply(), wkt, it))
@@ -642,10 +637,10 @@ struct multi_point_parser
 template <typename Box>
 struct box_parser
 {
-    static inline void apply(std::string const& wkt, Box& box)
+    static inline void apply(source_range const& wkt, Box& box)
     {
         bool should_close = false;
-        tokenizer tokens(wkt, boost::char_separator<char>(" ", ",()"));
+        tokenizer tokens(wkt.first, wkt.last);
         tokenizer::iterator it = tokens.begin();
         tokenizer::iterator end = tokens.end();
         if (it != end && boost::iequals(*it, "POLYGON"))
@@ -712,9 +707,9 @@ struct box_parser
 template <typename Segment>
 struct segment_parser
 {
-    static inline void apply(std::string const& wkt, Segment& segment)
+    static inline void apply(source_range const& wkt, Segment& segment)
     {
-        tokenizer tokens(wkt, boost::char_separator<char>(" ", ",()"));
+        tokenizer tokens(wkt.first, wkt.last);
         tokenizer::iterator it = tokens.begin();
         tokenizer::iterator end = tokens.end();
         if (it != end &&
@@ -860,7 +855,29 @@ template <typename Geometry>
 inline void read_wkt(std::string const& wkt, Geometry& geometry)
 {
     geometry::concept::check<Geometry>();
-    dispatch::read_wkt<typename tag<Geometry>::type, Geometry>::apply(wkt, geometry);
+    char const* first = wkt.data();
+    dispatch::read_wkt<typename tag<Geometry>::type, Geometry>::apply(
+            detail::wkt::source_range(first, first + wkt.size()), geometry);
+}
+
+/*!
+\brief Parses OGC Well-Known Text (\ref WKT) from a range of characters
+    into a geometry (any geometry)
+\ingroup wkt
+\details The characters are not copied, and no strings are allocated while
+    parsing, so this is the fastest way to read many geometries from a
+    buffer, for example a memory mapped file.
+\tparam Geometry \tparam_geometry
+\param first pointer to the first character of the \ref WKT
+\param last pointer after the last character of the \ref WKT
+\param geometry \param_geometry output geometry
+*/
+template <typename Geometry>
+inline void read_wkt(char const* first, char const* last, Geometry& geometry)
+{
+    geometry::concept::check<Geometry>();
+    dispatch::read_wkt<typename tag<Geometry>::type, Geometry>::apply(
+            detail::wkt::source_range(first, last), geometry);
 }
 
 }} // namespace boost::geometry
@@ -15,13 +15,25 @@
 
 
 #include <cstddef>
+#include <functional>
+#include <utility>
 #include <vector>
 
+#include <boost/core/addressof.hpp>
+#include <boost/mpl/and.hpp>
+#include <boost/mpl/bool.hpp>
 #include <boost/range.hpp>
+#include <boost/type_traits/is_reference.hpp>
+#include <boost/type_traits/is_same.hpp>
+#include <boost/type_traits/remove_cv.hpp>
+#include <boost/type_traits/remove_reference.hpp>
 
 #include <boost/geometry/core/cs.hpp>
 #include <boost/geometry/strategies/distance.hpp>
 
+#if defined(BOOST_GEOMETRY_EXPERIMENTAL_ENABLE_PARALLEL_SIMPLIFY)
+#include <boost/geometry/util/detail/parallel_tasks.hpp>
+#endif
 
 
 //#define GL_DEBUG_DOUGLAS_PEUCKER
@@ -38,31 +50,145 @@ namespace strategy { namespace simplify
 {
 
 
-#ifndef DOXYGEN_NO_DETAIL
-namespace detail
+/*!
+\brief Buffer used by the douglas_peucker strategy
+\ingroup strategies
+\details The buffer keeps the memory allocated for the points and the work
+    stack of the douglas_peucker strategy. It may be passed to the strategy
+    to reuse it for many calls, e.g. simplifying many linestrings.
+\tparam Point the point type
+*/
+template <typename Point>
+class douglas_peucker_buffer
 {
+public :
+    inline void clear()
+    {
+        points.clear();
+        copies.clear();
+        included.clear();
+        stack.clear();
+    }
 
     /*!
-        \brief Small wrapper around a point, with an extra member "included"
-        \details
-            It has a const-reference to the original point (so no copy here)
-        \tparam the enclosed point type
+    \brief Returns true if the point at the specified index of the range
+        simplified last with this buffer is kept
     */
-    template<typename Point>
-    struct douglas_peucker_point
+    inline bool is_included(std::size_t index) const
     {
-        Point const& p;
-        bool included;
+        return included[index] != 0;
+    }
 
-        inline douglas_peucker_point(Point const& ap)
-            : p(ap)
-            , included(false)
-        {}
+#ifndef DOXYGEN_NO_DETAIL
+    std::vector<Point const*> points;
+    std::vector<Point> copies;
+    std::vector<char> included;
+    std::vector<std::pair<std::size_t, std::size_t> > stack;
+#endif
+};
+
+
+#ifndef DOXYGEN_NO_DETAIL
+namespace detail
+{
+
+#if defined(BOOST_GEOMETRY_EXPERIMENTAL_ENABLE_PARALLEL_SIMPLIFY)
+    // The number of threads used by douglas_peucker and by simplify of
+    // multi-geometries, one if already running in a task
+    inline std::size_t simplify_threads_count()
+    {
+#if defined(BOOST_GEOMETRY_SIMPLIFY_THREADS)
+        return geometry::detail::parallel::threads_count(
+                    BOOST_GEOMETRY_SIMPLIFY_THREADS);
+#else
+        return geometry::detail::parallel::threads_count(0);
+#endif
+    }
+#endif
+
+    // The points of the range may be referred to only if its iterators
+    // return references to Points, e.g. not for transformed ranges
+    template <typename Range, typename Point>
+    struct douglas_peucker_refers_points
+        : boost::mpl::and_
+            <
+                boost::is_reference
+                    <
+                        typename boost::range_reference<Range const>::type
+                    >,
+                boost::is_same
+                    <
+                        typename boost::remove_cv
+                            <
+                                typename boost::remove_reference
+                                    <
+                                        typename boost::range_reference<Range const>::type
+                                    >::type
+                            >::type,
+                        Point
+                    >
+            >
+    {};
+
+    // Compares the comparable distances (e.g. the squared distances) if the
+    // distances are compared by the default less comparator
+    template
+    <
+        typename Point,
+        typename PointDistanceStrategy,
+        bool UseComparable
+    >
+    struct douglas_peucker_distance
+    {
+        typedef typename strategy::distance::services::comparable_type
+            <
+                PointDistanceStrategy
+            >::type strategy_type;
 
-        // Necessary for proper compilation
-        inline douglas_peucker_point<Point> operator=(douglas_peucker_point<Point> const& )
+        typedef typename strategy::distance::services::return_type
+            <
+                strategy_type, Point, Point
+            >::type distance_type;
+
+        static inline strategy_type get_strategy()
         {
-            return douglas_peucker_point<Point>(*this);
+            return strategy::distance::services::get_comparable
+                <
+                    PointDistanceStrategy
+                >::apply(PointDistanceStrategy());
+        }
+
+        template <typename T>
+        static inline distance_type max_distance(strategy_type const& strategy,
+                                                 T const& value)
+        {
+            return strategy::distance::services::result_from_distance
+                <
+                    strategy_type, Point, Point
+                >::apply(strategy, value);
+        }
+    };
+
+    template <typename Point, typename PointDistanceStrategy>
+    struct douglas_peucker_distance<Point, PointDistanceStrategy, false>
+    {
+        typedef PointDistanceStrategy strategy_type;
+
+        typedef typename strategy::distance::services::return_type
+            <
+                strategy_type, Point, Point
+            >::type distance_type;
+
+        static inline strategy_type get_strategy()
+        {
+            return strategy_type();
+        }
+
+        template <typename T>
+        static inline distance_type max_distance(strategy_type const& ,
+                                                 T const& value)
+        {
+            return value;
         }
     };
 
@@ -85,11 +211,7 @@ namespace detail
     {
     public :
 
-        // See also ticket 5954 https://svn.boost.org/trac/boost/ticket/5954
-        // Comparable is currently not possible here because it has to be compared to the squared of max_distance, and more.
-        // For now we have to take the real distance.
         typedef PointDistanceStrategy distance_strategy_type;
-        // typedef typename strategy::distance::services::comparable_type<PointDistanceStrategy>::type distance_strategy_type;
 
         typedef typename strategy::distance::services::return_type
                          <
@@ -97,6 +219,8 @@ namespace detail
                              Point, Point
                          >::type distance_type;
 
+        typedef douglas_peucker_buffer<Point> buffer_type;
+
         douglas_peucker()
         {}
 
@@ -105,86 +229,235 @@ namespace detail
         {}
 
     private :
-        typedef detail::douglas_peucker_point<Point> dp_point_type;
-        typedef typename std::vector<dp_point_type>::iterator iterator_type;
 
+        // The distances are compared to the squared max_distance (or another
+        // comparable value) if the default less comparator is used, which
+        // avoids a square root per point. Other comparators (e.g. comparing
+        // the along and cross track distances) get the real distances.
+        typedef douglas_peucker_distance
+            <
+                Point,
+                PointDistanceStrategy,
+                boost::is_same
+                    <
+                        LessCompare, std::less<distance_type>
+                    >::value
+            > dp_distance;
+
+        typedef typename dp_distance::strategy_type comparable_strategy_type;
+        typedef typename dp_distance::distance_type comparable_distance_type;
 
         LessCompare const& less() const
         {
             return *this;
         }
 
-        inline void consider(iterator_type begin,
-                             iterator_type end,
-                             distance_type const& max_dist,
-                             int& n,
-                             distance_strategy_type const& ps_distance_strategy) const
+        typedef std::vector<Point const*> points_type;
+        typedef std::vector<std::pair<std::size_t, std::size_t> > stack_type;
+
+        // Finds the furthest point between the points with indices first
+        // and last (there should be at least one), returns true and sets
+        // candidate if it is further than max_distance
+        inline bool find_candidate(points_type const& points,
+                                   std::size_t first, std::size_t last,
+                                   comparable_distance_type const& max_dist,
+                                   comparable_strategy_type const& ps_distance_strategy,
+                                   std::size_t& candidate) const
         {
-            std::size_t size = end - begin;
+            Point const& p1 = *points[first];
+            Point const& p2 = *points[last];
 
-            // size must be at least 3
-            // because we want to consider a candidate point in between
-            if (size <= 2)
-            {
 #ifdef GL_DEBUG_DOUGLAS_PEUCKER
-                if (begin != end)
-                {
-                    std::cout << "ignore between " << dsv(begin->p)
-                        << " and " << dsv((end - 1)->p)
-                        << " size=" << size << std::endl;
-                }
-                std::cout << "return because size=" << size << std::endl;
+            std::cout << "find between " << dsv(p1)
+                << " and " << dsv(p2)
+                << " size=" << last - first + 1 << std::endl;
 #endif
-                return;
-            }
-
-            iterator_type last = end - 1;
-
-#ifdef GL_DEBUG_DOUGLAS_PEUCKER
-            std::cout << "find between " << dsv(begin->p)
-                << " and " << dsv(last->p)
-                << " size=" << size << std::endl;
-#endif
-
 
             // Find most far point, compare to the current segment
-            //geometry::segment<Point const> s(begin->p, last->p);
-            distance_type md(-1.0); // any value < 0
-            iterator_type candidate;
-            for(iterator_type it = begin + 1; it != last; ++it)
+            comparable_distance_type md(-1.0); // any value < 0
+            candidate = first;
+            for (std::size_t i = first + 1; i < last; i++)
             {
-                distance_type dist = ps_distance_strategy.apply(it->p, begin->p, last->p);
+                comparable_distance_type const dist
+                    = ps_distance_strategy.apply(*points[i], p1, p2);
 
 #ifdef GL_DEBUG_DOUGLAS_PEUCKER
-                std::cout << "consider " << dsv(it->p)
+                std::cout << "consider " << dsv(*points[i])
                     << " at " << double(dist)
                     << ((dist > max_dist) ? " maybe" : " no")
                     << std::endl;
-
 #endif
                 if ( less()(md, dist) )
                 {
                     md = dist;
-                    candidate = it;
+                    candidate = i;
                 }
             }
 
-            // If a point is found, set the include flag
-            // and handle segments in between recursively
+#ifdef GL_DEBUG_DOUGLAS_PEUCKER
             if ( less()(max_dist, md) )
             {
-#ifdef GL_DEBUG_DOUGLAS_PEUCKER
-                std::cout << "use " << dsv(candidate->p) << std::endl;
+                std::cout << "use " << dsv(*points[candidate]) << std::endl;
+            }
 #endif
+            return less()(max_dist, md);
+        }
+
+        // Considers the ranges on the stack, the furthest point of a range
+        // is included if it is further than max_distance. Then the ranges
+        // at both sides of it are considered, using the stack instead of
+        // recursion
+        inline void consider(points_type const& points,
+                             std::vector<char>& included,
+                             stack_type& stack,
+                             comparable_distance_type const& max_dist,
+                             comparable_strategy_type const& ps_distance_strategy) const
+        {
+            while (! stack.empty())
+            {
+                std::size_t const first = stack.back().first;
+                std::size_t const last = stack.back().second;
+                stack.pop_back();
+
+                std::size_t candidate = first;
+                if (last - first > 1
+                    && find_candidate(points, first, last, max_dist,
+                                      ps_distance_strategy, candidate))
+                {
+                    // Set the include flag and handle the ranges in between,
+                    // the first one first
+                    included[candidate] = 1;
+                    stack.push_back(std::make_pair(candidate, last));
+                    stack.push_back(std::make_pair(first, candidate));
+                }
+            }
+        }
+
+#if defined(BOOST_GEOMETRY_EXPERIMENTAL_ENABLE_PARALLEL_SIMPLIFY)
+        // Below this number of points the threads aren't worth starting
+        static inline std::size_t parallel_min_points()
+        {
+            return 16384;
+        }
+
+        // Considers one of the ranges, with its own stack. The ranges are
+        // disjoint, so the threads set different include flags.
+        struct consider_tasks
+        {
+            consider_tasks(douglas_peucker const& dp,
+                           buffer_type& buffer,
+                           stack_type const& ranges,
+                           comparable_distance_type const& max_dist,
+                           comparable_strategy_type const& ps_distance_strategy)
+                : m_dp(dp)
+                , m_buffer(buffer)
+                , m_ranges(ranges)
+                , m_max_dist(max_dist)
+                , m_strategy(ps_distance_strategy)
+            {}
+
+            inline std::size_t size() const
+            {
+                return m_ranges.size();
+            }
+
+            inline void run(std::size_t i) const
+            {
+                stack_type stack(1, m_ranges[i]);
+                m_dp.consider(m_buffer.points, m_buffer.included, stack,
+                              m_max_dist, m_strategy);
+            }
 
-                candidate->included = true;
-                n++;
+            douglas_peucker const& m_dp;
+            buffer_type& m_buffer;
+            stack_type const& m_ranges;
+            comparable_distance_type const& m_max_dist;
+            comparable_strategy_type const& m_strategy;
+        };
+
+        // Splits the ranges breadth first until there are enough of them,
+        // about 8 per thread, and considers them concurrently. The same
+        // points are included as in the serial case.
+        inline void consider_parallel(buffer_type& buffer,
+                                      comparable_distance_type const& max_dist,
+                                      comparable_strategy_type const& ps_distance_strategy) const
+        {
+            std::size_t const threads_count = simplify_threads_count();
+            if (threads_count < 2
+                || buffer.points.size() < parallel_min_points())
+            {
+                consider(buffer.points, buffer.included, buffer.stack,
+                         max_dist, ps_distance_strategy);
+                return;
+            }
+
+            std::size_t const min_range_points
+                = parallel_min_points() / (8 * threads_count);
 
-                consider(begin, candidate + 1, max_dist, n, ps_distance_strategy);
-                consider(candidate, end, max_dist, n, ps_distance_strategy);
+            stack_type ranges;
+            std::size_t index = 0;
+            while (index < buffer.stack.size()
+                   && ranges.size() + buffer.stack.size() - index
+                        < 8 * threads_count)
+            {
+                std::size_t const first = buffer.stack[index].first;
+                std::size_t const last = buffer.stack[index].second;
+                std::size_t candidate = first;
+                if (last - first <= min_range_points)
+                {
+                    ranges.push_back(buffer.stack[index]);
+                }
+                else if (find_candidate(buffer.points, first, last, max_dist,
+                                        ps_distance_strategy, candidate))
+                {
+                    buffer.included[candidate] = 1;
+                    buffer.stack.push_back(std::make_pair(first, candidate));
+                    buffer.stack.push_back(std::make_pair(candidate, last));
+                }
+                index++;
             }
+            ranges.insert(ranges.end(),
+                          buffer.stack.begin() + index, buffer.stack.end());
+            buffer.stack.clear();
+
+            geometry::detail::parallel::run_tasks(
+                consider_tasks(*this, buffer, ranges,
+                               max_dist, ps_distance_strategy),
+                threads_count);
         }
+#endif
 
+        // Refers to all points, without copying them
+        template <typename Range>
+        static inline void fill_points(Range const& range,
+                                       buffer_type& buffer,
+                                       boost::mpl::true_ /*refers_points*/)
+        {
+            for (typename boost::range_iterator<Range const>::type
+                    it = boost::begin(range); it != boost::end(range); ++it)
+            {
+                buffer.points.push_back(boost::addressof(*it));
+            }
+        }
+
+        // Copies the points returned by value (or of another type) by the
+        // iterators, and refers to the copies
+        template <typename Range>
+        static inline void fill_points(Range const& range,
+                                       buffer_type& buffer,
+                                       boost::mpl::false_ /*refers_points*/)
+        {
+            for (typename boost::range_iterator<Range const>::type
+                    it = boost::begin(range); it != boost::end(range); ++it)
+            {
+                buffer.copies.push_back(*it);
+            }
+            for (typename std::vector<Point>::const_iterator
+                    it = buffer.copies.begin(); it != buffer.copies.end(); ++it)
+            {
+                buffer.points.push_back(boost::addressof(*it));
+            }
+        }
 
     public :
 
@@ -193,34 +466,59 @@ namespace detail
                                     OutputIterator out,
                                     distance_type max_distance) const
         {
-            distance_strategy_type strategy;
+            buffer_type buffer;
+            return apply(range, out, max_distance, buffer);
+        }
+
+        template <typename Range, typename OutputIterator>
+        inline OutputIterator apply(Range const& range,
+                                    OutputIterator out,
+                                    distance_type max_distance,
+                                    buffer_type& buffer) const
+        {
+            buffer.clear();
 
-            // Copy coordinates, a vector of references to all points
-            std::vector<dp_point_type> ref_candidates(boost::begin(range),
-                            boost::end(range));
+            fill_points(range, buffer,
+                        boost::mpl::bool_
+                            <
+                                douglas_peucker_refers_points<Range, Point>::value
+                            >());
+
+            std::size_t const count = buffer.points.size();
+            if (count == 0)
+            {
+                return out;
+            }
 
             // Include first and last point of line,
             // they are always part of the line
-            int n = 2;
-            ref_candidates.front().included = true;
-            ref_candidates.back().included = true;
+            buffer.included.resize(count, 0);
+            buffer.included.front() = 1;
+            buffer.included.back() = 1;
 
-            // Get points, recursively, including them if they are further away
+            // Get points, including them if they are further away
             // than the specified distance
-            consider(boost::begin(ref_candidates), boost::end(ref_candidates), max_distance, n, strategy);
+            comparable_strategy_type const strategy = dp_distance::get_strategy();
+            buffer.stack.push_back(std::make_pair(std::size_t(0), count - 1));
+#if defined(BOOST_GEOMETRY_EXPERIMENTAL_ENABLE_PARALLEL_SIMPLIFY)
+            consider_parallel(buffer,
+                              dp_distance::max_distance(strategy, max_distance),
+                              strategy);
+#else
+            consider(buffer.points, buffer.included, buffer.stack,
+                     dp_distance::max_distance(strategy, max_distance),
+                     strategy);
+#endif
 
             // Copy included elements to the output
-            for(typename std::vector<dp_point_type>::const_iterator it
-                            = boost::begin(ref_candidates);
-                it != boost::end(ref_candidates);
-                ++it)
+            for (std::size_t i = 0; i < count; i++)
             {
-                if (it->included)
+                if (buffer.included[i])
                 {
                     // copy-coordinates does not work because OutputIterator
                     // does not model Point (??)
                     //geometry::convert(it->p, *out);
-                    *out = it->p;
+                    *out = *buffer.points[i];
                     out++;
                 }
             }
@@ -242,7 +540,14 @@ namespace detail
 \tparam Point the point type
 \tparam PointDistanceStrategy point-segment distance strategy to be used
 \note This strategy uses itself a point-segment-distance strategy which
-    can be specified
+    can be specified. The comparable distances of that strategy are compared
+    with the comparable max_distance, so e.g. squared Cartesian distances
+    are compared and no square roots are calculated
+\note The ranges to simplify are kept on a stack, instead of recursively,
+    so there is no risk of a too deep recursion for very long linestrings
+\note If BOOST_GEOMETRY_EXPERIMENTAL_ENABLE_PARALLEL_SIMPLIFY is defined,
+    the sub-ranges of large ranges are considered in threads (requires
+    Boost.Thread). The included points are the same as serially
 \author Barend and Maarten, 1995/1996
 \author Barend, revised for Generic Geometry Library, 2008
 */
@@ -271,6 +576,8 @@ public :
 
     typedef distance_type return_type;
 
+    typedef douglas_peucker_buffer<Point> buffer_type;
+
     template <typename Range, typename OutputIterator>
     static inline OutputIterator apply(Range const& range,
                                        OutputIterator out,
@@ -283,20 +590,25 @@ public :
             >().apply(range, out, max_distance);
     }
 
-};
-
-}} // namespace strategy::simplify
-
-
-namespace traits {
+    /*!
+    \brief Simplifies the range, reusing the memory of the buffer
+    */
+    template <typename Range, typename OutputIterator>
+    static inline OutputIterator apply(Range const& range,
+                                       OutputIterator out,
+                                       distance_type max_distance,
+                                       buffer_type& buffer)
+    {
+        return detail::douglas_peucker
+            <
+                Point,
+                PointDistanceStrategy
+            >().apply(range, out, max_distance, buffer);
+    }
 
-template <typename P>
-struct point_type<strategy::simplify::detail::douglas_peucker_point<P> >
-{
-    typedef P type;
 };
 
-} // namespace traits
+}} // namespace strategy::simplify
 
 
 }} // namespace boost::geometry
@@ -0,0 +1,343 @@
+// Boost.Geometry (aka GGL, Generic Geometry Library)
+
+// Copyright (c) 2026 agent.
+
+// Use, modification and distribution is subject to the Boost Software License,
+// Version 1.0. (See accompanying file LICENSE_1_0.txt or copy at
+// http://www.boost.org/LICENSE_1_0.txt)
+
+#ifndef BOOST_GEOMETRY_STRATEGIES_CARTESIAN_HULL_AKL_TOUSSAINT_HPP
+#define BOOST_GEOMETRY_STRATEGIES_CARTESIAN_HULL_AKL_TOUSSAINT_HPP
+
+
+#include <cstddef>
+#include <iterator>
+#include <vector>
+
+#include <boost/range.hpp>
+
+#include <boost/geometry/core/access.hpp>
+#include <boost/geometry/core/coordinate_type.hpp>
+#include <boost/geometry/core/cs.hpp>
+#include <boost/geometry/core/point_type.hpp>
+
+#include <boost/geometry/geometries/multi_point.hpp>
+
+#include <boost/geometry/policies/compare.hpp>
+
+#include <boost/geometry/strategies/agnostic/hull_graham_andrew.hpp>
+#include <boost/geometry/strategies/side.hpp>
+
+#include <boost/geometry/util/select_most_precise.hpp>
+
+#include <boost/geometry/views/detail/range_type.hpp>
+
+#include <boost/geometry/algorithms/detail/equals/point_point.hpp>
+#include <boost/geometry/algorithms/detail/for_each_range.hpp>
+
+#if defined(BOOST_GEOMETRY_EXPERIMENTAL_ENABLE_PARALLEL_CONVEX_HULL)
+#include <boost/geometry/util/detail/parallel_tasks.hpp>
+#endif
+
+
+namespace boost { namespace geometry
+{
+
+namespace strategy { namespace convex_hull
+{
+
+#ifndef DOXYGEN_NO_DETAIL
+namespace detail
+{
+
+
+// Collects the extreme points of the ranges in the eight directions
+// -x, -x-y, -y, x-y, x, x+y, y, -x+y. In this order they form a convex
+// octagon (possibly with coinciding vertices), counterclockwise, with all
+// its vertices on the convex hull.
+template <typename InputRange, typename Point>
+struct get_octagon
+{
+    typedef typename select_most_precise
+        <
+            typename coordinate_type<Point>::type,
+            double
+        >::type calculation_type;
+
+    Point vertices[8];
+    calculation_type values[8];
+    bool first;
+
+    inline get_octagon()
+        : first(true)
+    {}
+
+    inline void apply(InputRange const& range)
+    {
+        typedef typename boost::range_iterator
+            <
+                InputRange const
+            >::type iterator_type;
+
+        for (iterator_type it = boost::begin(range);
+            it != boost::end(range);
+            ++it)
+        {
+            calculation_type const x = get<0>(*it);
+            calculation_type const y = get<1>(*it);
+            calculation_type const current[8] =
+                {
+                    -x, -x - y, -y, x - y, x, x + y, y, y - x
+                };
+
+            for (int i = 0; i < 8; i++)
+            {
+                if (first || current[i] > values[i])
+                {
+                    values[i] = current[i];
+                    vertices[i] = *it;
+                }
+            }
+            first = false;
+        }
+    }
+};
+
+
+// Copies the points which are not strictly inside the octagon, and are
+// therefore possibly on the convex hull
+template <typename InputRange, typename Container, typename SideStrategy>
+struct assign_outside_octagon
+{
+    typedef typename boost::range_value<Container>::type point_type;
+
+    Container points;
+
+    point_type const* edges[8][2];
+    int edge_count;
+
+    template <typename Octagon>
+    inline assign_outside_octagon(Octagon const& octagon)
+        : edge_count(0)
+    {
+        for (int i = 0; i < 8; i++)
+        {
+            point_type const& p1 = octagon.vertices[i];
+            point_type const& p2 = octagon.vertices[(i + 1) % 8];
+            if (! geometry::detail::equals::equals_point_point(p1, p2))
+            {
+                edges[edge_count][0] = &p1;
+                edges[edge_count][1] = &p2;
+                edge_count++;
+            }
+        }
+    }
+
+    inline void apply(InputRange const& range)
+    {
+        typedef typename boost::range_iterator
+            <
+                InputRange const
+            >::type iterator_type;
+
+        for (iterator_type it = boost::begin(range);
+            it != boost::end(range);
+            ++it)
+        {
+            if (! inside(*it))
+            {
+                points.push_back(*it);
+            }
+        }
+    }
+
+private :
+
+    inline bool inside(point_type const& point) const
+    {
+        if (edge_count < 3)
+        {
+            // Degenerate octagon, nothing is inside
+            return false;
+        }
+        for (int i = 0; i < edge_count; i++)
+        {
+            if (SideStrategy::apply(*edges[i][0], *edges[i][1], point) <= 0)
+            {
+                return false;
+            }
+        }
+        return true;
+    }
+};
+
+
+#if defined(BOOST_GEOMETRY_EXPERIMENTAL_ENABLE_PARALLEL_CONVEX_HULL)
+
+inline std::size_t convex_hull_threads_count()
+{
+#if defined(BOOST_GEOMETRY_CONVEX_HULL_THREADS)
+    return geometry::detail::parallel::threads_count(
+                BOOST_GEOMETRY_CONVEX_HULL_THREADS);
+#else
+    return geometry::detail::parallel::threads_count(0);
+#endif
+}
+
+// Calculates the hulls of consecutive parts of the points, each task
+// sorting its own part
+template <typename Container, typename Hull>
+class partial_hulls_tasks
+{
+    typedef typename boost::range_iterator<Container const>::type iterator;
+
+public :
+    partial_hulls_tasks(Container const& points, std::size_t count,
+                        std::vector<Container>& hulls)
+        : m_points(points)
+        , m_count(count)
+        , m_hulls(hulls)
+    {}
+
+    inline std::size_t size() const
+    {
+        return m_count;
+    }
+
+    inline void run(std::size_t i) const
+    {
+        std::size_t const size = boost::size(m_points);
+        iterator first = boost::begin(m_points);
+        std::advance(first, size * i / m_count);
+        iterator last = boost::begin(m_points);
+        std::advance(last, size * (i + 1) / m_count);
+
+        Container part(first, last);
+        Container& hull = m_hulls[i];
+        hull.clear();
+
+        Hull strategy;
+        typename Hull::state_type state;
+        strategy.apply(part, state);
+        strategy.result(state, std::back_inserter(hull), false, false);
+    }
+
+private :
+    Container const& m_points;
+    std::size_t m_count;
+    std::vector<Container>& m_hulls;
+};
+
+#endif
+
+
+} // namespace detail
+#endif // DOXYGEN_NO_DETAIL
+
+
+/*!
+\brief Convex hull strategy dropping the points inside the Akl-Toussaint
+    octagon before calculating the hull with Graham-Andrew
+\ingroup strategies
+\details The extreme points of the input in eight directions (of x, y, x+y
+    and x-y) lie on the convex hull. The points strictly inside the octagon
+    they form cannot be part of the hull, so they are neither copied nor
+    sorted. For large point clouds this is most of the points. The hull of
+    the remaining points is calculated by graham_andrew, so the result is
+    the same.
+\tparam InputGeometry input geometry type
+\tparam OutputPoint point type of the output
+\note If BOOST_GEOMETRY_EXPERIMENTAL_ENABLE_PARALLEL_CONVEX_HULL is defined,
+    and many points remain, they are divided into parts of which the hulls
+    are calculated (and the points sorted) in threads. The hull of these
+    hulls is the hull of all points. The number of threads is
+    BOOST_GEOMETRY_CONVEX_HULL_THREADS if defined, otherwise the number of
+    hardware threads. Boost.Thread has to be linked then.
+\see A.M. Akl, G.T. Toussaint, A fast convex hull algorithm,
+    Information Processing Letters 7(5), 1978
+
+\qbk{
+[heading See also]
+[link geometry.reference.algorithms.convex_hull.convex_hull_3_with_strategy convex_hull (with strategy)]
+}
+ */
+template <typename InputGeometry, typename OutputPoint>
+class akl_toussaint
+{
+public :
+    typedef OutputPoint point_type;
+    typedef InputGeometry geometry_type;
+
+private :
+
+    typedef typename cs_tag<point_type>::type cs_tag;
+    typedef model::multi_point<point_type> container_type;
+    typedef graham_andrew<container_type, point_type> hull_type;
+
+#if defined(BOOST_GEOMETRY_EXPERIMENTAL_ENABLE_PARALLEL_CONVEX_HULL)
+    // Minimal number of points remaining after filtering to calculate
+    // partial hulls in threads
+    static std::size_t const min_parallel_points = 65536;
+#endif
+
+public :
+    typedef typename hull_type::state_type state_type;
+
+    inline void apply(InputGeometry const& geometry, state_type& state) const
+    {
+        typedef typename geometry::detail::range_type<InputGeometry>::type range_type;
+
+        // First pass: the octagon
+        detail::get_octagon<range_type, point_type> octagon;
+        geometry::detail::for_each_range(geometry, octagon);
+
+        // Second pass: the points outside of it
+        detail::assign_outside_octagon
+            <
+                range_type,
+                container_type,
+                typename strategy::side::services::default_strategy<cs_tag>::type
+            > assigner(octagon);
+        geometry::detail::for_each_range(geometry, assigner);
+
+#if defined(BOOST_GEOMETRY_EXPERIMENTAL_ENABLE_PARALLEL_CONVEX_HULL)
+        std::size_t const threads_count = detail::convex_hull_threads_count();
+        if (threads_count > 1
+            && boost::size(assigner.points) >= min_parallel_points)
+        {
+            std::vector<container_type> hulls(threads_count);
+            geometry::detail::parallel::run_tasks(
+                detail::partial_hulls_tasks<container_type, hull_type>
+                    (assigner.points, threads_count, hulls),
+                threads_count);
+
+            container_type merged;
+            for (std::size_t i = 0; i < hulls.size(); i++)
+            {
+                merged.insert(merged.end(), hulls[i].begin(), hulls[i].end());
+            }
+            hull_type().apply(merged, state);
+            return;
+        }
+#endif
+
+        hull_type().apply(assigner.points, state);
+    }
+
+    template <typename OutputIterator>
+    inline void result(state_type const& state,
+                       OutputIterator out,
+                       bool clockwise,
+                       bool closed) const
+    {
+        hull_type().result(state, out, clockwise, closed);
+    }
+};
+
+}} // namespace strategy::convex_hull
+
+
+}} // namespace boost::geometry
+
+
+#endif // BOOST_GEOMETRY_STRATEGIES_CARTESIAN_HULL_AKL_TOUSSAINT_HPP
@@ -0,0 +1,348 @@
+// Boost.Geometry (aka GGL, Generic Geometry Library)
+
+// Copyright (c) 2026 agent.
+
+// Use, modification and distribution is subject to the Boost Software License,
+// Version 1.0. (See accompanying file LICENSE_1_0.txt or copy at
+// http://www.boost.org/LICENSE_1_0.txt)
+
+#ifndef BOOST_GEOMETRY_STRATEGIES_CARTESIAN_SIMPLIFY_VISVALINGAM_WHYATT_HPP
+#define BOOST_GEOMETRY_STRATEGIES_CARTESIAN_SIMPLIFY_VISVALINGAM_WHYATT_HPP
+
+
+#include <algorithm>
+#include <cstddef>
+#include <vector>
+
+#include <boost/mpl/if.hpp>
+#include <boost/numeric/conversion/cast.hpp>
+#include <boost/range.hpp>
+#include <boost/type_traits/is_void.hpp>
+
+#include <boost/geometry/arithmetic/determinant.hpp>
+#include <boost/geometry/core/access.hpp>
+#include <boost/geometry/core/coordinate_type.hpp>
+#include <boost/geometry/util/math.hpp>
+#include <boost/geometry/util/select_most_precise.hpp>
+
+
+namespace boost { namespace geometry
+{
+
+namespace strategy { namespace simplify
+{
+
+#ifndef DOXYGEN_NO_DETAIL
+namespace detail
+{
+
+// Min-heap of the indices of the points, ordered by their effective area
+// (and by index for equal areas). The areas are kept in the heap entries,
+// and the position of each index in the heap is kept, such that the area
+// of a point can be changed in O(log n).
+template <typename T>
+class visvalingam_whyatt_heap
+{
+public :
+    explicit visvalingam_whyatt_heap(std::size_t count)
+        : m_position(count, npos())
+    {
+        m_heap.reserve(count);
+    }
+
+    inline void push_back(std::size_t index, T const& area)
+    {
+        m_position[index] = m_heap.size();
+        m_heap.push_back(entry(area, index));
+    }
+
+    // Makes the heap of the entries pushed back
+    inline void make_heap()
+    {
+        for (std::size_t i = m_heap.size() / 2; i > 0; i--)
+        {
+            sift_down(i - 1);
+        }
+    }
+
+    inline bool empty() const
+    {
+        return m_heap.empty();
+    }
+
+    inline std::size_t top() const
+    {
+        return m_heap.front().index;
+    }
+
+    inline T const& top_area() const
+    {
+        return m_heap.front().area;
+    }
+
+    inline void pop()
+    {
+        m_position[m_heap.front().index] = npos();
+        entry const last = m_heap.back();
+        m_heap.pop_back();
+        if (! m_heap.empty())
+        {
+            m_heap.front() = last;
+            m_position[last.index] = 0;
+            sift_down(0);
+        }
+    }
+
+    inline void update(std::size_t index, T const& area)
+    {
+        std::size_t const pos = m_position[index];
+        if (pos != npos())
+        {
+            m_heap[pos].area = area;
+            sift_down(sift_up(pos));
+        }
+    }
+
+private :
+    struct entry
+    {
+        entry(T const& a, std::size_t i)
+            : area(a)
+            , index(i)
+        {}
+
+        T area;
+        std::size_t index;
+    };
+
+    static inline std::size_t npos()
+    {
+        return std::size_t(-1);
+    }
+
+    static inline bool less(entry const& left, entry const& right)
+    {
+        return left.area < right.area
+            || (left.area == right.area && left.index < right.index);
+    }
+
+    inline void move(entry const& e, std::size_t pos)
+    {
+        m_heap[pos] = e;
+        m_position[e.index] = pos;
+    }
+
+    inline std::size_t sift_up(std::size_t pos)
+    {
+        entry const e = m_heap[pos];
+        while (pos > 0)
+        {
+            std::size_t const parent = (pos - 1) / 2;
+            if (! less(e, m_heap[parent]))
+            {
+                break;
+            }
+            move(m_heap[parent], pos);
+            pos = parent;
+        }
+        move(e, pos);
+        return pos;
+    }
+
+    inline void sift_down(std::size_t pos)
+    {
+        entry const e = m_heap[pos];
+        std::size_t const size = m_heap.size();
+        for (;;)
+        {
+            std::size_t child = 2 * pos + 1;
+            if (child >= size)
+            {
+                break;
+            }
+            if (child + 1 < size && less(m_heap[child + 1], m_heap[child]))
+            {
+                child++;
+            }
+            if (! less(m_heap[child], e))
+            {
+                break;
+            }
+            move(m_heap[child], pos);
+            pos = child;
+        }
+        move(e, pos);
+    }
+
+    std::vector<entry> m_heap;
+    std::vector<std::size_t> m_position;
+};
+
+} // namespace detail
+#endif // DOXYGEN_NO_DETAIL
+
+
+/*!
+\brief Implements the simplify algorithm using the Visvalingam-Whyatt algorithm
+\ingroup strategies
+\details The visvalingam_whyatt strategy simplifies a linestring, ring or
+    vector of points by removing, one after another, the point with the
+    smallest effective area: the area of the triangle it forms with its
+    current neighbours. The areas are kept in an indexed min-heap, so
+    simplifying n points takes O(n log n).
+    The value passed to simplify as max_distance is the minimal effective
+    area: points with a smaller area are removed. If the strategy is
+    constructed with a maximum number of points, points are also removed
+    until there are no more points than that, so a range can be simplified
+    to N points by passing 0 as the minimal area.
+\tparam Point the point type
+\tparam CalculationType \tparam_calculation
+\note The effective area of a point is never smaller than the area of a
+    point removed before, such that the points are removed in a consistent
+    order. The first and the last point are always kept.
+\note Cartesian only. For rings too few points might remain, and the
+    output might be self intersecting, as with douglas_peucker.
+
+\qbk{
+[heading See also]
+[link geometry.reference.algorithms.simplify.simplify_4_with_strategy simplify (with strategy)]
+}
+*/
+template
+<
+    typename Point,
+    typename CalculationType = void
+>
+class visvalingam_whyatt
+{
+public :
+
+    typedef typename boost::mpl::if_c
+        <
+            boost::is_void<CalculationType>::type::value,
+            typename select_most_precise
+                <
+                    typename coordinate_type<Point>::type,
+                    double
+                >::type,
+            CalculationType
+        >::type area_type;
+
+    /*!
+    \brief Constructs the strategy, optionally with a maximum number of points
+    \param max_points the maximum number of points of each simplified range,
+        0 (the default) for no maximum
+    */
+    explicit visvalingam_whyatt(std::size_t max_points = 0)
+        : m_max_points(max_points)
+    {}
+
+    template <typename Range, typename OutputIterator, typename Area>
+    inline OutputIterator apply(Range const& range,
+                                OutputIterator out,
+                                Area const& min_area) const
+    {
+        typedef typename boost::range_iterator<Range const>::type iterator;
+
+        // Refer to the points by iterators, the iterators may return them
+        // by value, e.g. for transformed ranges
+        std::vector<iterator> points;
+        for (iterator it = boost::begin(range); it != boost::end(range); ++it)
+        {
+            points.push_back(it);
+        }
+
+        std::size_t const count = points.size();
+        if (count <= 2)
+        {
+            for (std::size_t i = 0; i < count; i++)
+            {
+                *out++ = *points[i];
+            }
+            return out;
+        }
+
+        // The points form a doubly linked list, the points in the heap
+        // (all but the first and last point) can be removed from it
+        std::vector<std::size_t> previous(count), next(count);
+        for (std::size_t i = 0; i < count; i++)
+        {
+            previous[i] = i - 1;
+            next[i] = i + 1;
+        }
+
+        detail::visvalingam_whyatt_heap<area_type> heap(count);
+        for (std::size_t i = 1; i + 1 < count; i++)
+        {
+            heap.push_back(i, triangle_area(*points[i - 1], *points[i],
+                                            *points[i + 1]));
+        }
+        heap.make_heap();
+
+        area_type const min = boost::numeric_cast<area_type>(min_area);
+        std::size_t const max_points
+            = m_max_points == 0 ? count : (std::max)(m_max_points, std::size_t(2));
+
+        std::size_t remaining = count;
+        while (! heap.empty())
+        {
+            std::size_t const index = heap.top();
+            area_type const area = heap.top_area();
+            if (! (area < min) && remaining <= max_points)
+            {
+                break;
+            }
+
+            heap.pop();
+            remaining--;
+
+            std::size_t const prev = previous[index];
+            std::size_t const nxt = next[index];
+            next[prev] = nxt;
+            previous[nxt] = prev;
+
+            if (prev > 0)
+            {
+                heap.update(prev, (std::max)(area, triangle_area(
+                    *points[previous[prev]], *points[prev], *points[nxt])));
+            }
+            if (nxt + 1 < count)
+            {
+                heap.update(nxt, (std::max)(area, triangle_area(
+                    *points[prev], *points[nxt], *points[next[nxt]])));
+            }
+        }
+
+        for (std::size_t i = 0; i < count; i = next[i])
+        {
+            *out++ = *points[i];
+        }
+        return out;
+    }
+
+private :
+
+    static inline area_type triangle_area(Point const& p1, Point const& p2,
+                                          Point const& p3)
+    {
+        area_type const dx1 = area_type(get<0>(p2)) - area_type(get<0>(p1));
+        area_type const dy1 = area_type(get<1>(p2)) - area_type(get<1>(p1));
+        area_type const dx2 = area_type(get<0>(p3)) - area_type(get<0>(p1));
+        area_type const dy2 = area_type(get<1>(p3)) - area_type(get<1>(p1));
+
+        return geometry::math::abs(geometry::detail::determinant<area_type>
+            (
+                dx1, dy1, dx2, dy2
+            )) / area_type(2);
+    }
+
+    std::size_t m_max_points;
+};
+
+
+}} // namespace strategy::simplify
+
+
+}} // namespace boost::geometry
+
+#endif // BOOST_GEOMETRY_STRATEGIES_CARTESIAN_SIMPLIFY_VISVALINGAM_WHYATT_HPP
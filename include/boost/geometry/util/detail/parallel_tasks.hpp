@@ -0,0 +1,183 @@
+// Boost.Geometry (aka GGL, Generic Geometry Library)
+
+// Copyright (c) 2026 agent.
+
+// Use, modification and distribution is subject to the Boost Software License,
+// Version 1.0. (See accompanying file LICENSE_1_0.txt or copy at
+// http://www.boost.org/LICENSE_1_0.txt)
+
+#ifndef BOOST_GEOMETRY_UTIL_DETAIL_PARALLEL_TASKS_HPP
+#define BOOST_GEOMETRY_UTIL_DETAIL_PARALLEL_TASKS_HPP
+
+#include <cstddef>
+
+#include <boost/bind.hpp>
+#include <boost/thread/mutex.hpp>
+#include <boost/thread/thread.hpp>
+#include <boost/thread/tss.hpp>
+
+
+namespace boost { namespace geometry
+{
+
+#ifndef DOXYGEN_NO_DETAIL
+namespace detail { namespace parallel
+{
+
+// Marks the threads running tasks (including the calling thread while it
+// runs them), such that tasks running tasks themselves, for example
+// douglas_peucker in a concurrent simplify of a multi-geometry, run them
+// serially instead of starting threads in each thread
+class task_thread_marker
+{
+public :
+    task_thread_marker()
+        : m_previous(marker().release())
+    {
+        static int mark = 0;
+        marker().reset(&mark);
+    }
+
+    ~task_thread_marker()
+    {
+        marker().release();
+        marker().reset(m_previous);
+    }
+
+    static inline bool is_marked()
+    {
+        return marker().get() != 0;
+    }
+
+private :
+    task_thread_marker(task_thread_marker const&);
+    task_thread_marker& operator=(task_thread_marker const&);
+
+    static void no_cleanup(int*) {}
+
+    static inline boost::thread_specific_ptr<int>& marker()
+    {
+        static boost::thread_specific_ptr<int> result(&no_cleanup);
+        return result;
+    }
+
+    int* m_previous;
+};
+
+
+// Returns the number of threads to use: the specified number, or the number
+// of hardware threads if zero is specified, but one within tasks
+inline std::size_t threads_count(std::size_t specified)
+{
+    if (task_thread_marker::is_marked())
+    {
+        return 1;
+    }
+    return specified > 0 ? specified : boost::thread::hardware_concurrency();
+}
+
+
+// Runs the tasks (0..size-1) concurrently, in the calling thread and at most
+// threads_count - 1 other threads. Tasks should not depend on each other.
+// If a task throws, the remaining tasks are not started and apply returns
+// false, such that the caller can repeat the work serially to get the same
+// exception (and result) as in the serial case.
+template <typename Tasks>
+class tasks_runner
+{
+public :
+    explicit tasks_runner(Tasks const& tasks)
+        : m_tasks(tasks)
+        , m_next(0)
+        , m_failed(false)
+    {}
+
+    inline bool apply(std::size_t threads_count)
+    {
+        boost::thread_group threads;
+        try
+        {
+            for (std::size_t i = 1;
+                 i < threads_count && i < m_tasks.size();
+                 i++)
+            {
+                threads.create_thread(boost::bind(&tasks_runner::work, this));
+            }
+        }
+        catch(...)
+        {
+            stop();
+        }
+
+        work();
+        threads.join_all();
+
+        return ! m_failed;
+    }
+
+private :
+    tasks_runner(tasks_runner const&);
+    tasks_runner& operator=(tasks_runner const&);
+
+    inline void stop()
+    {
+        boost::mutex::scoped_lock lock(m_mutex);
+        m_failed = true;
+    }
+
+    void work()
+    {
+        task_thread_marker const marker;
+        for (;;)
+        {
+            std::size_t i = 0;
+            {
+                boost::mutex::scoped_lock lock(m_mutex);
+                if (m_failed || m_next >= m_tasks.size())
+                {
+                    return;
+                }
+                i = m_next++;
+            }
+
+            try
+            {
+                m_tasks.run(i);
+            }
+            catch(...)
+            {
+                stop();
+            }
+        }
+    }
+
+    Tasks const& m_tasks;
+
+    boost::mutex m_mutex;
+    std::size_t m_next;
+    bool m_failed;
+};
+
+
+// Runs repeatable tasks concurrently. If one throws, all are repeated
+// serially, so the same exception is thrown as in the serial case.
+template <typename Tasks>
+inline void run_tasks(Tasks const& tasks, std::size_t threads_count)
+{
+    if (threads_count < 2
+        || tasks_runner<Tasks>(tasks).apply(threads_count) == false)
+    {
+        for (std::size_t i = 0; i < tasks.size(); i++)
+        {
+            tasks.run(i);
+        }
+    }
+}
+
+
+}} // namespace detail::parallel
+#endif // DOXYGEN_NO_DETAIL
+
+}} // namespace boost::geometry
+
+#endif // BOOST_GEOMETRY_UTIL_DETAIL_PARALLEL_TASKS_HPP
@@ -0,0 +1,395 @@
+// Boost.Geometry (aka GGL, Generic Geometry Library)
+
+// Copyright (c) 2026 agent.
+
+// Use, modification and distribution is subject to the Boost Software License,
+// Version 1.0. (See accompanying file LICENSE_1_0.txt or copy at
+// http://www.boost.org/LICENSE_1_0.txt)
+
+#ifndef BOOST_GEOMETRY_VIEWS_SECTIONED_HPP
+#define BOOST_GEOMETRY_VIEWS_SECTIONED_HPP
+
+#include <cstddef>
+#include <vector>
+
+#include <boost/range.hpp>
+#include <boost/type_traits/is_same.hpp>
+
+#include <boost/geometry/core/access.hpp>
+#include <boost/geometry/core/closure.hpp>
+#include <boost/geometry/core/coordinate_dimension.hpp>
+#include <boost/geometry/core/exterior_ring.hpp>
+#include <boost/geometry/core/interior_rings.hpp>
+#include <boost/geometry/core/point_order.hpp>
+#include <boost/geometry/core/ring_type.hpp>
+#include <boost/geometry/core/tag.hpp>
+#include <boost/geometry/core/tags.hpp>
+
+#include <boost/geometry/algorithms/detail/sections/sectionalize.hpp>
+
+#include <boost/geometry/policies/robustness/no_rescale_policy.hpp>
+#include <boost/geometry/policies/robustness/rescale_policy.hpp>
+
+
+namespace boost { namespace geometry
+{
+
+#ifndef DOXYGEN_NO_DETAIL
+namespace detail { namespace sectionalize
+{
+
+template
+<
+    typename Point1, typename Point2,
+    std::size_t Dimension = 0,
+    std::size_t DimensionCount = geometry::dimension<Point1>::value
+>
+struct exactly_equal_points
+{
+    static inline bool apply(Point1 const& p1, Point2 const& p2)
+    {
+        return geometry::get<Dimension>(p1) == geometry::get<Dimension>(p2)
+            && exactly_equal_points
+                <
+                    Point1, Point2, Dimension + 1, DimensionCount
+                >::apply(p1, p2);
+    }
+};
+
+template <typename Point1, typename Point2, std::size_t DimensionCount>
+struct exactly_equal_points<Point1, Point2, DimensionCount, DimensionCount>
+{
+    static inline bool apply(Point1 const& , Point2 const& )
+    {
+        return true;
+    }
+};
+
+// The sections may be reused only if the points are rescaled the same way
+inline bool equal_robust_policies(detail::no_rescale_policy const& ,
+                detail::no_rescale_policy const& )
+{
+    return true;
+}
+
+template <typename FpPoint, typename IntPoint, typename CalculationType>
+inline bool equal_robust_policies(
+        detail::robust_policy<FpPoint, IntPoint, CalculationType> const& rp1,
+        detail::robust_policy<FpPoint, IntPoint, CalculationType> const& rp2)
+{
+    return rp1.m_multiplier == rp2.m_multiplier
+        && exactly_equal_points<FpPoint, FpPoint>::apply(rp1.m_fp_min,
+                                                         rp2.m_fp_min)
+        && exactly_equal_points<IntPoint, IntPoint>::apply(rp1.m_int_min,
+                                                           rp2.m_int_min);
+}
+
+// Identifies the type of the cached sections without RTTI
+template <typename Cached>
+struct cached_sections_id
+{
+    static inline void const* get()
+    {
+        static char const id = 0;
+        return &id;
+    }
+};
+
+struct cached_sections_base
+{
+    explicit cached_sections_base(void const* id)
+        : type_id(id)
+    {}
+
+    virtual ~cached_sections_base() {}
+
+    void const* type_id;
+};
+
+// The sections of one kind, created for one robust policy and source index
+template
+<
+    bool Reverse,
+    typename DimensionVector,
+    typename Sections,
+    typename RobustPolicy
+>
+struct cached_sections : cached_sections_base
+{
+    cached_sections(RobustPolicy const& policy, int index)
+        : cached_sections_base(cached_sections_id<cached_sections>::get())
+        , robust_policy(policy)
+        , source_index(index)
+    {}
+
+    RobustPolicy robust_policy;
+    int source_index;
+    Sections sections;
+};
+
+// Linestrings, rings and multi-geometries are ranges
+template <typename Geometry, bool IsRange>
+class sectioned_base
+{
+public :
+    typedef typename boost::range_iterator<Geometry const>::type const_iterator;
+    typedef const_iterator iterator;
+
+    explicit sectioned_base(Geometry const& geometry)
+        : m_geometry(geometry)
+    {}
+
+    inline const_iterator begin() const { return boost::begin(m_geometry); }
+    inline const_iterator end() const { return boost::end(m_geometry); }
+
+protected :
+    Geometry const& m_geometry;
+};
+
+template <typename Geometry>
+class sectioned_base<Geometry, false>
+{
+protected :
+    explicit sectioned_base(Geometry const& geometry)
+        : m_geometry(geometry)
+    {}
+
+    Geometry const& m_geometry;
+};
+
+}} // namespace detail::sectionalize
+#endif // DOXYGEN_NO_DETAIL
+
+
+/*!
+\brief Geometry keeping its monotonic sections, to sectionalize it only once
+\ingroup views
+\details The sectioned geometry refers to the geometry and is adapted to the
+    same geometry concept, so it can be passed to the overlay and relational
+    operations instead of the geometry. The sections are created when they
+    are needed for the first time and then reused by the next operations,
+    as long as the operations use the same robust policy. E.g. a large clip
+    polygon intersected with many features is sectionalized only once.
+    The relational operations (e.g. intersects, disjoint, within) and the
+    overlay of geometries with integer coordinates don't rescale, so their
+    sections are always reused. The overlay of floating point geometries
+    rescales the points using the envelopes of both geometries, so the
+    sections are reused only if the envelopes of the other geometries are
+    inside the envelope of the sectioned geometry.
+\note The geometry must not be modified while it is sectioned, or reset()
+    must be called after the modification.
+\note The sections are stored at the first use, so a sectioned geometry
+    should not be used by many threads at the same time.
+\tparam Geometry \tparam_geometry
+*/
+template <typename Geometry>
+class sectioned
+    : public detail::sectionalize::sectioned_base
+        <
+            Geometry,
+            ! boost::is_same
+                <
+                    typename tag<Geometry>::type, polygon_tag
+                >::value
+        >
+{
+    typedef detail::sectionalize::sectioned_base
+        <
+            Geometry,
+            ! boost::is_same
+                <
+                    typename tag<Geometry>::type, polygon_tag
+                >::value
+        > base_type;
+
+public :
+    typedef Geometry geometry_type;
+
+    /*!
+    \brief Constructor
+    \param geometry the geometry, it is not copied so it must be alive as long
+        as the sectioned geometry
+    */
+    explicit sectioned(Geometry const& geometry)
+        : base_type(geometry)
+    {}
+
+    ~sectioned()
+    {
+        reset();
+    }
+
+    /*!
+    \brief Returns the sectioned geometry
+    */
+    inline Geometry const& geometry() const
+    {
+        return base_type::m_geometry;
+    }
+
+    /*!
+    \brief Removes the stored sections, they are created again when needed
+    */
+    inline void reset() const
+    {
+        for (std::size_t i = 0; i < m_cache.size(); i++)
+        {
+            delete m_cache[i];
+        }
+        m_cache.clear();
+    }
+
+    /*!
+    \brief Returns the sections of the geometry, creating them if needed
+    \tparam Reverse true if the geometry is traversed in reverse order
+    \tparam DimensionVector vector of dimensions to sectionalize
+    \tparam Sections type of sections
+    \param robust_policy policy to handle robustness issues
+    \param source_index index to assign to the ring_identifiers
+    */
+    template
+    <
+        bool Reverse,
+        typename DimensionVector,
+        typename Sections,
+        typename RobustPolicy
+    >
+    inline Sections const& sections(RobustPolicy const& robust_policy,
+                int source_index = 0) const
+    {
+        typedef detail::sectionalize::cached_sections
+            <
+                Reverse, DimensionVector, Sections, RobustPolicy
+            > cached_type;
+
+        void const* const type_id
+            = detail::sectionalize::cached_sections_id<cached_type>::get();
+
+        // Keep only the sections for the last robust policy
+        std::size_t index = m_cache.size();
+        for (std::size_t i = 0; i < m_cache.size(); i++)
+        {
+            if (m_cache[i]->type_id != type_id)
+            {
+                continue;
+            }
+
+            cached_type const* cached = static_cast<cached_type const*>(m_cache[i]);
+            if (cached->source_index == source_index)
+            {
+                if (detail::sectionalize::equal_robust_policies(
+                        cached->robust_policy, robust_policy))
+                {
+                    return cached->sections;
+                }
+                index = i;
+                break;
+            }
+        }
+
+        // Everything which may throw is done before the entry is allocated
+        // or stored, so nothing leaks, also without exception handling
+        Sections sections;
+        geometry::sectionalize<Reverse, DimensionVector>(geometry(),
+                robust_policy, sections, source_index);
+        if (index == m_cache.size())
+        {
+            m_cache.reserve(index + 1);
+        }
+
+        cached_type* cached = new cached_type(robust_policy, source_index);
+        cached->sections.swap(sections);
+        if (index < m_cache.size())
+        {
+            delete m_cache[index];
+            m_cache[index] = cached;
+        }
+        else
+        {
+            m_cache.push_back(cached);
+        }
+        return cached->sections;
+    }
+
+private :
+    sectioned(sectioned const&);
+    sectioned& operator=(sectioned const&);
+
+    mutable std::vector<detail::sectionalize::cached_sections_base*> m_cache;
+};
+
+
+#ifndef DOXYGEN_NO_TRAITS_SPECIALIZATIONS
+namespace traits
+{
+
+template <typename Geometry>
+struct tag<sectioned<Geometry> >
+{
+    typedef typename geometry::tag<Geometry>::type type;
+};
+
+template <typename Geometry>
+struct point_order<sectioned<Geometry> >
+{
+    static const order_selector value = geometry::point_order<Geometry>::value;
+};
+
+template <typename Geometry>
+struct closure<sectioned<Geometry> >
+{
+    static const closure_selector value = geometry::closure<Geometry>::value;
+};
+
+template <typename Geometry>
+struct ring_const_type<sectioned<Geometry> >
+{
+    typedef typename traits::ring_const_type<Geometry>::type type;
+};
+
+template <typename Geometry>
+struct ring_mutable_type<sectioned<Geometry> >
+{
+    typedef typename traits::ring_const_type<Geometry>::type type;
+};
+
+template <typename Geometry>
+struct interior_const_type<sectioned<Geometry> >
+{
+    typedef typename traits::interior_const_type<Geometry>::type type;
+};
+
+template <typename Geometry>
+struct interior_mutable_type<sectioned<Geometry> >
+{
+    typedef typename traits::interior_const_type<Geometry>::type type;
+};
+
+template <typename Geometry>
+struct exterior_ring<sectioned<Geometry> >
+{
+    static inline typename traits::ring_const_type<Geometry>::type
+        get(sectioned<Geometry> const& geometry)
+    {
+        return traits::exterior_ring<Geometry>::get(geometry.geometry());
+    }
+};
+
+template <typename Geometry>
+struct interior_rings<sectioned<Geometry> >
+{
+    static inline typename traits::interior_const_type<Geometry>::type
+        get(sectioned<Geometry> const& geometry)
+    {
+        return traits::interior_rings<Geometry>::get(geometry.geometry());
+    }
+};
+
+} // namespace traits
+#endif // DOXYGEN_NO_TRAITS_SPECIALIZATIONS
+
+
+}} // namespace boost::geometry
+
+
+#endif // BOOST_GEOMETRY_VIEWS_SECTIONED_HPP
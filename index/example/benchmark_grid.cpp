@@ -0,0 +1,178 @@
+// Boost.Geometry Index
+// Additional tests
+
+// Copyright (c) 2026 agent.
+
+// Use, modification and distribution is subject to the Boost Software License,
+// Version 1.0. (See accompanying file LICENSE_1_0.txt or copy at
+// http://www.boost.org/LICENSE_1_0.txt)
+
+#include <iostream>
+
+#include <boost/geometry.hpp>
+#include <boost/geometry/index/rtree.hpp>
+#include <boost/geometry/index/grid.hpp>
+
+#include <boost/chrono.hpp>
+#include <boost/random.hpp>
+
+namespace bg = boost::geometry;
+namespace bgi = bg::index;
+
+typedef bg::model::point<double, 2, bg::cs::cartesian> P;
+typedef bg::model::box<P> B;
+typedef boost::chrono::thread_clock bench_clock_t;
+typedef boost::chrono::duration<float> dur_t;
+
+template <typename Index>
+void test_index(Index & t, std::vector< std::pair<float, float> > const& coords,
+                size_t values_count, size_t queries_count,
+                size_t nearest_queries_count, unsigned neighbours_count)
+{
+    {
+        bench_clock_t::time_point start = bench_clock_t::now();
+        for (size_t i = 0 ; i < values_count ; ++i )
+        {
+            float x = coords[i].first;
+            float y = coords[i].second;
+            B b(P(x - 0.5f, y - 0.5f), P(x + 0.5f, y + 0.5f));
+
+            t.insert(b);
+        }
+        dur_t time = bench_clock_t::now() - start;
+        std::cout << time << " - insert " << values_count << '\n';
+    }
+
+    std::vector<B> result;
+    result.reserve(100);
+
+    {
+        bench_clock_t::time_point start = bench_clock_t::now();
+        size_t temp = 0;
+        for (size_t i = 0 ; i < queries_count ; ++i )
+        {
+            float x = coords[i].first;
+            float y = coords[i].second;
+            result.clear();
+            t.query(bgi::intersects(B(P(x - 10, y - 10), P(x + 10, y + 10))), std::back_inserter(result));
+            temp += result.size();
+        }
+        dur_t time = bench_clock_t::now() - start;
+        std::cout << time << " - query(B) " << queries_count << " found " << temp << '\n';
+    }
+
+    {
+        bench_clock_t::time_point start = bench_clock_t::now();
+        size_t temp = 0;
+        for (size_t i = 0 ; i < queries_count ; ++i )
+        {
+            float x = coords[i].first;
+            float y = coords[i].second;
+            result.clear();
+            t.query(bgi::within(B(P(x - 10, y - 10), P(x + 10, y + 10))), std::back_inserter(result));
+            temp += result.size();
+        }
+        dur_t time = bench_clock_t::now() - start;
+        std::cout << time << " - query(w) " << queries_count << " found " << temp << '\n';
+    }
+
+    {
+        bench_clock_t::time_point start = bench_clock_t::now();
+        size_t temp = 0;
+        for (size_t i = 0 ; i < nearest_queries_count ; ++i )
+        {
+            float x = coords[i].first + 100;
+            float y = coords[i].second + 100;
+            result.clear();
+            temp += t.query(bgi::nearest(P(x, y), neighbours_count), std::back_inserter(result));
+        }
+        dur_t time = bench_clock_t::now() - start;
+        std::cout << time << " - query(nearest(P, " << neighbours_count << ")) " << nearest_queries_count << " found " << temp << '\n';
+    }
+
+    {
+        bench_clock_t::time_point start = bench_clock_t::now();
+        size_t temp = 0;
+        for (size_t i = 0 ; i < nearest_queries_count ; ++i )
+        {
+            float x = coords[i].first + 100;
+            float y = coords[i].second + 100;
+            for ( typename Index::const_query_iterator it = t.qbegin(bgi::nearest(P(x, y), neighbours_count)) ;
+                  it != t.qend() ; ++it )
+                ++temp;
+        }
+        dur_t time = bench_clock_t::now() - start;
+        std::cout << time << " - qbegin(nearest(P, " << neighbours_count << ")) " << nearest_queries_count << " found " << temp << '\n';
+    }
+
+    {
+        bench_clock_t::time_point start = bench_clock_t::now();
+        for (size_t i = 0 ; i < values_count / 10 ; ++i )
+        {
+            float x = coords[i].first;
+            float y = coords[i].second;
+            B b(P(x - 0.5f, y - 0.5f), P(x + 0.5f, y + 0.5f));
+
+            t.remove(b);
+        }
+        dur_t time = bench_clock_t::now() - start;
+        std::cout << time << " - remove " << values_count / 10 << '\n';
+    }
+}
+
+int main()
+{
+    size_t values_count = 1000000;
+    size_t queries_count = 100000;
+    size_t nearest_queries_count = 10000;
+    unsigned neighbours_count = 10;
+
+    std::vector< std::pair<float, float> > coords;
+
+    float max_val = static_cast<float>(values_count / 2);
+
+    //randomize values
+    {
+        boost::mt19937 rng;
+        //rng.seed(static_cast<unsigned int>(std::time(0)));
+        boost::uniform_real<float> range(-max_val, max_val);
+        boost::variate_generator<boost::mt19937&, boost::uniform_real<float> > rnd(rng, range);
+
+        coords.reserve(values_count);
+
+        std::cout << "randomizing data\n";
+        for ( size_t i = 0 ; i < values_count ; ++i )
+        {
+            coords.push_back(std::make_pair(rnd(), rnd()));
+        }
+        std::cout << "randomized\n";
+    }
+
+    B const domain(P(-max_val, -max_val), P(max_val, max_val));
+
+    for (;;)
+    {
+        {
+            std::cout << "rtree<B, linear<16, 4> >\n";
+            bgi::rtree<B, bgi::linear<16, 4> > t;
+            test_index(t, coords, values_count, queries_count, nearest_queries_count, neighbours_count);
+        }
+
+        {
+            std::cout << "rtree<B, rstar<16, 4> >\n";
+            bgi::rtree<B, bgi::rstar<16, 4> > t;
+            test_index(t, coords, values_count, queries_count, nearest_queries_count, neighbours_count);
+        }
+
+        for ( size_t cells = 256 ; cells <= 1024 ; cells *= 2 )
+        {
+            std::cout << "grid<B> " << cells << "x" << cells << '\n';
+            bgi::grid<B> t(domain, cells);
+            test_index(t, coords, values_count, queries_count, nearest_queries_count, neighbours_count);
+        }
+
+        std::cout << "------------------------------------------------\n";
+    }
+
+    return 0;
+}
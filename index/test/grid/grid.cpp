@@ -0,0 +1,168 @@
+// Boost.Geometry Index
+// Unit Test
+
+// Copyright (c) 2026 agent.
+
+// Use, modification and distribution is subject to the Boost Software License,
+// Version 1.0. (See accompanying file LICENSE_1_0.txt or copy at
+// http://www.boost.org/LICENSE_1_0.txt)
+
+#include <geometry_index_test_common.hpp>
+
+#include <boost/geometry/index/grid.hpp>
+#include <boost/geometry/index/rtree.hpp>
+
+#include <algorithm>
+#include <cstdlib>
+#include <vector>
+
+typedef bg::model::point<double, 2, bg::cs::cartesian> point_t;
+typedef bg::model::box<point_t> box_t;
+
+template <typename Value>
+inline std::vector<int> sorted_ids(std::vector<Value> const& values)
+{
+    std::vector<int> result;
+    for ( size_t i = 0 ; i < values.size() ; ++i )
+        result.push_back(values[i].second);
+    std::sort(result.begin(), result.end());
+    return result;
+}
+
+template <typename Value>
+inline std::vector<double> sorted_distances(std::vector<Value> const& values, point_t const& pt)
+{
+    std::vector<double> result;
+    for ( size_t i = 0 ; i < values.size() ; ++i )
+        result.push_back(bg::comparable_distance(pt, values[i].first));
+    std::sort(result.begin(), result.end());
+    return result;
+}
+
+template <typename Grid, typename Rtree, typename Predicates>
+void check_spatial(Grid const& g, Rtree const& rt, Predicates const& pred)
+{
+    typedef typename Grid::value_type value_t;
+
+    std::vector<value_t> expected, found, found_it;
+    rt.query(pred, std::back_inserter(expected));
+    BOOST_CHECK_EQUAL(g.query(pred, std::back_inserter(found)), expected.size());
+    for ( typename Grid::const_query_iterator it = g.qbegin(pred) ; it != g.qend() ; ++it )
+        found_it.push_back(*it);
+
+    BOOST_CHECK(sorted_ids(found) == sorted_ids(expected));
+    BOOST_CHECK(sorted_ids(found_it) == sorted_ids(expected));
+}
+
+template <typename Grid, typename Rtree, typename Predicates>
+void check_nearest(Grid const& g, Rtree const& rt, Predicates const& pred, point_t const& pt)
+{
+    typedef typename Grid::value_type value_t;
+
+    std::vector<value_t> expected, found, found_it;
+    rt.query(pred, std::back_inserter(expected));
+    BOOST_CHECK_EQUAL(g.query(pred, std::back_inserter(found)), expected.size());
+    for ( typename Grid::const_query_iterator it = g.qbegin(pred) ; it != g.qend() ; ++it )
+        found_it.push_back(*it);
+
+    std::vector<double> expected_dists = sorted_distances(expected, pt);
+    std::vector<double> found_dists = sorted_distances(found, pt);
+    BOOST_CHECK(found_dists == expected_dists);
+
+    // the iterator returns the values in order of distances
+    BOOST_CHECK_EQUAL(found_it.size(), expected.size());
+    for ( size_t i = 0 ; i < found_it.size() && i < expected_dists.size() ; ++i )
+        BOOST_CHECK_EQUAL(bg::comparable_distance(pt, found_it[i].first), expected_dists[i]);
+}
+
+template <typename Value>
+void test_grid(std::vector<Value> const& values, unsigned cells)
+{
+    typedef bgi::grid<Value> grid_t;
+    typedef bgi::rtree<Value, bgi::rstar<8, 3> > rtree_t;
+
+    // the values partially outside of the domain
+    box_t const domain(point_t(0, 0), point_t(1000, 800));
+
+    grid_t g(values, domain, cells);
+    rtree_t rt(values);
+
+    BOOST_CHECK_EQUAL(g.size(), values.size());
+    BOOST_CHECK(bg::equals(g.bounds(), rt.bounds()));
+
+    box_t const qbox(point_t(100, 100), point_t(400, 300));
+    box_t const qbox_outside(point_t(900, 700), point_t(1200, 1200));
+    box_t const qbox_inner(point_t(150, 150), point_t(300, 250));
+    point_t const qpts[] = { point_t(500, 500), point_t(-100, 1100), point_t(0, 0) };
+
+    check_spatial(g, rt, bgi::intersects(qbox));
+    check_spatial(g, rt, bgi::intersects(qbox_outside));
+    check_spatial(g, rt, bgi::within(qbox));
+    check_spatial(g, rt, bgi::covered_by(qbox));
+    check_spatial(g, rt, bgi::disjoint(qbox));
+    check_spatial(g, rt, bgi::intersects(qbox) && !bgi::covered_by(qbox_inner));
+
+    for ( size_t i = 0 ; i < sizeof(qpts) / sizeof(point_t) ; ++i )
+    {
+        check_nearest(g, rt, bgi::nearest(qpts[i], 1), qpts[i]);
+        check_nearest(g, rt, bgi::nearest(qpts[i], 17), qpts[i]);
+        check_nearest(g, rt, bgi::nearest(qpts[i], 17) && bgi::intersects(qbox), qpts[i]);
+        check_nearest(g, rt, bgi::nearest(qpts[i], 5000), qpts[i]);
+    }
+
+    // range adaptor
+    std::vector<Value> found;
+    BOOST_FOREACH(Value const& v, g | bgi::adaptors::queried(bgi::intersects(qbox)))
+        found.push_back(v);
+    std::vector<Value> expected;
+    rt.query(bgi::intersects(qbox), std::back_inserter(expected));
+    BOOST_CHECK(sorted_ids(found) == sorted_ids(expected));
+
+    // removal
+    grid_t g_inserted(domain, cells);
+    for ( size_t i = 0 ; i < values.size() ; ++i )
+        bgi::insert(g_inserted, values[i]);
+    for ( size_t i = 0 ; i < values.size() ; i += 2 )
+    {
+        BOOST_CHECK_EQUAL(g_inserted.remove(values[i]), 1u);
+        BOOST_CHECK_EQUAL(rt.remove(values[i]), 1u);
+    }
+    BOOST_CHECK_EQUAL(g_inserted.remove(values[0]), 0u);
+    BOOST_CHECK_EQUAL(g_inserted.size(), rt.size());
+    BOOST_CHECK(bg::equals(g_inserted.bounds(), rt.bounds()));
+
+    check_spatial(g_inserted, rt, bgi::intersects(qbox));
+    check_nearest(g_inserted, rt, bgi::nearest(qpts[0], 17), qpts[0]);
+
+    // swap and clear
+    bgi::swap(g, g_inserted);
+    BOOST_CHECK_EQUAL(g.size(), rt.size());
+    BOOST_CHECK_EQUAL(g_inserted.size(), values.size());
+
+    bgi::clear(g);
+    BOOST_CHECK(bgi::empty(g));
+    BOOST_CHECK(g.qbegin(bgi::intersects(qbox)) == g.qend());
+    BOOST_CHECK(g.qbegin(bgi::nearest(qpts[0], 5)) == g.qend());
+    BOOST_CHECK_EQUAL(g.query(bgi::nearest(qpts[0], 5), std::back_inserter(found)), 0u);
+}
+
+int test_main(int, char* [])
+{
+    std::vector< std::pair<point_t, int> > points;
+    std::vector< std::pair<box_t, int> > boxes;
+    for ( int i = 0 ; i < 2000 ; ++i )
+    {
+        double x = ::rand() % 1200 - 100;
+        double y = ::rand() % 1200 - 100;
+        points.push_back(std::make_pair(point_t(x, y), i));
+        boxes.push_back(std::make_pair(box_t(point_t(x, y), point_t(x + ::rand() % 50, y + ::rand() % 50)), i));
+    }
+
+    test_grid(points, 1);
+    test_grid(points, 16);
+    test_grid(points, 50);
+    test_grid(boxes, 16);
+    test_grid(boxes, 64);
+
+    return 0;
+}
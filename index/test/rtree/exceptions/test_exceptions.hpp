@@ -47,6 +47,35 @@ void test_rtree_value_exceptions(Parameters const& parameters = Parameters())
         BOOST_CHECK_THROW( tree.insert(input.begin(), input.end()), throwing_value_copy_exception );
     }
 
+    // range merged into non-empty tree, values are copied at least once,
+    // the subtree may be taller than the tree
+    for ( size_t i = 0 ; i < input.size() / 2 ; i += 2 )
+    {
+        throwing_value::reset_calls_counter();
+        throwing_value::set_max_calls(10000);
+
+        Tree tree(parameters);
+
+        size_t const split = i % 4 == 0 ? input.size() / 2 : input.size() / 8;
+        tree.insert(input.begin(), input.begin() + split);
+
+        throwing_value::reset_calls_counter();
+        throwing_value::set_max_calls(i);
+
+        BOOST_CHECK_THROW( tree.merge(input.begin() + split, input.end()), throwing_value_copy_exception );
+
+        throwing_value::reset_calls_counter();
+        throwing_value::set_max_calls((std::numeric_limits<size_t>::max)());
+
+        // the values stored before are kept and counted
+        BOOST_CHECK(split <= tree.size());
+        std::vector<Value> output;
+        tree.query(bgi::intersects(tree.bounds()), std::back_inserter(output));
+        BOOST_CHECK_EQUAL(output.size(), tree.size());
+        for ( size_t j = 0 ; j < split ; ++j )
+            BOOST_CHECK(tree.count(input[j]) >= 1);
+    }
+
     for ( size_t i = 0 ; i < 20 ; i += 1 )
     {
         throwing_value::reset_calls_counter();
@@ -0,0 +1,137 @@
+// Boost.Geometry Index
+// Unit Test
+
+// Copyright (c) 2026 agent.
+
+// Use, modification and distribution is subject to the Boost Software License,
+// Version 1.0. (See accompanying file LICENSE_1_0.txt or copy at
+// http://www.boost.org/LICENSE_1_0.txt)
+
+#include <rtree/test_rtree.hpp>
+
+#include <cstdlib>
+
+typedef bg::model::point<double, 2, bg::cs::cartesian> point_t;
+typedef bg::model::box<point_t> box_t;
+typedef std::pair<point_t, int> value_t;
+
+struct sum_aggregator
+{
+    typedef long result_type;
+
+    result_type identity() const { return 0; }
+    result_type apply(value_t const& v) const { return v.second; }
+    result_type combine(result_type const& l, result_type const& r) const { return l + r; }
+};
+
+bool is_odd(value_t const& v)
+{
+    return v.second % 2 != 0;
+}
+
+template <typename Predicate>
+long brute_force_sum(std::vector<value_t> const& input, Predicate const& pred)
+{
+    std::vector<value_t> found;
+    bgi::rtree<value_t, bgi::linear<16> > rt(input);
+    rt.query(pred, std::back_inserter(found));
+
+    long result = 0;
+    for ( size_t i = 0 ; i < found.size() ; ++i )
+        result += found[i].second;
+    return result;
+}
+
+template <typename Rtree>
+void check_aggregates(Rtree const& rt, std::vector<value_t> const& input)
+{
+    long sum = 0;
+    for ( size_t i = 0 ; i < input.size() ; ++i )
+        sum += input[i].second;
+
+    BOOST_CHECK_EQUAL(rt.aggregate(), sum);
+
+    box_t boxes[] = {
+        box_t(point_t(-1, -1), point_t(101, 101)),
+        box_t(point_t(10, 10), point_t(60, 40)),
+        box_t(point_t(25.5, 0), point_t(26.5, 100)),
+        box_t(point_t(200, 200), point_t(300, 300))
+    };
+
+    for ( size_t i = 0 ; i < sizeof(boxes) / sizeof(box_t) ; ++i )
+    {
+        box_t const& b = boxes[i];
+        BOOST_CHECK_EQUAL(rt.aggregate(bgi::intersects(b)), brute_force_sum(input, bgi::intersects(b)));
+        BOOST_CHECK_EQUAL(rt.aggregate(bgi::covered_by(b)), brute_force_sum(input, bgi::covered_by(b)));
+        BOOST_CHECK_EQUAL(rt.aggregate(bgi::within(b)), brute_force_sum(input, bgi::within(b)));
+        BOOST_CHECK_EQUAL(rt.aggregate(bgi::disjoint(b)), brute_force_sum(input, bgi::disjoint(b)));
+        BOOST_CHECK_EQUAL(rt.aggregate(bgi::intersects(b) && bgi::satisfies(is_odd)),
+                          brute_force_sum(input, bgi::intersects(b) && bgi::satisfies(is_odd)));
+    }
+}
+
+template <typename Parameters>
+void test_aggregate(Parameters const& parameters)
+{
+    typedef bgi::augmented<Parameters, sum_aggregator> params_t;
+    typedef bgi::rtree<value_t, params_t> rtree_t;
+
+    std::vector<value_t> input;
+    for ( int i = 0 ; i < 1000 ; ++i )
+    {
+        point_t pt(::rand() % 100, ::rand() % 100);
+        input.push_back(std::make_pair(pt, i));
+    }
+
+    params_t params(parameters);
+
+    // empty
+    rtree_t rt(params);
+    BOOST_CHECK_EQUAL(rt.aggregate(), 0);
+    BOOST_CHECK_EQUAL(rt.aggregate(bgi::intersects(box_t(point_t(0, 0), point_t(10, 10)))), 0);
+
+    // insert
+    rt.insert(input);
+    check_aggregates(rt, input);
+
+    // remove
+    std::vector<value_t> remaining;
+    for ( size_t i = 0 ; i < input.size() ; ++i )
+    {
+        if ( i % 3 == 0 )
+            rt.remove(input[i]);
+        else
+            remaining.push_back(input[i]);
+    }
+    check_aggregates(rt, remaining);
+
+    // copy
+    rtree_t rt_copy(rt);
+    check_aggregates(rt_copy, remaining);
+
+    // pack
+    rtree_t rt_packed(remaining, params);
+    check_aggregates(rt_packed, remaining);
+
+    // insert into packed
+    rt_packed.insert(input[0]);
+    remaining.push_back(input[0]);
+    check_aggregates(rt_packed, remaining);
+
+    // remove all
+    rt_packed.remove(remaining);
+    BOOST_CHECK_EQUAL(rt_packed.aggregate(), 0);
+}
+
+int test_main(int, char* [])
+{
+    test_aggregate(bgi::linear<4, 2>());
+    test_aggregate(bgi::quadratic<4, 2>());
+    test_aggregate(bgi::rstar<4, 2>());
+    test_aggregate(bgi::dynamic_linear(4, 2));
+    test_aggregate(bgi::dynamic_quadratic(4, 2));
+    test_aggregate(bgi::dynamic_rstar(4, 2));
+    test_aggregate(bgi::soa_leafs< bgi::rstar<4, 2> >());
+
+    return 0;
+}
@@ -0,0 +1,135 @@
+// Boost.Geometry Index
+// Unit Test
+
+// Copyright (c) 2026 agent.
+
+// Use, modification and distribution is subject to the Boost Software License,
+// Version 1.0. (See accompanying file LICENSE_1_0.txt or copy at
+// http://www.boost.org/LICENSE_1_0.txt)
+
+#include <rtree/test_rtree.hpp>
+
+#include <algorithm>
+#include <cstdlib>
+
+template <typename Point>
+struct distance_less
+{
+    explicit distance_less(Point const& p) : pt(p) {}
+
+    bool operator()(Point const& l, Point const& r) const
+    {
+        return bg::distance(pt, l) < bg::distance(pt, r);
+    }
+
+    Point pt;
+};
+
+template <typename Point>
+inline Point random_point()
+{
+    // longitudes in [-180, 180), latitudes in [-90, 90], more points near the poles
+    // and the antimeridian than in uniform distribution
+    double lon = (::rand() % 36000) / 100.0 - 180;
+    double lat = (::rand() % 18001) / 100.0 - 90;
+    return Point(lon, lat);
+}
+
+template <typename Rtree, typename Point>
+void check_nearest(Rtree const& rt, std::vector<Point> const& input, Point const& pt, unsigned k)
+{
+    std::vector<Point> expected(input);
+    std::sort(expected.begin(), expected.end(), distance_less<Point>(pt));
+    expected.resize((std::min)(size_t(k), expected.size()));
+
+    // k-NN query
+    std::vector<Point> found;
+    rt.query(bgi::nearest(pt, k), std::back_inserter(found));
+
+    BOOST_CHECK_EQUAL(found.size(), expected.size());
+    std::sort(found.begin(), found.end(), distance_less<Point>(pt));
+    for ( size_t i = 0 ; i < found.size() && i < expected.size() ; ++i )
+        BOOST_CHECK_EQUAL(bg::distance(pt, found[i]), bg::distance(pt, expected[i]));
+
+#ifdef BOOST_GEOMETRY_INDEX_DETAIL_EXPERIMENTAL
+    // incremental query returns the values in the order of distances
+    double prev_dist = 0;
+    size_t count = 0;
+    for ( typename Rtree::const_query_iterator it = rt.qbegin(bgi::nearest(pt, k)) ;
+          it != rt.qend() ; ++it, ++count )
+    {
+        double dist = bg::distance(pt, *it);
+        BOOST_CHECK(prev_dist <= dist);
+        BOOST_CHECK_EQUAL(dist, bg::distance(pt, expected[count]));
+        prev_dist = dist;
+    }
+    BOOST_CHECK_EQUAL(count, expected.size());
+#endif
+
+    // k-NN query with the maximum distance
+    if ( expected.size() > 2 )
+    {
+        // between the distances of two values to avoid rounding issues
+        size_t const mid = expected.size() / 2;
+        double max_dist = (bg::distance(pt, expected[mid]) + bg::distance(pt, expected[mid + 1])) / 2;
+        size_t expected_count = 0;
+        for ( size_t i = 0 ; i < expected.size() ; ++i )
+        {
+            if ( bg::distance(pt, expected[i]) <= max_dist )
+                ++expected_count;
+        }
+
+        found.clear();
+        rt.query(bgi::nearest(pt, k, max_dist), std::back_inserter(found));
+        BOOST_CHECK_EQUAL(found.size(), expected_count);
+    }
+}
+
+template <typename Point, typename Parameters>
+void test_nearest(Parameters const& parameters)
+{
+    typedef bgi::rtree<Point, Parameters> rtree_t;
+
+    std::vector<Point> input;
+    for ( int i = 0 ; i < 1000 ; ++i )
+        input.push_back(random_point<Point>());
+
+    rtree_t rt(input, parameters);
+
+    rtree_t rt_inserted(parameters);
+    for ( size_t i = 0 ; i < input.size() ; ++i )
+        rt_inserted.insert(input[i]);
+
+    for ( int i = 0 ; i < 50 ; ++i )
+    {
+        Point pt = random_point<Point>();
+        check_nearest(rt, input, pt, 1);
+        check_nearest(rt, input, pt, 10);
+        check_nearest(rt_inserted, input, pt, 10);
+    }
+
+    // near the poles and the antimeridian
+    check_nearest(rt, input, Point(0, 90), 10);
+    check_nearest(rt, input, Point(180, -89.5), 10);
+    check_nearest(rt, input, Point(-179.9, 0), 10);
+    check_nearest(rt, input, Point(540, 10), 10);
+}
+
+template <typename Point>
+void test_parameters()
+{
+    test_nearest<Point>(bgi::linear<8, 3>());
+    test_nearest<Point>(bgi::quadratic<8, 3>());
+    test_nearest<Point>(bgi::rstar<8, 3>());
+}
+
+int test_main(int, char* [])
+{
+    typedef bg::model::point<double, 2, bg::cs::spherical_equatorial<bg::degree> > point_se;
+    typedef bg::model::point<double, 2, bg::cs::geographic<bg::degree> > point_geo;
+
+    test_parameters<point_se>();
+    test_parameters<point_geo>();
+
+    return 0;
+}
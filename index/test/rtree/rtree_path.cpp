@@ -0,0 +1,144 @@
+// Boost.Geometry Index
+// Unit Test
+
+// Copyright (c) 2026 agent.
+
+// Use, modification and distribution is subject to the Boost Software License,
+// Version 1.0. (See accompanying file LICENSE_1_0.txt or copy at
+// http://www.boost.org/LICENSE_1_0.txt)
+
+#define BOOST_GEOMETRY_INDEX_DETAIL_EXPERIMENTAL
+
+#include <rtree/test_rtree.hpp>
+
+#include <algorithm>
+#include <cstdlib>
+
+typedef bg::model::point<double, 2, bg::cs::cartesian> point_t;
+typedef bg::model::box<point_t> box_t;
+typedef bg::model::segment<point_t> segment_t;
+typedef bg::model::linestring<point_t> linestring_t;
+typedef std::pair<box_t, int> value_t;
+
+inline value_t random_value(int id)
+{
+    double x = ::rand() % 1000;
+    double y = ::rand() % 1000;
+    double w = ::rand() % 20;
+    double h = ::rand() % 20;
+    return value_t(box_t(point_t(x, y), point_t(x + w, y + h)), id);
+}
+
+template <typename Path>
+inline std::vector<double> path_distances(std::vector<value_t> const& values, Path const& path, box_t const& filter)
+{
+    std::vector<double> result;
+    for ( size_t i = 0 ; i < values.size() ; ++i )
+    {
+        typename bgi::detail::default_path_intersection_distance_type<box_t, Path>::type d;
+        if ( bg::intersects(values[i].first, filter)
+          && bgi::detail::path_intersection(values[i].first, path, d) )
+            result.push_back(d);
+    }
+    std::sort(result.begin(), result.end());
+    return result;
+}
+
+template <typename Rtree, typename Path>
+void check_path(Rtree const& rt, std::vector<value_t> const& values, Path const& path, unsigned k)
+{
+    box_t const all(point_t(-1000, -1000), point_t(2000, 2000));
+    box_t const half(point_t(0, 0), point_t(500, 1000));
+
+    for ( int f = 0 ; f < 2 ; ++f )
+    {
+        box_t const& filter = f == 0 ? all : half;
+
+        std::vector<double> expected = path_distances(values, path, filter);
+        expected.resize((std::min)(size_t(k), expected.size()));
+
+        std::vector<value_t> found;
+        if ( f == 0 )
+            rt.query(bgi::path(path, k), std::back_inserter(found));
+        else
+            rt.query(bgi::path(path, k) && bgi::intersects(filter), std::back_inserter(found));
+
+        BOOST_CHECK_EQUAL(found.size(), expected.size());
+
+        std::vector<double> found_dists;
+        for ( size_t i = 0 ; i < found.size() ; ++i )
+        {
+            typename bgi::detail::default_path_intersection_distance_type<box_t, Path>::type d = 0;
+            BOOST_CHECK(bgi::detail::path_intersection(found[i].first, path, d));
+            found_dists.push_back(d);
+        }
+        std::sort(found_dists.begin(), found_dists.end());
+
+        for ( size_t i = 0 ; i < found_dists.size() && i < expected.size() ; ++i )
+            BOOST_CHECK_CLOSE(found_dists[i] + 1, expected[i] + 1, 0.0001);
+    }
+}
+
+template <typename Parameters>
+void test_path(Parameters const& parameters)
+{
+    typedef bgi::rtree<value_t, Parameters> rtree_t;
+
+    std::vector<value_t> values;
+    for ( int i = 0 ; i < 2000 ; ++i )
+        values.push_back(random_value(i));
+
+    rtree_t rt(values, parameters);
+    rtree_t rt_inserted(parameters);
+    for ( size_t i = 0 ; i < values.size() ; ++i )
+        rt_inserted.insert(values[i]);
+
+    linestring_t ls;
+    ls.push_back(point_t(0, 0));
+    ls.push_back(point_t(1000, 1000));
+    ls.push_back(point_t(1000, 0));
+    ls.push_back(point_t(500, 500));
+    ls.push_back(point_t(500, 1500));
+
+    linestring_t ls2;
+    ls2.push_back(point_t(-10, 500));
+    ls2.push_back(point_t(1010, 500));
+
+    linestring_t ls_degenerated;
+    ls_degenerated.push_back(point_t(500, 500));
+
+    // axis-aligned, diagonal, outside
+    segment_t segs[] = {
+        segment_t(point_t(0, 250), point_t(1000, 250)),
+        segment_t(point_t(300, 1000), point_t(300, 0)),
+        segment_t(point_t(1000, 0), point_t(0, 1000)),
+        segment_t(point_t(2000, 2000), point_t(3000, 2000))
+    };
+
+    for ( unsigned k = 1 ; k <= 100 ; k *= 10 )
+    {
+        check_path(rt, values, ls, k);
+        check_path(rt_inserted, values, ls, k);
+        check_path(rt, values, ls2, k);
+        check_path(rt, values, ls_degenerated, k);
+        for ( size_t i = 0 ; i < sizeof(segs) / sizeof(segment_t) ; ++i )
+            check_path(rt, values, segs[i], k);
+    }
+
+    // the query stops at the values found
+    bgi::query_statistics stats_ls, stats_all;
+    std::vector<value_t> found;
+    rt.query(bgi::path(ls, 1), std::back_inserter(found), stats_ls);
+    rt.query(bgi::intersects(box_t(point_t(-1000, -1000), point_t(2000, 2000))), std::back_inserter(found), stats_all);
+    BOOST_CHECK(stats_ls.nodes_count < stats_all.nodes_count);
+}
+
+int test_main(int, char* [])
+{
+    test_path(bgi::linear<8, 3>());
+    test_path(bgi::quadratic<8, 3>());
+    test_path(bgi::rstar<8, 3>());
+    test_path(bgi::dynamic_rstar(8, 3));
+
+    return 0;
+}
@@ -0,0 +1,110 @@
+// Boost.Geometry Index
+// Unit Test
+
+// Copyright (c) 2026 agent.
+
+// Use, modification and distribution is subject to the Boost Software License,
+// Version 1.0. (See accompanying file LICENSE_1_0.txt or copy at
+// http://www.boost.org/LICENSE_1_0.txt)
+
+#include <rtree/test_rtree.hpp>
+
+#include <boost/geometry/index/detail/rtree/utilities/statistics.hpp>
+
+#include <cstdlib>
+
+typedef bg::model::point<double, 2, bg::cs::cartesian> point_t;
+typedef bg::model::box<point_t> box_t;
+
+template <typename Rtree, typename Predicates>
+void check_statistics(Rtree const& rt, Predicates const& pred)
+{
+    std::vector<point_t> expected;
+    rt.query(pred, std::back_inserter(expected));
+
+    bgi::query_statistics stats;
+    std::vector<point_t> found;
+    size_t found_count = rt.query(pred, std::back_inserter(found), stats);
+
+    basictest::compare_outputs(rt, found, expected);
+    BOOST_CHECK_EQUAL(found_count, expected.size());
+    BOOST_CHECK_EQUAL(stats.values_count, expected.size());
+
+    // at least the root is visited, leafs are nodes
+    BOOST_CHECK(0 < stats.nodes_count);
+    BOOST_CHECK(stats.leafs_count <= stats.nodes_count);
+    BOOST_CHECK(stats.values_count <= stats.predicates_count);
+
+    size_t const nodes_count = boost::get<1>(bgi::detail::rtree::utilities::statistics(rt))
+                             + boost::get<2>(bgi::detail::rtree::utilities::statistics(rt));
+    size_t const leafs_count = boost::get<2>(bgi::detail::rtree::utilities::statistics(rt));
+    BOOST_CHECK(stats.nodes_count <= nodes_count);
+    BOOST_CHECK(stats.leafs_count <= leafs_count);
+    BOOST_CHECK(stats.predicates_count <= nodes_count - 1 + rt.size());
+
+    // the counters are accumulated
+    bgi::query_statistics stats2 = stats;
+    bgi::query(rt, pred, std::back_inserter(found), stats2);
+    BOOST_CHECK_EQUAL(stats2.nodes_count, 2 * stats.nodes_count);
+    BOOST_CHECK_EQUAL(stats2.leafs_count, 2 * stats.leafs_count);
+    BOOST_CHECK_EQUAL(stats2.predicates_count, 2 * stats.predicates_count);
+    BOOST_CHECK_EQUAL(stats2.values_count, 2 * stats.values_count);
+    BOOST_CHECK_EQUAL(stats2.max_queue_size, stats.max_queue_size);
+
+    stats2.clear();
+    BOOST_CHECK_EQUAL(stats2.nodes_count, 0u);
+    BOOST_CHECK_EQUAL(stats2.max_queue_size, 0u);
+}
+
+template <typename Parameters>
+void test_statistics(Parameters const& parameters)
+{
+    typedef bgi::rtree<point_t, Parameters> rtree_t;
+
+    std::vector<point_t> points;
+    for ( int i = 0 ; i < 1000 ; ++i )
+        points.push_back(point_t(::rand() % 1000, ::rand() % 1000));
+
+    rtree_t rt(points, parameters);
+
+    // all values
+    bgi::query_statistics stats;
+    std::vector<point_t> found;
+    rt.query(bgi::covered_by(box_t(point_t(0, 0), point_t(1000, 1000))), std::back_inserter(found), stats);
+    size_t const nodes_count = boost::get<1>(bgi::detail::rtree::utilities::statistics(rt))
+                             + boost::get<2>(bgi::detail::rtree::utilities::statistics(rt));
+    BOOST_CHECK_EQUAL(stats.nodes_count, nodes_count);
+    BOOST_CHECK_EQUAL(stats.leafs_count, boost::get<2>(bgi::detail::rtree::utilities::statistics(rt)));
+    BOOST_CHECK_EQUAL(stats.predicates_count, nodes_count - 1 + points.size());
+    BOOST_CHECK_EQUAL(stats.values_count, points.size());
+    BOOST_CHECK_EQUAL(stats.max_queue_size, 0u);
+
+    check_statistics(rt, bgi::intersects(box_t(point_t(100, 100), point_t(300, 200))));
+    check_statistics(rt, bgi::intersects(box_t(point_t(2000, 2000), point_t(3000, 3000))));
+    check_statistics(rt, bgi::nearest(point_t(500, 500), 10));
+    check_statistics(rt, bgi::nearest(point_t(500, 500), 10) && bgi::intersects(box_t(point_t(0, 0), point_t(500, 500))));
+    check_statistics(rt, bgi::nearest(point_t(500, 500), 10, 20.0));
+
+    // k-NN queries store the branches
+    stats.clear();
+    found.clear();
+    rt.query(bgi::nearest(point_t(500, 500), 10), std::back_inserter(found), stats);
+    BOOST_CHECK(0 < stats.max_queue_size);
+    BOOST_CHECK_EQUAL(stats.values_count, 10u);
+
+    // empty tree
+    rtree_t empty(parameters);
+    stats.clear();
+    BOOST_CHECK_EQUAL(empty.query(bgi::nearest(point_t(0, 0), 10), std::back_inserter(found), stats), 0u);
+    BOOST_CHECK_EQUAL(stats.nodes_count, 0u);
+}
+
+int test_main(int, char* [])
+{
+    test_statistics(bgi::linear<8, 3>());
+    test_statistics(bgi::quadratic<8, 3>());
+    test_statistics(bgi::rstar<8, 3>());
+    test_statistics(bgi::dynamic_rstar(8, 3));
+
+    return 0;
+}
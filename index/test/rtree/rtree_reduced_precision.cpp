@@ -0,0 +1,210 @@
+// Boost.Geometry Index
+// Unit Test
+
+// Copyright (c) 2026 agent.
+
+// Use, modification and distribution is subject to the Boost Software License,
+// Version 1.0. (See accompanying file LICENSE_1_0.txt or copy at
+// http://www.boost.org/LICENSE_1_0.txt)
+
+#include <rtree/test_rtree.hpp>
+
+#include <cstdlib>
+#include <limits>
+
+typedef bg::model::point<double, 2, bg::cs::cartesian> point_t;
+typedef bg::model::box<point_t> box_t;
+typedef bg::model::segment<point_t> segment_t;
+
+// coordinates which can't be represented exactly by float
+inline double random_coord()
+{
+    return (::rand() % 10000) / 3.0 + 1e-9 * (::rand() % 100);
+}
+
+template <typename Value>
+inline box_t value_box(Value const& v)
+{
+    box_t b;
+    bgi::detail::bounds(v, b);
+    return b;
+}
+
+template <typename Rtree, typename Value, typename Predicates>
+void check_query(Rtree const& rt, std::vector<Value> const& input, Predicates const& pred)
+{
+    std::vector<Value> expected;
+    bgi::rtree<Value, bgi::linear<16> > rt_exact(input);
+    rt_exact.query(pred, std::back_inserter(expected));
+
+    std::vector<Value> found;
+    rt.query(pred, std::back_inserter(found));
+
+    basictest::compare_outputs(rt, found, expected);
+}
+
+template <typename Rtree, typename Value>
+void check_rtree(Rtree const& rt, std::vector<Value> const& input)
+{
+    BOOST_CHECK( bgi::detail::rtree::utilities::are_levels_ok(rt) );
+    BOOST_CHECK( bgi::detail::rtree::utilities::are_boxes_ok(rt) );
+    BOOST_CHECK_EQUAL(rt.size(), input.size());
+
+    if ( input.empty() )
+        return;
+
+    BOOST_CHECK( bg::covered_by(value_box(input.front()), rt.bounds()) );
+
+    // the queries touching values exactly on their boundaries
+    for ( size_t i = 0 ; i < input.size() ; i += 7 )
+    {
+        box_t b = value_box(input[i]);
+        check_query(rt, input, bgi::intersects(b));
+        check_query(rt, input, bgi::disjoint(b));
+        check_query(rt, input, bgi::intersects(b.max_corner()));
+    }
+
+    check_query(rt, input, bgi::nearest(point_t(1000, 1000), 10));
+    check_query(rt, input, bgi::nearest(value_box(input.front()).min_corner(), 1));
+}
+
+template <typename Value, typename Parameters>
+void test_reduced_precision(std::vector<Value> const& input, Parameters const& parameters)
+{
+    typedef bgi::reduced_precision<Parameters> params_t;
+    typedef bgi::rtree<Value, params_t> rtree_t;
+
+    params_t params(parameters);
+
+    // insert
+    rtree_t rt(params);
+    for ( size_t i = 0 ; i < input.size() ; ++i )
+        rt.insert(input[i]);
+    check_rtree(rt, input);
+
+    // remove
+    std::vector<Value> remaining;
+    for ( size_t i = 0 ; i < input.size() ; ++i )
+    {
+        if ( i % 3 == 0 )
+            rt.remove(input[i]);
+        else
+            remaining.push_back(input[i]);
+    }
+    check_rtree(rt, remaining);
+
+    // copy
+    rtree_t rt_copy(rt);
+    check_rtree(rt_copy, remaining);
+
+    // pack
+    rtree_t rt_packed(input, params);
+    check_rtree(rt_packed, input);
+}
+
+template <typename Parameters>
+void test_parameters(Parameters const& parameters)
+{
+    std::vector<point_t> points;
+    std::vector<box_t> boxes;
+    std::vector<segment_t> segments;
+    for ( int i = 0 ; i < 500 ; ++i )
+    {
+        point_t p1(random_coord(), random_coord());
+        point_t p2(bg::get<0>(p1) + random_coord() / 100, bg::get<1>(p1) + random_coord() / 100);
+        points.push_back(p1);
+        boxes.push_back(box_t(p1, p2));
+        segments.push_back(segment_t(p2, p1));
+    }
+
+    test_reduced_precision(points, parameters);
+    test_reduced_precision(boxes, parameters);
+    test_reduced_precision(segments, parameters);
+}
+
+// coordinates beyond the range of float
+template <typename Parameters>
+void test_huge_coordinates(Parameters const& parameters)
+{
+    typedef bgi::reduced_precision<Parameters> params_t;
+    typedef bgi::rtree<point_t, params_t> rtree_t;
+
+    double const float_max = (std::numeric_limits<float>::max)();
+
+    std::vector<point_t> points;
+    for ( int i = 0 ; i < 100 ; ++i )
+        points.push_back(point_t(random_coord(), random_coord()));
+    points.push_back(point_t(1e300, 1e300));
+    points.push_back(point_t(-1e300, 1e300));
+    points.push_back(point_t(float_max, -float_max));
+    points.push_back(point_t(float_max * (1 + 1e-9), -1e39));
+
+    params_t params(parameters);
+
+    rtree_t rt(points, params);
+    check_rtree(rt, points);
+    for ( size_t i = 0 ; i < points.size() ; ++i )
+    {
+        BOOST_CHECK( bg::covered_by(points[i], rt.bounds()) );
+        BOOST_CHECK_EQUAL(rt.count(points[i]), 1u);
+    }
+
+    // the inner sides of bounds are the greatest finite floats
+    rtree_t rt_huge(params);
+    rt_huge.insert(point_t(1e300, -1e300));
+    box_t const b = rt_huge.bounds();
+    double const inf = std::numeric_limits<double>::infinity();
+    BOOST_CHECK_EQUAL((bg::get<bg::min_corner, 0>(b)), float_max);
+    BOOST_CHECK_EQUAL((bg::get<bg::max_corner, 1>(b)), -float_max);
+    BOOST_CHECK_EQUAL((bg::get<bg::max_corner, 0>(b)), inf);
+    BOOST_CHECK_EQUAL((bg::get<bg::min_corner, 1>(b)), -inf);
+
+    std::vector<point_t> found;
+    rt_huge.query(bgi::intersects(point_t(1e300, -1e300)), std::back_inserter(found));
+    BOOST_CHECK_EQUAL(found.size(), 1u);
+}
+
+struct count_aggregator
+{
+    typedef size_t result_type;
+
+    result_type identity() const { return 0; }
+    result_type apply(point_t const&) const { return 1; }
+    result_type combine(result_type const& l, result_type const& r) const { return l + r; }
+};
+
+void test_augmented()
+{
+    typedef bgi::augmented<bgi::reduced_precision<bgi::rstar<4> >, count_aggregator> params_t;
+
+    std::vector<point_t> points;
+    for ( int i = 0 ; i < 500 ; ++i )
+        points.push_back(point_t(random_coord(), random_coord()));
+
+    bgi::rtree<point_t, params_t> rt(points);
+    BOOST_CHECK( bgi::detail::rtree::utilities::are_boxes_ok(rt) );
+    BOOST_CHECK_EQUAL(rt.aggregate(), points.size());
+
+    box_t b(points[0], points[1]);
+    bg::correct(b);
+    std::vector<point_t> found;
+    rt.query(bgi::covered_by(b), std::back_inserter(found));
+    BOOST_CHECK_EQUAL(rt.aggregate(bgi::covered_by(b)), found.size());
+}
+
+int test_main(int, char* [])
+{
+    test_parameters(bgi::linear<4, 2>());
+    test_parameters(bgi::quadratic<4, 2>());
+    test_parameters(bgi::rstar<4, 2>());
+    test_parameters(bgi::dynamic_linear(4, 2));
+    test_parameters(bgi::dynamic_quadratic(4, 2));
+    test_parameters(bgi::dynamic_rstar(4, 2));
+
+    test_huge_coordinates(bgi::linear<4, 2>());
+    test_huge_coordinates(bgi::rstar<4, 2>());
+
+    test_augmented();
+
+    return 0;
+}
@@ -0,0 +1,247 @@
+// Boost.Geometry Index
+// Unit Test
+
+// Copyright (c) 2026 agent.
+
+// Use, modification and distribution is subject to the Boost Software License,
+// Version 1.0. (See accompanying file LICENSE_1_0.txt or copy at
+// http://www.boost.org/LICENSE_1_0.txt)
+
+#include <rtree/test_rtree.hpp>
+
+#include <boost/geometry/index/detail/rtree/utilities/are_counts_ok.hpp>
+
+#include <cstdlib>
+
+typedef bg::model::point<double, 2, bg::cs::cartesian> point_t;
+typedef bg::model::box<point_t> box_t;
+typedef std::pair<box_t, int> value_t;
+
+inline value_t random_value(int id)
+{
+    double x = ::rand() % 1000;
+    double y = ::rand() % 1000;
+    double w = ::rand() % 20;
+    double h = ::rand() % 20;
+    return value_t(box_t(point_t(x, y), point_t(x + w, y + h)), id);
+}
+
+template <typename Rtree>
+void check_rtree(Rtree const& rt, std::vector<value_t> const& values, Rtree const& expected)
+{
+    BOOST_CHECK( bgi::detail::rtree::utilities::are_levels_ok(rt) );
+    BOOST_CHECK( bgi::detail::rtree::utilities::are_boxes_ok(rt) );
+    BOOST_CHECK( bgi::detail::rtree::utilities::are_counts_ok(rt) );
+    BOOST_CHECK_EQUAL(rt.size(), values.size());
+
+    box_t boxes[] = {
+        box_t(point_t(0, 0), point_t(1000, 1000)),
+        box_t(point_t(100, 100), point_t(300, 200)),
+        box_t(point_t(500, 0), point_t(510, 1000))
+    };
+
+    for ( size_t i = 0 ; i < sizeof(boxes) / sizeof(box_t) ; ++i )
+    {
+        std::vector<value_t> found, found_expected;
+        rt.query(bgi::intersects(boxes[i]), std::back_inserter(found));
+        expected.query(bgi::intersects(boxes[i]), std::back_inserter(found_expected));
+        basictest::compare_outputs(rt, found, found_expected);
+    }
+
+    // the nearest values may differ if their distances are equal
+    std::vector<value_t> found, found_expected;
+    rt.query(bgi::nearest(point_t(500, 500), 10), std::back_inserter(found));
+    expected.query(bgi::nearest(point_t(500, 500), 10), std::back_inserter(found_expected));
+    BOOST_CHECK_EQUAL(found.size(), found_expected.size());
+    if ( found.size() == found_expected.size() )
+    {
+        std::vector<double> distances, distances_expected;
+        for ( size_t i = 0 ; i < found.size() ; ++i )
+        {
+            distances.push_back(bg::comparable_distance(point_t(500, 500), found[i].first));
+            distances_expected.push_back(bg::comparable_distance(point_t(500, 500), found_expected[i].first));
+        }
+        std::sort(distances.begin(), distances.end());
+        std::sort(distances_expected.begin(), distances_expected.end());
+        BOOST_CHECK(distances == distances_expected);
+    }
+}
+
+template <typename Parameters>
+void test_repack(Parameters const& parameters)
+{
+    typedef bgi::rtree<value_t, Parameters> rtree_t;
+
+    // churn
+    rtree_t rt(parameters);
+    std::vector<value_t> values;
+    int id = 0;
+    for ( ; id < 2000 ; ++id )
+    {
+        values.push_back(random_value(id));
+        rt.insert(values.back());
+    }
+    for ( int i = 0 ; i < 3 ; ++i )
+    {
+        std::vector<value_t> remaining;
+        for ( size_t j = 0 ; j < values.size() ; ++j )
+        {
+            if ( ::rand() % 2 == 0 )
+                rt.remove(values[j]);
+            else
+                remaining.push_back(values[j]);
+        }
+        values.swap(remaining);
+        for ( ; values.size() < 2000 ; ++id )
+        {
+            values.push_back(random_value(id));
+            rt.insert(values.back());
+        }
+    }
+
+    rtree_t expected(values, parameters);
+    size_t const levels = bgi::detail::rtree::utilities::view<rtree_t>(rt).depth();
+
+    // limited budget, the next calls continue with the next subtrees
+    size_t repacked = 0;
+    for ( int i = 0 ; i < 10 ; ++i )
+    {
+        size_t const r = rt.repack(100);
+        BOOST_CHECK(r <= 100);
+        repacked += r;
+    }
+    BOOST_CHECK(0 < repacked);
+    check_rtree(rt, values, expected);
+    BOOST_CHECK_EQUAL(bgi::detail::rtree::utilities::view<rtree_t>(rt).depth(), levels);
+
+    repacked = rt.repack(0);
+    BOOST_CHECK_EQUAL(repacked, 0u);
+
+    // whole tree
+    repacked = rt.repack();
+    BOOST_CHECK(0 < repacked && repacked <= values.size());
+    check_rtree(rt, values, expected);
+    BOOST_CHECK(bgi::detail::rtree::utilities::view<rtree_t>(rt).depth() <= levels);
+
+    // modify repacked tree
+    for ( size_t j = 0 ; j < values.size() ; j += 2 )
+        rt.remove(values[j]);
+    BOOST_CHECK( bgi::detail::rtree::utilities::are_boxes_ok(rt) );
+    BOOST_CHECK_EQUAL(rt.size(), values.size() / 2);
+    rt.insert(values);
+    BOOST_CHECK_EQUAL(rt.size(), values.size() + values.size() / 2);
+
+    // empty
+    rtree_t empty(parameters);
+    BOOST_CHECK_EQUAL(empty.repack(), 0u);
+}
+
+// the packed nodes of points don't overlap, so after the budgeted calls
+// examined the whole tree the next ones have nothing to repack
+template <typename Parameters>
+void test_repack_progress(Parameters const& parameters)
+{
+    typedef bgi::rtree<point_t, Parameters> rtree_t;
+
+    rtree_t rt(parameters);
+    std::vector<point_t> values;
+    for ( int i = 0 ; i < 2000 ; ++i )
+    {
+        values.push_back(point_t(::rand() % 1000, ::rand() % 1000));
+        rt.insert(values.back());
+    }
+
+    // each call repacks other subtrees
+    size_t repacking_calls = 0;
+    for ( int i = 0 ; i < 1000 ; ++i )
+    {
+        if ( 0 < rt.repack(100) )
+            ++repacking_calls;
+    }
+    BOOST_CHECK(1 < repacking_calls);
+
+    size_t repacked = 0;
+    for ( int i = 0 ; i < 1000 ; ++i )
+        repacked += rt.repack(100);
+    BOOST_CHECK_EQUAL(repacked, 0u);
+
+    BOOST_CHECK( bgi::detail::rtree::utilities::are_boxes_ok(rt) );
+    BOOST_CHECK_EQUAL(rt.size(), values.size());
+    for ( size_t i = 0 ; i < values.size() ; ++i )
+        BOOST_CHECK(0 < rt.count(values[i]));
+}
+
+// the root having a single child after repacking is removed
+template <typename Parameters>
+void test_repack_collapse(Parameters const& parameters)
+{
+    typedef bgi::rtree<value_t, Parameters> rtree_t;
+
+    rtree_t rt(parameters);
+    std::vector<value_t> values;
+    for ( int id = 0 ; id < 60 ; ++id )
+    {
+        // big boxes, so the nodes overlap
+        double x = ::rand() % 1000;
+        double y = ::rand() % 1000;
+        values.push_back(value_t(box_t(point_t(x, y), point_t(x + 300, y + 300)), id));
+        rt.insert(values.back());
+    }
+
+    size_t const levels = bgi::detail::rtree::utilities::view<rtree_t>(rt).depth();
+    BOOST_CHECK(2 <= levels);
+
+    BOOST_CHECK_EQUAL(rt.repack(), values.size());
+
+    rtree_t expected(values, parameters);
+    check_rtree(rt, values, expected);
+    BOOST_CHECK_EQUAL(bgi::detail::rtree::utilities::view<rtree_t>(rt).depth(),
+                      bgi::detail::rtree::utilities::view<rtree_t>(expected).depth());
+}
+
+struct count_aggregator
+{
+    typedef size_t result_type;
+
+    result_type identity() const { return 0; }
+    result_type apply(value_t const&) const { return 1; }
+    result_type combine(result_type const& l, result_type const& r) const { return l + r; }
+};
+
+void test_augmented()
+{
+    typedef bgi::rtree<value_t, bgi::augmented<bgi::quadratic<8>, count_aggregator> > rtree_t;
+
+    rtree_t rt;
+    for ( int i = 0 ; i < 1000 ; ++i )
+        rt.insert(random_value(i));
+
+    box_t b(point_t(100, 100), point_t(600, 400));
+    std::vector<value_t> found;
+    rt.query(bgi::intersects(b), std::back_inserter(found));
+
+    rt.repack();
+
+    BOOST_CHECK_EQUAL(rt.aggregate(), 1000u);
+    BOOST_CHECK_EQUAL(rt.aggregate(bgi::intersects(b)), found.size());
+}
+
+int test_main(int, char* [])
+{
+    test_repack(bgi::linear<8, 3>());
+    test_repack(bgi::quadratic<8, 3>());
+    test_repack(bgi::rstar<8, 3>());
+    test_repack(bgi::dynamic_linear(8, 3));
+    test_repack(bgi::dynamic_quadratic(8, 3));
+    test_repack(bgi::dynamic_rstar(8, 3));
+
+    test_repack_progress(bgi::linear<8, 3>());
+    test_repack_progress(bgi::quadratic<8, 3>());
+
+    test_repack_collapse(bgi::quadratic<8, 3>());
+    test_repack_collapse(bgi::rstar<8, 3>());
+
+    test_augmented();
+
+    return 0;
+}
@@ -0,0 +1,138 @@
+// Boost.Geometry Index
+// Unit Test
+
+// Copyright (c) 2026 agent.
+
+// Use, modification and distribution is subject to the Boost Software License,
+// Version 1.0. (See accompanying file LICENSE_1_0.txt or copy at
+// http://www.boost.org/LICENSE_1_0.txt)
+
+#include <rtree/test_rtree.hpp>
+
+#include <boost/geometry/index/detail/rtree/utilities/statistics.hpp>
+
+#include <cstdlib>
+
+typedef bg::model::point<double, 2, bg::cs::cartesian> point_t;
+typedef bg::model::box<point_t> box_t;
+
+struct second_is_odd
+{
+    template <typename Value>
+    bool operator()(Value const& v) const { return v.second % 2 != 0; }
+};
+
+template <typename Value, typename Parameters>
+void test_soa_leafs_by_value(Parameters const& parameters)
+{
+    typedef bgi::soa_leafs<Parameters> params_t;
+    params_t params(parameters);
+
+    test_rtree_queries<Value>(params, std::allocator<int>());
+    test_rtree_modifiers<Value>(params, std::allocator<int>());
+}
+
+template <typename Parameters>
+void test_soa_leafs_elements(Parameters const& parameters)
+{
+    typedef std::pair<box_t, unsigned> value_t;
+    typedef bgi::rtree<value_t, Parameters> rtree_t;
+    typedef bgi::rtree<value_t, bgi::soa_leafs<Parameters> > soa_rtree_t;
+
+    std::vector<value_t> values;
+    for ( unsigned i = 0 ; i < 1000 ; ++i )
+    {
+        double x = ::rand() % 1000;
+        double y = ::rand() % 1000;
+        values.push_back(value_t(box_t(point_t(x, y), point_t(x + ::rand() % 10, y + ::rand() % 10)), i));
+    }
+
+    bgi::soa_leafs<Parameters> soa_parameters(parameters);
+
+    rtree_t rt(values, parameters);
+    soa_rtree_t soa_rt(values, soa_parameters);
+    soa_rtree_t soa_rt_inserted(soa_parameters);
+    for ( size_t i = 0 ; i < values.size() ; ++i )
+        soa_rt_inserted.insert(values[i]);
+
+    // the same structure is created for the same input
+    BOOST_CHECK_EQUAL(boost::get<0>(bgi::detail::rtree::utilities::statistics(soa_rt)),
+                      boost::get<0>(bgi::detail::rtree::utilities::statistics(rt)));
+    BOOST_CHECK_EQUAL(boost::get<2>(bgi::detail::rtree::utilities::statistics(soa_rt)),
+                      boost::get<2>(bgi::detail::rtree::utilities::statistics(rt)));
+    BOOST_CHECK(bgi::detail::rtree::utilities::are_boxes_ok(soa_rt_inserted));
+    BOOST_CHECK(bgi::detail::rtree::utilities::are_levels_ok(soa_rt_inserted));
+
+    box_t const qbox(point_t(100, 100), point_t(400, 300));
+
+    std::vector<value_t> expected, found, found_inserted;
+    rt.query(bgi::intersects(qbox), std::back_inserter(expected));
+    soa_rt.query(bgi::intersects(qbox), std::back_inserter(found));
+    soa_rt_inserted.query(bgi::intersects(qbox), std::back_inserter(found_inserted));
+    basictest::compare_outputs(rt, found, expected);
+    basictest::compare_outputs(rt, found_inserted, expected);
+
+    // query iterators
+    std::vector<value_t> found_it;
+    for ( typename soa_rtree_t::const_query_iterator it = soa_rt.qbegin(bgi::nearest(point_t(500, 500), 20)) ;
+          it != soa_rt.qend() ; ++it )
+        found_it.push_back(*it);
+    expected.clear();
+    rt.query(bgi::nearest(point_t(500, 500), 20), std::back_inserter(expected));
+    basictest::compare_outputs(rt, found_it, expected);
+
+    // predicates of values checked after the predicates of indexables
+    std::vector<value_t> expected_odd, found_odd, found_odd_it;
+    rt.query(bgi::intersects(qbox) && bgi::satisfies(second_is_odd()), std::back_inserter(expected_odd));
+    soa_rt.query(bgi::intersects(qbox) && bgi::satisfies(second_is_odd()), std::back_inserter(found_odd));
+    for ( typename soa_rtree_t::const_query_iterator it = soa_rt.qbegin(bgi::satisfies(second_is_odd()) && !bgi::disjoint(qbox)) ;
+          it != soa_rt.qend() ; ++it )
+        found_odd_it.push_back(*it);
+    BOOST_CHECK(!expected_odd.empty());
+    basictest::compare_outputs(rt, found_odd, expected_odd);
+    basictest::compare_outputs(rt, found_odd_it, expected_odd);
+
+    // distances checked in the array of indexables
+    std::vector<value_t> expected_knn_odd, found_knn_odd, found_knn_odd_it;
+    rt.query(bgi::nearest(point_t(500, 500), 20) && bgi::satisfies(second_is_odd()), std::back_inserter(expected_knn_odd));
+    soa_rt.query(bgi::nearest(point_t(500, 500), 20) && bgi::satisfies(second_is_odd()), std::back_inserter(found_knn_odd));
+    for ( typename soa_rtree_t::const_query_iterator it = soa_rt.qbegin(bgi::satisfies(second_is_odd()) && bgi::nearest(point_t(500, 500), 20)) ;
+          it != soa_rt.qend() ; ++it )
+        found_knn_odd_it.push_back(*it);
+    BOOST_CHECK_EQUAL(expected_knn_odd.size(), 20u);
+    basictest::compare_outputs(rt, found_knn_odd, expected_knn_odd);
+    basictest::compare_outputs(rt, found_knn_odd_it, expected_knn_odd);
+
+    // repacking
+    soa_rt_inserted.repack();
+    BOOST_CHECK(bgi::detail::rtree::utilities::are_boxes_ok(soa_rt_inserted));
+    found_inserted.clear();
+    soa_rt_inserted.query(bgi::intersects(qbox), std::back_inserter(found_inserted));
+    basictest::compare_outputs(rt, found_inserted, found);
+
+    // removal
+    for ( size_t i = 0 ; i < values.size() ; i += 2 )
+        BOOST_CHECK_EQUAL(soa_rt_inserted.remove(values[i]), 1u);
+    BOOST_CHECK_EQUAL(soa_rt_inserted.size(), values.size() / 2);
+    BOOST_CHECK(bgi::detail::rtree::utilities::are_boxes_ok(soa_rt_inserted));
+}
+
+template <typename Parameters>
+void test_soa_leafs(Parameters const& parameters)
+{
+    test_soa_leafs_by_value< std::pair<point_t, int> >(parameters);
+    test_soa_leafs_by_value< std::pair<box_t, int> >(parameters);
+    test_soa_leafs_by_value< std::pair<bg::model::point<float, 3, bg::cs::cartesian>, int> >(parameters);
+
+    test_soa_leafs_elements(parameters);
+}
+
+int test_main(int, char* [])
+{
+    test_soa_leafs(bgi::linear<5, 2>());
+    test_soa_leafs(bgi::quadratic<5, 2>());
+    test_soa_leafs(bgi::rstar<5, 2>());
+    test_soa_leafs(bgi::rstar<8, 3>());
+
+    return 0;
+}
@@ -1229,6 +1229,75 @@ inline void nearest_query_k(Rtree const& rtree, std::vector<Value> const& input,
 #endif
 }
 
+// rtree nearest with the maximum distance
+
+template <typename Rtree, typename Value, typename Point>
+inline void nearest_query_k_max_distance(Rtree const& rtree, std::vector<Value> const& input, Point const& pt, unsigned int k)
+{
+    typedef typename bg::default_distance_result<Point, typename Rtree::indexable_type>::type D;
+
+    std::vector<D> distances;
+    BOOST_FOREACH(Value const& v, input)
+        distances.push_back(bg::distance(pt, rtree.indexable_get()(v)));
+    std::sort(distances.begin(), distances.end());
+
+    // pick the distance in the middle between two different distances
+    // to avoid the rounding errors for Values lying at the border
+    D max_distance = 0;
+    for ( size_t i = distances.size() / 2 ; i + 1 < distances.size() ; ++i )
+    {
+        if ( distances[i] < distances[i + 1] )
+        {
+            max_distance = (distances[i] + distances[i + 1]) / 2;
+            break;
+        }
+    }
+
+    std::vector< std::pair<D, Value> > test_output;
+    BOOST_FOREACH(Value const& v, input)
+    {
+        D d = bg::distance(pt, rtree.indexable_get()(v));
+        if ( d <= max_distance )
+            test_output.push_back(std::make_pair(d, v));
+    }
+
+    std::sort(test_output.begin(), test_output.end(), NearestKLess<Rtree, Point>());
+    size_t in_range_count = test_output.size();
+
+    // all Values in range, sorted by distance
+    std::vector<Value> output;
+    std::copy(rtree.qbegin(bgi::nearest(pt, (unsigned)input.size() + 1, max_distance)), rtree.qend(), std::back_inserter(output));
+    BOOST_CHECK(output.size() == in_range_count);
+    check_sorted_by_distance(rtree, output, pt);
+    BOOST_FOREACH(Value const& v, output)
+        BOOST_CHECK(bg::distance(pt, rtree.indexable_get()(v)) <= max_distance);
+
+    // up to k Values in range
+    if ( k < test_output.size() )
+        test_output.resize(k, std::make_pair(D(0), generate::value_default<Value>::apply()));
+
+    D greatest_distance = 0;
+    if ( !test_output.empty() )
+        greatest_distance = bg::comparable_distance(pt, rtree.indexable_get()(test_output.back().second));
+
+    std::vector<Value> expected_output(test_output.size(), generate::value_default<Value>::apply());
+    std::transform(test_output.begin(), test_output.end(), expected_output.begin(), NearestKTransform<Rtree, Point>());
+
+    output.clear();
+    rtree.query(bgi::nearest(pt, k, max_distance), std::back_inserter(output));
+    compare_nearest_outputs(rtree, output, expected_output, pt, greatest_distance);
+
+    std::vector<Value> output2;
+    std::copy(rtree.qbegin(bgi::nearest(pt, k, max_distance)), rtree.qend(), std::back_inserter(output2));
+    compare_nearest_outputs(rtree, output2, expected_output, pt, greatest_distance);
+    check_sorted_by_distance(rtree, output2, pt);
+
+    // nothing in range
+    output.clear();
+    rtree.query(bgi::nearest(generate::outside_point<Point>::apply(), k, D(0)), std::back_inserter(output));
+    BOOST_CHECK(output.empty());
+}
+
 // rtree nearest not found
 
 struct AlwaysFalse
@@ -1466,6 +1535,24 @@ void create_insert(Rtree const& tree, std::vector<Value> const& input, Box const
         bgi::query(t, bgi::intersects(qbox), std::back_inserter(output));
         exactly_the_same_outputs(t, output, expected_output);
     }
+
+    // range merged into non-empty rtree
+    for ( size_t split = 0 ; split <= input.size() ; split += (std::max)(input.size() / 4, size_t(1)) )
+    {
+        Rtree t(tree.parameters(), tree.indexable_get(), tree.value_eq(), tree.get_allocator());
+        t.insert(input.begin(), input.begin() + split);
+        if ( split % 2 == 0 )
+            t.merge(input.begin() + split, input.end());
+        else
+            bgi::merge(t, std::vector<Value>(input.begin() + split, input.end()));
+        BOOST_CHECK(tree.size() == t.size());
+        BOOST_CHECK( bgi::detail::rtree::utilities::are_levels_ok(t) );
+        if ( !t.empty() )
+            BOOST_CHECK( bgi::detail::rtree::utilities::are_boxes_ok(t) );
+        std::vector<Value> output;
+        t.query(bgi::intersects(qbox), std::back_inserter(output));
+        compare_outputs(t, output, expected_output);
+    }
 }
 
 // rtree removing
@@ -1599,6 +1686,7 @@ void queries(Rtree const& tree, std::vector<Value> const& input, Box const& qbox
     bg::centroid(qbox, pt);
 
     basictest::nearest_query_k(tree, input, pt, 10);
+    basictest::nearest_query_k_max_distance(tree, input, pt, 10);
     basictest::nearest_query_not_found(tree, generate::outside_point<P>::apply());
 
     basictest::satisfies(tree, input);
@@ -0,0 +1,235 @@
+// Boost.Geometry (aka GGL, Generic Geometry Library)
+// Unit Test
+
+// Copyright (c) 2026 agent.
+
+// Use, modification and distribution is subject to the Boost Software License,
+// Version 1.0. (See accompanying file LICENSE_1_0.txt or copy at
+// http://www.boost.org/LICENSE_1_0.txt)
+
+#include <geometry_test_common.hpp>
+
+#include <map>
+#include <string>
+#include <utility>
+
+#include <boost/geometry/geometry.hpp>
+#include <boost/geometry/algorithms/clip_to_grid.hpp>
+#include <boost/geometry/geometries/point_xy.hpp>
+#include <boost/geometry/multi/geometries/multi_linestring.hpp>
+#include <boost/geometry/multi/geometries/multi_polygon.hpp>
+#include <boost/geometry/io/wkt/wkt.hpp>
+
+
+template <typename GeometryOut>
+struct tile_collector
+{
+    typedef std::pair<std::size_t, std::size_t> key_type;
+
+    tile_collector()
+        : ordered(true)
+    {}
+
+    void operator()(std::size_t column, std::size_t row,
+                GeometryOut const& geometry)
+    {
+        key_type const key(row, column);
+        if (! tiles.empty() && ! (tiles.rbegin()->first < key))
+        {
+            ordered = false;
+        }
+        tiles[key] = geometry;
+    }
+
+    std::map<key_type, GeometryOut> tiles;
+    bool ordered;
+};
+
+template <typename Polygon>
+double measure(bg::model::multi_polygon<Polygon> const& multi_polygon)
+{
+    BOOST_CHECK(bg::is_valid(multi_polygon));
+    return bg::area(multi_polygon);
+}
+
+template <typename Linestring>
+double measure(bg::model::multi_linestring<Linestring> const& multi_linestring)
+{
+    return bg::length(multi_linestring);
+}
+
+// Compares every tile with the intersection of the geometry with the tile,
+// returns the sum of the measures of all tiles
+template <typename GeometryOut, typename Geometry, typename Box>
+double check_grid(std::string const& caseid, Geometry const& geometry,
+            bg::grid_spec<Box> const& grid)
+{
+    tile_collector<GeometryOut> collector;
+    bg::clip_to_grid<GeometryOut>(geometry, grid, collector);
+    BOOST_CHECK_MESSAGE(collector.ordered, caseid << " tiles are not ordered");
+
+    double sum = 0;
+    std::size_t count = 0;
+    for (std::size_t row = 0; row < grid.rows(); row++)
+    {
+        for (std::size_t column = 0; column < grid.columns(); column++)
+        {
+            GeometryOut expected, detected;
+            bg::intersection(geometry, grid.tile(column, row), expected);
+
+            typename std::map
+                <
+                    typename tile_collector<GeometryOut>::key_type, GeometryOut
+                >::const_iterator it = collector.tiles.find(std::make_pair(row, column));
+            if (it != collector.tiles.end())
+            {
+                detected = it->second;
+                count++;
+            }
+
+            double const expected_measure = measure(expected);
+            double const detected_measure = measure(detected);
+            BOOST_CHECK_MESSAGE(bg::math::abs(detected_measure - expected_measure)
+                        <= 1.0e-10 * (1.0 + expected_measure),
+                    caseid << " tile " << column << " " << row
+                    << " detected: " << detected_measure
+                    << " expected: " << expected_measure);
+            sum += detected_measure;
+        }
+    }
+    BOOST_CHECK_EQUAL(count, collector.tiles.size());
+    return sum;
+}
+
+// The tiles together are the intersection with the box of the grid
+template <typename Geometry, typename GeometryOut, typename Box>
+void test_one(std::string const& caseid, std::string const& wkt,
+            Box const& box, std::size_t columns, std::size_t rows)
+{
+    Geometry geometry;
+    bg::read_wkt(wkt, geometry);
+    bg::correct(geometry);
+    double const sum = check_grid<GeometryOut>(caseid, geometry,
+                bg::grid_spec<Box>(box, columns, rows));
+
+    GeometryOut expected;
+    bg::intersection(geometry, box, expected);
+    BOOST_CHECK_CLOSE(sum + 1.0, measure(expected) + 1.0, 1.0e-8);
+}
+
+template <typename Polygon>
+void star(Polygon& polygon, double cx, double cy, double r1, double r2, int count)
+{
+    typedef typename bg::point_type<Polygon>::type point_type;
+    typedef typename bg::coordinate_type<point_type>::type coordinate_type;
+    double const pi = bg::math::pi<double>();
+    for (int i = 0; i < count; i++)
+    {
+        double const angle = 2.0 * pi * (i + 0.5) / count;
+        double const r = i % 2 == 0 ? r1 : r2;
+        bg::append(polygon, point_type(
+            static_cast<coordinate_type>(cx + r * cos(angle)),
+            static_cast<coordinate_type>(cy + r * sin(angle))));
+    }
+    bg::append(polygon, bg::exterior_ring(polygon).front());
+}
+
+template <typename P>
+void test_areal()
+{
+    typedef bg::model::polygon<P> polygon;
+    typedef bg::model::polygon<P, false, false> ccw_open_polygon;
+    typedef bg::model::ring<P> ring;
+    typedef bg::model::multi_polygon<polygon> multi_polygon;
+    typedef bg::model::box<P> box;
+
+    box const grid_box(P(0.5, 0.5), P(10.5, 10.5));
+
+    test_one<polygon, multi_polygon>("inside_one_tile",
+        "POLYGON((1.1 1.1,1.1 1.4,1.4 1.4,1.4 1.1,1.1 1.1))",
+        grid_box, 10, 10);
+    test_one<polygon, multi_polygon>("crossing",
+        "POLYGON((1 1,1 9,9 9,9 1,1 1),(2 2,6 2,6 6,2 6,2 2),(7.1 7.1,7.4 7.1,7.4 7.4,7.1 7.4,7.1 7.1))",
+        grid_box, 10, 10);
+    test_one<ccw_open_polygon, multi_polygon>("crossing_ccw_open",
+        "POLYGON((1 1,9 1,9 9,1 9),(2 2,2 6,6 6,6 2))",
+        grid_box, 10, 10);
+    test_one<ring, multi_polygon>("ring",
+        "POLYGON((0 0,0 9,1 9,1 1,3 1,3 9,5 9,5 1,7 1,7 9,9 9,9 0,0 0))",
+        grid_box, 4, 3);
+
+    // Partly outside the grid, and enclosing it
+    test_one<polygon, multi_polygon>("partly_outside",
+        "POLYGON((-5 -5,-5 5,5 5,5 -5,-5 -5))",
+        grid_box, 7, 5);
+    test_one<polygon, multi_polygon>("enclosing",
+        "POLYGON((-5 -5,-5 15,15 15,15 -5,-5 -5))",
+        grid_box, 7, 5);
+    test_one<polygon, multi_polygon>("enclosing_hole",
+        "POLYGON((-5 -5,-5 15,15 15,15 -5,-5 -5),(0 0,0 11,11 11,11 0,0 0))",
+        grid_box, 7, 5);
+
+    // Island in a hole, with a hole, all in one tile which is further inside
+    test_one<multi_polygon, multi_polygon>("island",
+        "MULTIPOLYGON(((-5 -5,-5 15,15 15,15 -5,-5 -5),(3.6 3.6,3.6 4.4,4.4 4.4,4.4 3.6,3.6 3.6)),"
+        "((3.7 3.7,3.7 4.3,4.3 4.3,4.3 3.7,3.7 3.7),(3.8 3.8,3.8 4.2,4.2 4.2,4.2 3.8,3.8 3.8)))",
+        grid_box, 10, 10);
+
+    // Vertices located on grid lines, clipped by the intersection
+    test_one<polygon, multi_polygon>("on_grid_lines",
+        "POLYGON((0.5 0.5,0.5 5.5,3 8,5.5 5.5,5.5 0.5,0.5 0.5))",
+        grid_box, 10, 10);
+
+    // Star covering many tiles
+    polygon star_polygon;
+    star(star_polygon, 0.0, 0.0, 100.0, 30.0, 40);
+    bg::correct(star_polygon);
+    double const sum = check_grid<multi_polygon>("star", star_polygon,
+        bg::grid_spec<box>(box(P(-101.0, -102.0), P(103.0, 101.0)), 17, 13));
+    BOOST_CHECK_CLOSE(sum, bg::area(star_polygon), 1.0e-8);
+
+    // Star with star holes, the grid only covers a part of it
+    polygon with_holes;
+    star(with_holes, 0.0, 0.0, 100.0, 80.0, 50);
+    for (int i = 0; i < 3; i++)
+    {
+        polygon hole;
+        star(hole, -40.0 + i * 40.0, 5.0, 15.0, 10.0, 12);
+        bg::interior_rings(with_holes).push_back(bg::exterior_ring(hole));
+    }
+    bg::correct(with_holes);
+    check_grid<multi_polygon>("star_holes", with_holes,
+        bg::grid_spec<box>(box(P(-60.5, -30.5), P(70.0, 40.0)), 23, 11));
+
+    multi_polygon multi;
+    multi.resize(2);
+    star(multi[0], 0.0, 0.0, 50.0, 40.0, 30);
+    star(multi[1], 120.0, 0.0, 50.0, 40.0, 30);
+    bg::correct(multi);
+    check_grid<multi_polygon>("multi", multi,
+        bg::grid_spec<box>(box(P(-60.0, -60.0), P(180.0, 60.0)), 24, 12));
+}
+
+template <typename P>
+void test_linear()
+{
+    typedef bg::model::linestring<P> linestring;
+    typedef bg::model::multi_linestring<linestring> multi_linestring;
+    typedef bg::model::box<P> box;
+
+    box const grid_box(P(0.5, 0.5), P(10.5, 10.5));
+
+    test_one<linestring, multi_linestring>("line",
+        "LINESTRING(0 0,3 7,3.2 7.1,9.9 2,11 11)",
+        grid_box, 10, 10);
+    test_one<multi_linestring, multi_linestring>("multi_line",
+        "MULTILINESTRING((1 1,1 9,9 9),(2 2,8 8,2 7.5))",
+        grid_box, 4, 4);
+}
+
+int test_main(int, char* [])
+{
+    test_areal<bg::model::d2::point_xy<double> >();
+    test_linear<bg::model::d2::point_xy<double> >();
+    return 0;
+}
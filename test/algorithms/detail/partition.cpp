@@ -559,6 +559,101 @@ void test_two_collections(int seed1, int seed2, int size, int count)
 
     BOOST_CHECK_EQUAL(visitor.count, expected_count);
     BOOST_CHECK_CLOSE(visitor.area, expected_area, 0.001);
+
+    box_visitor<box_type> median_visitor;
+    bg::partition
+        <
+            box_type,
+            get_box, ovelaps_box,
+            get_box, ovelaps_box,
+            bg::detail::partition::include_all_policy,
+            bg::detail::partition::include_all_policy,
+            bg::detail::partition::visit_no_policy,
+            bg::detail::partition::divide_median_policy
+        >::apply(boxes1, boxes2, median_visitor, 2);
+
+    BOOST_CHECK_EQUAL(median_visitor.count, expected_count);
+    BOOST_CHECK_CLOSE(median_visitor.area, expected_area, 0.001);
+}
+
+template <typename DivideBoxPolicy, typename Collection>
+bg::detail::partition::statistics test_divide_policy(Collection const& boxes,
+            int expected_count, double expected_area)
+{
+    typedef bg::model::box<point_item> box_type;
+
+    bg::detail::partition::statistics stats;
+    box_visitor<box_type> visitor;
+    bg::detail::partition::statistics_visitor
+        <
+            box_visitor<box_type>
+        > stats_visitor(visitor, stats);
+
+    bg::partition
+        <
+            box_type,
+            get_box, ovelaps_box,
+            get_box, ovelaps_box,
+            bg::detail::partition::include_all_policy,
+            bg::detail::partition::include_all_policy,
+            bg::detail::partition::visit_no_policy,
+            DivideBoxPolicy
+        >::apply(boxes, stats_visitor, 4);
+
+    BOOST_CHECK_EQUAL(visitor.count, expected_count);
+    BOOST_CHECK_CLOSE(visitor.area, expected_area, 0.001);
+
+    // Each pair is visited once
+    std::size_t const n = boxes.size();
+    BOOST_CHECK(stats.pairs_count >= std::size_t(expected_count));
+    BOOST_CHECK(stats.pairs_count <= n * (n - 1) / 2);
+    BOOST_CHECK(stats.divisions_count > 0);
+    BOOST_CHECK(stats.handle_one_count + stats.handle_two_count > 0);
+    return stats;
+}
+
+void test_clustered_boxes(int seed, int count)
+{
+    typedef bg::model::box<point_item> box_type;
+    std::vector<box_item<box_type> > boxes;
+
+    // A cluster of small boxes with a few boxes far away
+    fill_boxes(boxes, seed, 10, count);
+    for (int i = 0; i < 3; i++)
+    {
+        box_item<box_type> item(count + i + 1);
+        bg::assign_values(item.box, 10000.0 * (i + 1), 10000.0,
+                    10000.0 * (i + 1) + 1.0, 10001.0);
+        boxes.push_back(item);
+    }
+
+    int expected_count = 0;
+    double expected_area = 0.0;
+    BOOST_FOREACH(box_item<box_type> const& item1, boxes)
+    {
+        BOOST_FOREACH(box_item<box_type> const& item2, boxes)
+        {
+            if (item1.id < item2.id && bg::intersects(item1.box, item2.box))
+            {
+                box_type b;
+                bg::intersection(item1.box, item2.box, b);
+                expected_area += bg::area(b);
+                expected_count++;
+            }
+        }
+    }
+
+    bg::detail::partition::statistics const middle
+        = test_divide_policy<bg::detail::partition::divide_middle_policy>(
+                boxes, expected_count, expected_area);
+    bg::detail::partition::statistics const median
+        = test_divide_policy<bg::detail::partition::divide_median_policy>(
+                boxes, expected_count, expected_area);
+
+    // Dividing at the median visits less pairs in smaller brute-force
+    // visits
+    BOOST_CHECK_LT(median.pairs_count, middle.pairs_count);
+    BOOST_CHECK_LT(median.max_handled_pairs, middle.max_handled_pairs);
 }
 
 
@@ -664,5 +759,8 @@ int test_main( int , char* [] )
 
     test_heterogenuous_collections(67890, 98765, 20, 60);
 
+    test_clustered_boxes(12345, 200);
+    test_clustered_boxes(54321, 500);
+
     return 0;
 }
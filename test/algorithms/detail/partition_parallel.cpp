@@ -0,0 +1,281 @@
+// Boost.Geometry (aka GGL, Generic Geometry Library)
+// Unit Test
+
+// Copyright (c) 2026 agent.
+
+// Use, modification and distribution is subject to the Boost Software License,
+// Version 1.0. (See accompanying file LICENSE_1_0.txt or copy at
+// http://www.boost.org/LICENSE_1_0.txt)
+
+#define BOOST_GEOMETRY_EXPERIMENTAL_ENABLE_PARALLEL_PARTITION
+#define BOOST_GEOMETRY_PARTITION_THREADS 4
+
+#include <geometry_test_common.hpp>
+
+#include <utility>
+#include <vector>
+
+#include <boost/geometry/geometry.hpp>
+#include <boost/geometry/geometries/point_xy.hpp>
+
+#include <boost/geometry/algorithms/detail/partition.hpp>
+#include <boost/geometry/algorithms/detail/overlay/get_turns.hpp>
+#include <boost/geometry/algorithms/detail/overlay/self_turn_points.hpp>
+
+#include <boost/random/linear_congruential.hpp>
+#include <boost/random/uniform_int.hpp>
+#include <boost/random/variate_generator.hpp>
+
+
+template <typename Box>
+struct box_item
+{
+    int id;
+    Box box;
+};
+
+struct get_box
+{
+    template <typename Box, typename InputItem>
+    static inline void apply(Box& total, InputItem const& item)
+    {
+        bg::expand(total, item.box);
+    }
+};
+
+struct ovelaps_box
+{
+    template <typename Box, typename InputItem>
+    static inline bool apply(Box const& box, InputItem const& item)
+    {
+        return ! bg::detail::disjoint::disjoint_box_box(box, item.box);
+    }
+};
+
+// Gathers the ids of the pairs of intersecting boxes
+struct pairs_visitor
+{
+    typedef std::vector<std::pair<int, int> > pairs_type;
+
+    pairs_type m_splitted_pairs;
+    pairs_type& pairs;
+
+    explicit pairs_visitor(pairs_type& p)
+        : pairs(p)
+    {}
+
+    template <typename Item>
+    inline void apply(Item const& item1, Item const& item2)
+    {
+        if (bg::intersects(item1.box, item2.box))
+        {
+            pairs.push_back(std::make_pair(item1.id, item2.id));
+        }
+    }
+
+    pairs_visitor(pairs_visitor& , bg::detail::partition::split)
+        : pairs(m_splitted_pairs)
+    {}
+
+    inline void join(pairs_visitor& other)
+    {
+        pairs.insert(pairs.end(), other.pairs.begin(), other.pairs.end());
+    }
+};
+
+// The same visitor but visiting serially
+struct serial_pairs_visitor : pairs_visitor
+{
+    explicit serial_pairs_visitor(pairs_type& p)
+        : pairs_visitor(p)
+    {}
+};
+
+namespace boost { namespace geometry { namespace detail { namespace partition
+{
+
+template <>
+struct is_splittable_visitor<pairs_visitor>
+    : boost::true_type
+{};
+
+}}}} // namespace boost::geometry::detail::partition
+
+
+template <typename Box>
+void fill_boxes(std::vector<box_item<Box> >& collection, int seed, int size, int count)
+{
+    typedef boost::minstd_rand base_generator_type;
+
+    base_generator_type generator(seed);
+
+    boost::uniform_int<> random_coordinate(0, size - 1);
+    boost::variate_generator<base_generator_type&, boost::uniform_int<> >
+        coordinate_generator(generator, random_coordinate);
+
+    for (int i = 0; i < count; i++)
+    {
+        box_item<Box> item;
+        item.id = i;
+        int x = coordinate_generator();
+        int y = coordinate_generator();
+        bg::assign_values(item.box, x, y,
+            x + coordinate_generator() % 20, y + coordinate_generator() % 20);
+        collection.push_back(item);
+    }
+}
+
+template <typename Box>
+void test_pairs(int seed, int size, int count)
+{
+    typedef box_item<Box> item_type;
+    std::vector<item_type> boxes1, boxes2;
+    fill_boxes(boxes1, seed, size, count);
+    fill_boxes(boxes2, seed + 1, size, count);
+
+    typedef bg::partition<Box, get_box, ovelaps_box> partition_type;
+
+    // one collection
+    {
+        pairs_visitor::pairs_type parallel, serial;
+        pairs_visitor visitor(parallel);
+        serial_pairs_visitor serial_visitor(serial);
+        partition_type::apply(boxes1, visitor);
+        partition_type::apply(boxes1, serial_visitor);
+
+        BOOST_CHECK(! serial.empty());
+        BOOST_CHECK(parallel == serial);
+    }
+
+    // two collections
+    {
+        pairs_visitor::pairs_type parallel, serial;
+        pairs_visitor visitor(parallel);
+        serial_pairs_visitor serial_visitor(serial);
+        partition_type::apply(boxes1, boxes2, visitor);
+        partition_type::apply(boxes1, boxes2, serial_visitor);
+
+        BOOST_CHECK(! serial.empty());
+        BOOST_CHECK(parallel == serial);
+    }
+}
+
+// The interrupt policy which is never interrupting but disables the
+// concurrent partition, so it may be used to get the serial result
+struct serial_interrupt_policy
+    : bg::detail::get_turns::no_interrupt_policy
+{};
+
+struct serial_self_interrupt_policy
+    : bg::detail::self_get_turn_points::no_interrupt_policy
+{};
+
+template <typename Turns>
+bool equal_turns(Turns const& turns1, Turns const& turns2)
+{
+    if (turns1.size() != turns2.size())
+    {
+        return false;
+    }
+
+    for (std::size_t i = 0; i < turns1.size(); i++)
+    {
+        if (! bg::equals(turns1[i].point, turns2[i].point)
+            || ! (turns1[i].operations[0].seg_id == turns2[i].operations[0].seg_id)
+            || ! (turns1[i].operations[1].seg_id == turns2[i].operations[1].seg_id))
+        {
+            return false;
+        }
+    }
+    return true;
+}
+
+template <typename Polygon>
+void star(Polygon& polygon, double cx, double cy, double r1, double r2, int count)
+{
+    typedef typename bg::point_type<Polygon>::type point_type;
+    double const pi = bg::math::pi<double>();
+    for (int i = 0; i < count; i++)
+    {
+        double const angle = 2.0 * pi * i / count;
+        double const r = i % 2 == 0 ? r1 : r2;
+        bg::append(polygon, point_type(cx + r * cos(angle), cy + r * sin(angle)));
+    }
+    bg::append(polygon, polygon.outer().front());
+}
+
+template <typename P>
+void test_turns()
+{
+    typedef bg::model::polygon<P> polygon;
+    typedef bg::model::multi_polygon<polygon> multi_polygon;
+    typedef bg::detail::overlay::assign_null_policy assign_policy;
+
+    polygon star1, star2;
+    star(star1, 0.0, 0.0, 100.0, 90.0, 5000);
+    star(star2, 5.0, 3.0, 100.0, 90.0, 5000);
+    bg::correct(star1);
+    bg::correct(star2);
+
+    typedef typename bg::rescale_policy_type<P>::type rescale_policy_type;
+    rescale_policy_type rescale_policy
+        = bg::get_rescale_policy<rescale_policy_type>(star1, star2);
+
+    typedef bg::detail::overlay::turn_info
+        <
+            P,
+            typename bg::segment_ratio_type<P, rescale_policy_type>::type
+        > turn_info;
+
+    // turns of two geometries
+    {
+        std::vector<turn_info> parallel, serial;
+        bg::detail::get_turns::no_interrupt_policy policy;
+        serial_interrupt_policy serial_policy;
+        bg::get_turns<false, false, assign_policy>(star1, star2,
+                rescale_policy, parallel, policy);
+        bg::get_turns<false, false, assign_policy>(star1, star2,
+                rescale_policy, serial, serial_policy);
+
+        BOOST_CHECK(! serial.empty());
+        BOOST_CHECK(equal_turns(parallel, serial));
+    }
+
+    // self turns
+    {
+        polygon both = star1;
+        bg::append(both.outer(), star2.outer());
+
+        std::vector<turn_info> parallel, serial;
+        bg::detail::self_get_turn_points::no_interrupt_policy policy;
+        serial_self_interrupt_policy serial_policy;
+        bg::self_turns<assign_policy>(both, rescale_policy, parallel, policy);
+        bg::self_turns<assign_policy>(both, rescale_policy, serial, serial_policy);
+
+        BOOST_CHECK(! serial.empty());
+        BOOST_CHECK(equal_turns(parallel, serial));
+    }
+
+    // overlay using the concurrent partition
+    {
+        multi_polygon intersection, union_;
+        bg::intersection(star1, star2, intersection);
+        bg::union_(star1, star2, union_);
+        BOOST_CHECK_CLOSE(bg::area(intersection) + bg::area(union_),
+                          bg::area(star1) + bg::area(star2), 0.0001);
+    }
+}
+
+int test_main(int, char* [])
+{
+    typedef bg::model::d2::point_xy<double> point;
+    typedef bg::model::box<point> box;
+
+    test_pairs<box>(12345, 1000, 2000);
+    test_pairs<box>(54321, 100, 5000);
+    test_pairs<box>(1, 10000, 1000);
+
+    test_turns<point>();
+
+    return 0;
+}
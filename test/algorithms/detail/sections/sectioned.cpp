@@ -0,0 +1,210 @@
+// Boost.Geometry (aka GGL, Generic Geometry Library)
+// Unit Test
+
+// Copyright (c) 2026 agent.
+
+// Use, modification and distribution is subject to the Boost Software License,
+// Version 1.0. (See accompanying file LICENSE_1_0.txt or copy at
+// http://www.boost.org/LICENSE_1_0.txt)
+
+#include <geometry_test_common.hpp>
+
+#include <vector>
+
+#include <boost/geometry/geometry.hpp>
+#include <boost/geometry/geometries/point_xy.hpp>
+#include <boost/geometry/multi/geometries/multi_polygon.hpp>
+
+#include <boost/geometry/views/sectioned.hpp>
+#include <boost/geometry/algorithms/detail/sections/sectioned.hpp>
+
+
+template <typename Polygon>
+void star(Polygon& polygon, double cx, double cy, double r1, double r2, int count)
+{
+    typedef typename bg::point_type<Polygon>::type point_type;
+    typedef typename bg::coordinate_type<point_type>::type coordinate_type;
+    double const pi = bg::math::pi<double>();
+    for (int i = 0; i < count; i++)
+    {
+        double const angle = 2.0 * pi * i / count;
+        double const r = i % 2 == 0 ? r1 : r2;
+        bg::append(polygon, point_type(
+            static_cast<coordinate_type>(cx + r * cos(angle)),
+            static_cast<coordinate_type>(cy + r * sin(angle))));
+    }
+    bg::append(polygon, polygon.outer().front());
+    bg::correct(polygon);
+}
+
+template <typename Geometry1, typename Geometry2>
+void check_operations(Geometry1 const& geometry1, Geometry2 const& geometry2,
+            bg::sectioned<Geometry1> const& sectioned1)
+{
+    typedef typename bg::point_type<Geometry1>::type point_type;
+    typedef bg::model::multi_polygon<bg::model::polygon<point_type> > result_type;
+
+    result_type expected, detected;
+
+    bg::intersection(geometry1, geometry2, expected);
+    bg::intersection(sectioned1, geometry2, detected);
+    BOOST_CHECK_CLOSE(bg::area(detected), bg::area(expected), 0.0001);
+
+    bg::clear(expected); bg::clear(detected);
+    bg::union_(geometry2, geometry1, expected);
+    bg::union_(geometry2, sectioned1, detected);
+    BOOST_CHECK_CLOSE(bg::area(detected), bg::area(expected), 0.0001);
+
+    bg::clear(expected); bg::clear(detected);
+    bg::difference(geometry2, geometry1, expected);
+    bg::difference(geometry2, sectioned1, detected);
+    BOOST_CHECK_CLOSE(bg::area(detected) + 1.0, bg::area(expected) + 1.0, 0.0001);
+
+    BOOST_CHECK_EQUAL(bg::intersects(sectioned1, geometry2),
+                      bg::intersects(geometry1, geometry2));
+    BOOST_CHECK_EQUAL(bg::disjoint(geometry2, sectioned1),
+                      bg::disjoint(geometry2, geometry1));
+    BOOST_CHECK_EQUAL(bg::within(geometry2, sectioned1),
+                      bg::within(geometry2, geometry1));
+    BOOST_CHECK_EQUAL(bg::covered_by(geometry2, sectioned1),
+                      bg::covered_by(geometry2, geometry1));
+    BOOST_CHECK_EQUAL(bg::touches(sectioned1, geometry2),
+                      bg::touches(geometry1, geometry2));
+}
+
+template <typename P>
+void test_polygon()
+{
+    typedef bg::model::polygon<P> polygon;
+
+    polygon clip;
+    star(clip, 0.0, 0.0, 1000.0, 900.0, 2000);
+
+    bg::sectioned<polygon> sectioned_clip(clip);
+
+    BOOST_CHECK_CLOSE(bg::area(sectioned_clip), bg::area(clip), 0.0001);
+    BOOST_CHECK_EQUAL(bg::num_points(sectioned_clip), bg::num_points(clip));
+    BOOST_CHECK(bg::is_valid(sectioned_clip));
+
+    // Features inside, crossing and outside of the clip polygon
+    for (int i = 0; i < 12; i++)
+    {
+        polygon feature;
+        star(feature, -1100.0 + i * 200.0, 100.0 + i * 20.0, 150.0, 120.0, 50);
+        check_operations(clip, feature, sectioned_clip);
+    }
+}
+
+template <typename P>
+void test_multi_polygon()
+{
+    typedef bg::model::polygon<P> polygon;
+    typedef bg::model::multi_polygon<polygon> multi_polygon;
+
+    multi_polygon clip;
+    clip.resize(2);
+    star(clip[0], 0.0, 0.0, 500.0, 450.0, 400);
+    star(clip[1], 1200.0, 0.0, 500.0, 450.0, 400);
+
+    bg::sectioned<multi_polygon> sectioned_clip(clip);
+    BOOST_CHECK_CLOSE(bg::area(sectioned_clip), bg::area(clip), 0.0001);
+
+    for (int i = 0; i < 5; i++)
+    {
+        polygon feature;
+        star(feature, -600.0 + i * 500.0, 100.0, 200.0, 170.0, 50);
+        check_operations(clip, feature, sectioned_clip);
+    }
+}
+
+template <typename P>
+void test_linestring()
+{
+    typedef bg::model::linestring<P> linestring;
+    typedef bg::model::polygon<P> polygon;
+
+    linestring line;
+    for (int i = 0; i < 1000; i++)
+    {
+        bg::append(line, P(i, (i % 2) * 10.0));
+    }
+    bg::sectioned<linestring> sectioned_line(line);
+
+    BOOST_CHECK_CLOSE(bg::length(sectioned_line), bg::length(line), 0.0001);
+
+    for (int i = 0; i < 5; i++)
+    {
+        polygon feature;
+        star(feature, i * 300.0, -50.0 + i * 20.0, 40.0, 30.0, 30);
+        BOOST_CHECK_EQUAL(bg::intersects(sectioned_line, feature),
+                          bg::intersects(line, feature));
+        BOOST_CHECK_EQUAL(bg::disjoint(feature, sectioned_line),
+                          bg::disjoint(feature, line));
+    }
+}
+
+template <typename P>
+void test_cache()
+{
+    typedef bg::model::polygon<P> polygon;
+    typedef bg::model::box<P> box_type;
+    typedef bg::sections<box_type, 2> sections_type;
+    typedef boost::mpl::vector_c<std::size_t, 0, 1> dimensions;
+
+    polygon poly;
+    star(poly, 0.0, 0.0, 1000.0, 900.0, 100);
+    bg::sectioned<polygon> sectioned_poly(poly);
+
+    bg::detail::no_rescale_policy robust_policy;
+    sections_type local;
+    sections_type const& sec1 = bg::detail::sectionalize::get_sections
+        <false, dimensions>(sectioned_poly, robust_policy, local, 0);
+    sections_type const& sec2 = bg::detail::sectionalize::get_sections
+        <false, dimensions>(sectioned_poly, robust_policy, local, 0);
+    sections_type const& sec3 = bg::detail::sectionalize::get_sections
+        <false, dimensions>(sectioned_poly, robust_policy, local, 1);
+
+    // The sections are created once, and not in the local sections
+    BOOST_CHECK(&sec1 == &sec2);
+    BOOST_CHECK(&sec1 != &sec3);
+    BOOST_CHECK(local.empty());
+
+    sections_type expected;
+    bg::sectionalize<false, dimensions>(poly, robust_policy, expected, 1);
+    BOOST_CHECK_EQUAL(sec3.size(), expected.size());
+    BOOST_CHECK_EQUAL(sec3.front().ring_id.source_index, 1);
+
+    // Sections of another type are cached separately
+    typedef bg::sections<box_type, 1> sections1_type;
+    typedef boost::mpl::vector_c<std::size_t, 0> dimensions1;
+    sections1_type local1;
+    sections1_type const& sec5 = bg::detail::sectionalize::get_sections
+        <false, dimensions1>(sectioned_poly, robust_policy, local1, 0);
+    sections1_type expected1;
+    bg::sectionalize<false, dimensions1>(poly, robust_policy, expected1, 0);
+    BOOST_CHECK_EQUAL(sec5.size(), expected1.size());
+    sections_type const& sec6 = bg::detail::sectionalize::get_sections
+        <false, dimensions>(sectioned_poly, robust_policy, local, 0);
+    BOOST_CHECK(&sec6 == &sec1);
+
+    // Sections are created again after the modification of the geometry
+    bg::clear(poly);
+    star(poly, 0.0, 0.0, 1000.0, 900.0, 200);
+    sectioned_poly.reset();
+    bg::sectionalize<false, dimensions>(poly, robust_policy, expected, 0);
+    sections_type const& sec4 = bg::detail::sectionalize::get_sections
+        <false, dimensions>(sectioned_poly, robust_policy, local, 0);
+    BOOST_CHECK_EQUAL(sec4.size(), expected.size());
+    BOOST_CHECK(sec4.size() > sec1.size());
+}
+
+int test_main(int, char* [])
+{
+    test_polygon<bg::model::d2::point_xy<double> >();
+    test_polygon<bg::model::d2::point_xy<int> >();
+    test_multi_polygon<bg::model::d2::point_xy<double> >();
+    test_linestring<bg::model::d2::point_xy<double> >();
+    test_cache<bg::model::d2::point_xy<int> >();
+
+    return 0;
+}
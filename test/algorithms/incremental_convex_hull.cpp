@@ -0,0 +1,134 @@
+// Boost.Geometry (aka GGL, Generic Geometry Library)
+// Unit Test
+
+// Copyright (c) 2026 agent.
+
+// Use, modification and distribution is subject to the Boost Software License,
+// Version 1.0. (See accompanying file LICENSE_1_0.txt or copy at
+// http://www.boost.org/LICENSE_1_0.txt)
+
+#include <geometry_test_common.hpp>
+
+#include <string>
+#include <vector>
+
+#include <boost/geometry/algorithms/convex_hull.hpp>
+#include <boost/geometry/algorithms/equals.hpp>
+#include <boost/geometry/algorithms/incremental_convex_hull.hpp>
+#include <boost/geometry/geometries/geometries.hpp>
+#include <boost/geometry/geometries/point_xy.hpp>
+#include <boost/geometry/multi/geometries/multi_point.hpp>
+#include <boost/geometry/io/wkt/wkt.hpp>
+#include <boost/geometry/strategies/strategies.hpp>
+
+
+// The hull should be the same as calculated by convex_hull, with the same
+// points in the same order
+template <typename Hull, typename Incremental, typename MultiPoint>
+void check_hull(std::string const& caseid, Incremental const& incremental,
+                MultiPoint const& points)
+{
+    Hull expected, hull;
+    bg::convex_hull(points, expected);
+    incremental.result(hull);
+
+    typedef typename bg::detail::range_type<Hull>::type ring_type;
+    ring_type const& ring = bg::detail::as_range<ring_type>(hull);
+    ring_type const& expected_ring = bg::detail::as_range<ring_type>(expected);
+
+    bool equal = ring.size() == expected_ring.size();
+    for (std::size_t i = 0; equal && i < ring.size(); i++)
+    {
+        equal = bg::equals(ring[i], expected_ring[i]);
+    }
+    BOOST_CHECK_MESSAGE(equal,
+        caseid << " " << points.size() << " points detected: " << bg::wkt(hull)
+        << " expected: " << bg::wkt(expected));
+}
+
+template <typename Hull, typename P>
+void test_points(std::string const& caseid, std::string const& wkt)
+{
+    bg::model::multi_point<P> input;
+    bg::read_wkt(wkt, input);
+
+    bg::incremental_convex_hull<P> incremental;
+    bg::model::multi_point<P> points;
+    for (std::size_t i = 0; i < input.size(); i++)
+    {
+        incremental.insert(input[i]);
+        points.push_back(input[i]);
+        check_hull<Hull>(caseid, incremental, points);
+    }
+}
+
+template <typename Hull, typename P>
+void test_random(std::string const& caseid, int count, int range)
+{
+    bg::incremental_convex_hull<P> incremental;
+    bg::model::multi_point<P> points;
+
+    unsigned int seed = 4711;
+    for (int i = 1; i <= count; i++)
+    {
+        seed = seed * 1103515245u + 12345u;
+        int const x = (seed >> 8) % range;
+        seed = seed * 1103515245u + 12345u;
+        int const y = (seed >> 8) % range;
+
+        P const p(x - range / 2, y - range / 2);
+        incremental.insert(p);
+        points.push_back(p);
+
+        if (i % 97 == 0 || i < 20)
+        {
+            check_hull<Hull>(caseid, incremental, points);
+        }
+    }
+}
+
+template <typename Hull, typename P>
+void test_hull()
+{
+    bg::incremental_convex_hull<P> incremental;
+    BOOST_CHECK(incremental.empty());
+    Hull hull;
+    incremental.result(hull);
+    BOOST_CHECK_EQUAL(bg::num_points(hull), 0u);
+
+    test_points<Hull, P>("square",
+        "MULTIPOINT(1 1,0 0,2 2,0 2,2 0,1 1,1 0,0 1)");
+    test_points<Hull, P>("collinear",
+        "MULTIPOINT(1 1,2 2,0 0,3 3,1.5 1.5,-1 -1)");
+    test_points<Hull, P>("vertical",
+        "MULTIPOINT(0 1,0 3,0 2,0 0,0 4)");
+    test_points<Hull, P>("same", "MULTIPOINT(3 3,3 3,3 3)");
+    test_points<Hull, P>("growing",
+        "MULTIPOINT(0 0,1 0,1 1,0 1,-1 0.5,0.5 -1,2 0.5,0.5 2,5 5,-5 -5,5 -5,-5 5)");
+    test_points<Hull, P>("concave_order",
+        "MULTIPOINT(0 0,4 0,2 1,1 0.2,3 0.2,2 3,2 -3)");
+
+    test_random<Hull, P>("random_small", 1000, 8);
+    test_random<Hull, P>("random", 2000, 1000);
+
+    incremental.insert(P(1, 1));
+    BOOST_CHECK(! incremental.empty());
+    incremental.clear();
+    BOOST_CHECK(incremental.empty());
+}
+
+template <typename P>
+void test_all()
+{
+    test_hull<bg::model::polygon<P>, P>();
+    test_hull<bg::model::polygon<P, false, false>, P>();
+    test_hull<bg::model::ring<P, true, false>, P>();
+    test_hull<bg::model::ring<P, false, true>, P>();
+}
+
+int test_main(int, char* [])
+{
+    test_all<bg::model::d2::point_xy<double> >();
+    test_all<bg::model::d2::point_xy<float> >();
+    return 0;
+}
@@ -0,0 +1,198 @@
+// Boost.Geometry (aka GGL, Generic Geometry Library)
+// Unit Test
+
+// Copyright (c) 2026 agent.
+
+// Use, modification and distribution is subject to the Boost Software License,
+// Version 1.0. (See accompanying file LICENSE_1_0.txt or copy at
+// http://www.boost.org/LICENSE_1_0.txt)
+
+#include <geometry_test_common.hpp>
+
+#include <string>
+
+#include <boost/geometry/geometry.hpp>
+#include <boost/geometry/geometries/point_xy.hpp>
+#include <boost/geometry/multi/geometries/multi_polygon.hpp>
+#include <boost/geometry/io/wkt/wkt.hpp>
+
+
+// Compares the clipped geometry with the overlay of the box as a polygon.
+// The overlay rescales the intersection points, so the areas differ slightly.
+template <typename Geometry, typename Box>
+double check_clip(std::string const& caseid, Geometry const& geometry,
+            Box const& box, int expected_count = -1)
+{
+    typedef typename bg::point_type<Geometry>::type point_type;
+    typedef bg::model::polygon<point_type> polygon;
+    typedef bg::model::multi_polygon<polygon> multi_polygon;
+
+    polygon box_polygon;
+    bg::convert(box, box_polygon);
+
+    multi_polygon clipped, expected, reversed;
+    bg::intersection(geometry, box, clipped);
+    bg::intersection(box, geometry, reversed);
+    bg::intersection(geometry, box_polygon, expected);
+
+    BOOST_CHECK_MESSAGE(bg::is_valid(clipped),
+            caseid << " clipped result is not valid: " << bg::wkt(clipped));
+    BOOST_CHECK_CLOSE(bg::area(clipped) + 1.0, bg::area(expected) + 1.0, 0.01);
+    BOOST_CHECK_CLOSE(bg::area(reversed) + 1.0, bg::area(clipped) + 1.0, 1.0e-10);
+    BOOST_CHECK_EQUAL(clipped.size(), expected.size());
+    if (expected_count >= 0)
+    {
+        BOOST_CHECK_EQUAL(clipped.size(), std::size_t(expected_count));
+    }
+    return bg::area(clipped);
+}
+
+template <typename Geometry, typename Box>
+void test_one(std::string const& caseid, std::string const& wkt,
+            std::string const& box_wkt, int expected_count)
+{
+    Geometry geometry;
+    Box box;
+    bg::read_wkt(wkt, geometry);
+    bg::read_wkt(box_wkt, box);
+    bg::correct(geometry);
+    BOOST_CHECK_MESSAGE(bg::is_valid(geometry), caseid << " input is not valid");
+    check_clip(caseid, geometry, box, expected_count);
+}
+
+template <typename Polygon>
+void star(Polygon& polygon, double cx, double cy, double r1, double r2, int count)
+{
+    typedef typename bg::point_type<Polygon>::type point_type;
+    typedef typename bg::coordinate_type<point_type>::type coordinate_type;
+    double const pi = bg::math::pi<double>();
+    for (int i = 0; i < count; i++)
+    {
+        double const angle = 2.0 * pi * (i + 0.5) / count;
+        double const r = i % 2 == 0 ? r1 : r2;
+        bg::append(polygon, point_type(
+            static_cast<coordinate_type>(cx + r * cos(angle)),
+            static_cast<coordinate_type>(cy + r * sin(angle))));
+    }
+    bg::append(polygon, bg::exterior_ring(polygon).front());
+}
+
+template <typename Polygon, typename Box>
+void test_areal()
+{
+    std::string const clip = "box(2 2,8 8)";
+
+    // Inside, outside, enclosing the box
+    test_one<Polygon, Box>("inside", "POLYGON((3 3,3 7,7 7,7 3,3 3))", clip, 1);
+    test_one<Polygon, Box>("outside", "POLYGON((9 9,9 10,10 10,10 9,9 9))", clip, 0);
+    test_one<Polygon, Box>("outside_envelope",
+        "POLYGON((0 0,0 10,1 10,1 1,10 1,10 0,0 0))", clip, 0);
+    test_one<Polygon, Box>("enclosing", "POLYGON((0 0,0 10,10 10,10 0,0 0))", clip, 1);
+
+    // Crossing once, or several times resulting in more polygons
+    test_one<Polygon, Box>("crossing", "POLYGON((1 1,1 5,5 5,5 1,1 1))", clip, 1);
+    test_one<Polygon, Box>("comb",
+        "POLYGON((0 0,0 9,3 9,3 5,4 5,4 9,5 9,5 5,6 5,6 9,9 9,9 0,0 0))", clip, 1);
+    test_one<Polygon, Box>("fork",
+        "POLYGON((0 0,0 9,1 9,1 1,3 1,3 9,5 9,5 1,7 1,7 9,9 9,9 0,0 0))", clip, 2);
+    test_one<Polygon, Box>("spiral",
+        "POLYGON((1 1,1 9,9 9,9 3,3 3,3 7,7 7,7 5,5 5,5 6,6 6,6 6.5,4 6.5,4 4,7.5 4,7.5 7.5,1.5 7.5,1.5 1,1 1))",
+        clip, 1);
+
+    // Holes: inside, crossing, enclosing the box, outside
+    test_one<Polygon, Box>("hole_inside",
+        "POLYGON((0 0,0 10,10 10,10 0,0 0),(4 4,4 6,6 6,6 4,4 4))", clip, 1);
+    test_one<Polygon, Box>("hole_crossing",
+        "POLYGON((0 0,0 10,10 10,10 0,0 0),(1 4,1 6,6 6,6 4,1 4))", clip, 1);
+    test_one<Polygon, Box>("hole_splitting",
+        "POLYGON((0 0,0 10,10 10,10 0,0 0),(1 4,1 6,9 6,9 4,1 4))", clip, 2);
+    test_one<Polygon, Box>("hole_splitting_inside",
+        "POLYGON((0 0,0 10,10 10,10 0,0 0),(1 4,1 6,9 6,9 4,1 4),"
+        "(3 7,3 7.5,3.5 7.5,3.5 7,3 7),(3 3,3 3.5,3.5 3.5,3.5 3,3 3))", clip, 2);
+    test_one<Polygon, Box>("hole_enclosing",
+        "POLYGON((0 0,0 10,10 10,10 0,0 0),(1 1,1 9,9 9,9 1,1 1))", clip, 0);
+    test_one<Polygon, Box>("hole_outside",
+        "POLYGON((0 0,0 10,10 10,10 0,0 0),(8.5 8.5,8.5 9,9 9,9 8.5,8.5 8.5))", clip, 1);
+
+    // Degenerate cases, handled by the overlay
+    test_one<Polygon, Box>("vertex_on_border", "POLYGON((2 2,2 5,5 5,5 2,2 2))", clip, 1);
+    test_one<Polygon, Box>("along_border", "POLYGON((1 2,1 5,5 5,5 2,1 2))", clip, 1);
+    test_one<Polygon, Box>("touching_corner", "POLYGON((0 0,0 1,1 1,1 0,0 0))", clip, 0);
+    test_one<Polygon, Box>("touching_corner2", "POLYGON((9 7,7 9,11 11,9 7))", clip, 0);
+}
+
+template <typename P>
+void test_stars()
+{
+    typedef bg::model::polygon<P> polygon;
+    typedef bg::model::multi_polygon<polygon> multi_polygon;
+    typedef bg::model::box<P> box;
+
+    polygon star_polygon;
+    star(star_polygon, 0.0, 0.0, 100.0, 30.0, 40);
+    bg::correct(star_polygon);
+
+    // Boxes of a grid clipping the star, as tiles, together covering it
+    double sum = 0;
+    for (int i = -4; i < 4; i++)
+    {
+        for (int j = -4; j < 4; j++)
+        {
+            box tile(P(i * 27.1, j * 27.3), P((i + 1) * 27.1, (j + 1) * 27.3));
+            sum += check_clip("star_tile", star_polygon, tile);
+        }
+    }
+    BOOST_CHECK_CLOSE(sum, bg::area(star_polygon), 1.0e-10);
+
+    // Star with star holes
+    polygon with_holes;
+    star(with_holes, 0.0, 0.0, 100.0, 80.0, 50);
+    bg::correct(with_holes);
+    for (int i = 0; i < 3; i++)
+    {
+        polygon hole;
+        star(hole, -40.0 + i * 40.0, 5.0, 15.0, 10.0, 12);
+        bg::interior_rings(with_holes).push_back(bg::exterior_ring(hole));
+    }
+    bg::correct(with_holes);
+    BOOST_CHECK(bg::is_valid(with_holes));
+    for (int i = 0; i < 12; i++)
+    {
+        box tile(P(-95.5 + i * 10.0, -8.5), P(-60.5 + i * 12.0, 9.5 + i));
+        check_clip("star_holes", with_holes, tile);
+    }
+
+    // Multi polygon
+    multi_polygon multi;
+    multi.resize(2);
+    star(multi[0], 0.0, 0.0, 50.0, 40.0, 30);
+    star(multi[1], 120.0, 0.0, 50.0, 40.0, 30);
+    bg::correct(multi);
+    for (int i = 0; i < 8; i++)
+    {
+        box tile(P(-60.5 + i * 25.0, -20.5), P(-10.5 + i * 25.0, 70.5));
+        check_clip("multi", multi, tile);
+    }
+}
+
+template <typename P>
+void test_all()
+{
+    typedef bg::model::box<P> box;
+    test_areal<bg::model::polygon<P>, box>();
+    test_areal<bg::model::polygon<P, false>, box>();
+    test_areal<bg::model::polygon<P, true, false>, box>();
+    test_areal<bg::model::polygon<P, false, false>, box>();
+
+    test_one<bg::model::ring<P>, box>("ring",
+        "POLYGON((0 0,0 9,1 9,1 1,3 1,3 9,5 9,5 1,7 1,7 9,9 9,9 0,0 0))",
+        "box(2 2,8 8)", 2);
+
+    test_stars<P>();
+}
+
+int test_main(int, char* [])
+{
+    test_all<bg::model::d2::point_xy<double> >();
+    return 0;
+}
@@ -14,6 +14,8 @@
 
 #include <iterator>
 
+#include <boost/range/adaptor/transformed.hpp>
+
 
 #include <algorithms/test_simplify.hpp>
 #include <boost/geometry/geometries/geometries.hpp>
@@ -191,6 +193,127 @@ void test_zigzag()
 }
 
 
+// Straightforward recursive version, using real distances
+template <typename P>
+void reference_douglas_peucker(std::vector<P> const& points,
+        std::size_t first, std::size_t last, double max_distance,
+        std::vector<bool>& included)
+{
+    typedef bg::model::referring_segment<P const> segment_type;
+    double max_found = -1.0;
+    std::size_t candidate = first;
+    for (std::size_t i = first + 1; i < last; i++)
+    {
+        double const d = bg::distance(points[i],
+                                      segment_type(points[first], points[last]));
+        if (d > max_found)
+        {
+            max_found = d;
+            candidate = i;
+        }
+    }
+    if (max_found > max_distance)
+    {
+        included[candidate] = true;
+        reference_douglas_peucker(points, first, candidate, max_distance, included);
+        reference_douglas_peucker(points, candidate, last, max_distance, included);
+    }
+}
+
+template <typename P>
+void test_long_line()
+{
+    typedef bg::strategy::simplify::douglas_peucker
+        <
+            P, bg::strategy::distance::projected_point<double>
+        > dp;
+
+    // Random walks, simplified with the same buffer
+    typename dp::buffer_type buffer;
+    for (int n = 0; n < 3; n++)
+    {
+        std::vector<P> line;
+        double x = 0, y = 0;
+        unsigned int seed = 12345 + n;
+        for (int i = 0; i < 20000 * (n + 1); i++)
+        {
+            seed = seed * 1103515245u + 12345u;
+            x += ((seed >> 8) % 1000) / 500.0 - 1.0;
+            seed = seed * 1103515245u + 12345u;
+            y += ((seed >> 8) % 1000) / 500.0 - 0.98;
+            line.push_back(P(x, y));
+        }
+
+        std::vector<bool> included(line.size(), false);
+        included.front() = included.back() = true;
+        reference_douglas_peucker(line, 0, line.size() - 1, 2.0, included);
+        std::vector<P> expected;
+        for (std::size_t i = 0; i < line.size(); i++)
+        {
+            if (included[i])
+            {
+                expected.push_back(line[i]);
+            }
+        }
+
+        std::vector<P> simplified;
+        dp::apply(line, std::back_inserter(simplified), 2.0, buffer);
+        BOOST_CHECK_EQUAL(simplified.size(), expected.size());
+        for (std::size_t i = 0; i < simplified.size() && i < expected.size(); i++)
+        {
+            BOOST_CHECK(bg::equals(simplified[i], expected[i]));
+        }
+    }
+}
+
+// Returns the points by value, such that the iterators of the transformed
+// range don't return references
+template <typename P>
+struct translated_point
+{
+    typedef P result_type;
+
+    P operator()(P const& p) const
+    {
+        return P(bg::get<0>(p) + 1000.0, bg::get<1>(p));
+    }
+};
+
+template <typename P>
+void test_transformed_range()
+{
+    typedef bg::strategy::simplify::douglas_peucker
+        <
+            P, bg::strategy::distance::projected_point<double>
+        > dp;
+
+    std::vector<P> line, translated;
+    double x = 0, y = 0;
+    unsigned int seed = 54321;
+    for (int i = 0; i < 1000; i++)
+    {
+        seed = seed * 1103515245u + 12345u;
+        x += ((seed >> 8) % 1000) / 500.0 - 1.0;
+        seed = seed * 1103515245u + 12345u;
+        y += ((seed >> 8) % 1000) / 500.0 - 0.98;
+        line.push_back(P(x, y));
+        translated.push_back(translated_point<P>()(line.back()));
+    }
+
+    typename dp::buffer_type buffer;
+    std::vector<P> expected, simplified;
+    dp::apply(translated, std::back_inserter(expected), 2.0, buffer);
+    dp::apply(line | boost::adaptors::transformed(translated_point<P>()),
+              std::back_inserter(simplified), 2.0, buffer);
+
+    BOOST_CHECK_EQUAL(simplified.size(), expected.size());
+    for (std::size_t i = 0; i < simplified.size() && i < expected.size(); i++)
+    {
+        BOOST_CHECK(bg::equals(simplified[i], expected[i]));
+    }
+}
+
+
 template <typename P>
 void test_spherical()
 {
@@ -211,6 +334,8 @@ int test_main(int, char* [])
     test_spherical<bg::model::point<double, 2, bg::cs::spherical_equatorial<bg::degree> > >();
 
     test_zigzag<bg::model::d2::point_xy<double> >();
+    test_long_line<bg::model::d2::point_xy<double> >();
+    test_transformed_range<bg::model::d2::point_xy<double> >();
 
 #if defined(HAVE_TTMATH)
     test_all<bg::model::d2::point_xy<ttmath_big> >();
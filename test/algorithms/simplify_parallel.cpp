@@ -0,0 +1,251 @@
+// Boost.Geometry (aka GGL, Generic Geometry Library)
+// Unit Test
+
+// Copyright (c) 2026 agent.
+
+// Use, modification and distribution is subject to the Boost Software License,
+// Version 1.0. (See accompanying file LICENSE_1_0.txt or copy at
+// http://www.boost.org/LICENSE_1_0.txt)
+
+#define BOOST_GEOMETRY_EXPERIMENTAL_ENABLE_PARALLEL_SIMPLIFY
+#define BOOST_GEOMETRY_SIMPLIFY_THREADS 4
+
+#include <geometry_test_common.hpp>
+
+#include <string>
+#include <vector>
+
+#include <boost/geometry/geometry.hpp>
+#include <boost/geometry/geometries/point_xy.hpp>
+#include <boost/geometry/multi/geometries/multi_linestring.hpp>
+#include <boost/geometry/multi/geometries/multi_polygon.hpp>
+
+
+// Simplifies recursively, as the serial version, comparing squared distances
+template <typename Range>
+void reference_douglas_peucker(Range const& points,
+        std::size_t first, std::size_t last, double max_distance,
+        std::vector<bool>& included)
+{
+    typedef typename boost::range_value<Range>::type point_type;
+    typedef bg::model::referring_segment<point_type const> segment_type;
+    double max_found = -1.0;
+    std::size_t candidate = first;
+    for (std::size_t i = first + 1; i < last; i++)
+    {
+        double const d = bg::comparable_distance(points[i],
+                            segment_type(points[first], points[last]));
+        if (d > max_found)
+        {
+            max_found = d;
+            candidate = i;
+        }
+    }
+    if (max_found > max_distance * max_distance)
+    {
+        included[candidate] = true;
+        reference_douglas_peucker(points, first, candidate, max_distance, included);
+        reference_douglas_peucker(points, candidate, last, max_distance, included);
+    }
+}
+
+template <typename Range>
+void reference_simplify(Range const& range, Range& out,
+        double max_distance, std::size_t minimum)
+{
+    if (range.size() <= minimum)
+    {
+        out = range;
+        return;
+    }
+    std::vector<bool> included(range.size(), false);
+    included.front() = included.back() = true;
+    reference_douglas_peucker(range, 0, range.size() - 1, max_distance, included);
+    for (std::size_t i = 0; i < range.size(); i++)
+    {
+        if (included[i])
+        {
+            out.push_back(range[i]);
+        }
+    }
+}
+
+// The result should be identical, point by point
+template <typename Range>
+void check_equal(std::string const& caseid, Range const& simplified,
+        Range const& expected)
+{
+    BOOST_CHECK_MESSAGE(simplified.size() == expected.size(),
+            caseid << " detected: " << simplified.size()
+            << " expected: " << expected.size());
+    bool equal = true;
+    for (std::size_t i = 0; i < simplified.size() && i < expected.size(); i++)
+    {
+        if (bg::get<0>(simplified[i]) != bg::get<0>(expected[i])
+            || bg::get<1>(simplified[i]) != bg::get<1>(expected[i]))
+        {
+            equal = false;
+        }
+    }
+    BOOST_CHECK_MESSAGE(equal, caseid << " points differ");
+}
+
+template <typename Range>
+void random_walk(Range& range, std::size_t count, unsigned int seed)
+{
+    typedef typename boost::range_value<Range>::type point_type;
+    double x = 0, y = 0;
+    for (std::size_t i = 0; i < count; i++)
+    {
+        seed = seed * 1103515245u + 12345u;
+        x += ((seed >> 8) % 1000) / 500.0 - 1.0;
+        seed = seed * 1103515245u + 12345u;
+        y += ((seed >> 8) % 1000) / 500.0 - 0.98;
+        range.push_back(point_type(x, y));
+    }
+}
+
+template <typename P>
+void test_linestring()
+{
+    typedef bg::model::linestring<P> linestring;
+
+    linestring line;
+    random_walk(line, 200000, 12345);
+    for (int i = 0; i < 4; i++)
+    {
+        double const max_distance = 0.5 + i * 2.0;
+        linestring simplified, expected;
+        bg::simplify(line, simplified, max_distance);
+        reference_simplify(line, expected, max_distance, 2);
+        check_equal("linestring", simplified, expected);
+    }
+}
+
+template <typename P>
+void test_multi_linestring()
+{
+    typedef bg::model::linestring<P> linestring;
+    typedef bg::model::multi_linestring<linestring> multi_linestring;
+
+    // Many small ones, and a large one in the middle
+    multi_linestring multi;
+    multi.resize(41);
+    for (std::size_t i = 0; i < multi.size(); i++)
+    {
+        random_walk(multi[i], i == 20 ? 50000 : 500 + i * 10,
+                    unsigned(54321 + i));
+    }
+    multi[10].resize(2);
+
+    multi_linestring simplified;
+    bg::simplify(multi, simplified, 1.5);
+    BOOST_CHECK_EQUAL(simplified.size(), multi.size());
+    for (std::size_t i = 0; i < multi.size() && i < simplified.size(); i++)
+    {
+        linestring expected;
+        reference_simplify(multi[i], expected, 1.5, 2);
+        check_equal("multi_linestring", simplified[i], expected);
+    }
+}
+
+template <typename Ring>
+void star(Ring& ring, double cx, double cy, double r1, double r2, int count)
+{
+    typedef typename boost::range_value<Ring>::type point_type;
+    double const pi = bg::math::pi<double>();
+    for (int i = 0; i < count; i++)
+    {
+        double const angle = 2.0 * pi * i / count;
+        // Jagged, and varying slowly
+        double const r = (i % 2 == 0 ? r1 : r2) + 0.1 * r1 * sin(angle * 7.0);
+        ring.push_back(point_type(cx + r * cos(angle), cy + r * sin(angle)));
+    }
+    ring.push_back(ring.front());
+}
+
+template <typename P>
+void test_multi_polygon()
+{
+    typedef bg::model::polygon<P> polygon;
+    typedef bg::model::ring<P> ring;
+    typedef bg::model::multi_polygon<polygon> multi_polygon;
+
+    multi_polygon multi;
+    multi.resize(12);
+    for (std::size_t i = 0; i < multi.size(); i++)
+    {
+        double const cx = i * 300.0;
+        star(multi[i].outer(), cx, 0.0, 100.0, 99.0, 2000 + 100 * int(i));
+        multi[i].inners().resize(2);
+        star(multi[i].inners()[0], cx - 40.0, 0.0, 20.0, 19.9, 500);
+        star(multi[i].inners()[1], cx + 40.0, 0.0, 20.0, 19.9, 3);
+    }
+    bg::correct(multi);
+
+    multi_polygon simplified;
+    bg::simplify(multi, simplified, 0.5);
+    BOOST_CHECK_EQUAL(simplified.size(), multi.size());
+    for (std::size_t i = 0; i < multi.size() && i < simplified.size(); i++)
+    {
+        ring expected;
+        reference_simplify(multi[i].outer(), expected, 0.5, 4);
+        check_equal("multi_polygon exterior", simplified[i].outer(), expected);
+
+        BOOST_CHECK_EQUAL(simplified[i].inners().size(), multi[i].inners().size());
+        for (std::size_t j = 0; j < multi[i].inners().size()
+                && j < simplified[i].inners().size(); j++)
+        {
+            ring expected_inner;
+            reference_simplify(multi[i].inners()[j], expected_inner, 0.5, 4);
+            check_equal("multi_polygon interior", simplified[i].inners()[j],
+                        expected_inner);
+        }
+    }
+}
+
+// Records the number of threads a task (e.g. douglas_peucker within a
+// concurrent simplify of a multi-geometry) would use
+struct recording_tasks
+{
+    explicit recording_tasks(std::vector<std::size_t>& counts)
+        : m_counts(counts)
+    {}
+
+    inline std::size_t size() const
+    {
+        return m_counts.size();
+    }
+
+    inline void run(std::size_t i) const
+    {
+        m_counts[i] = bg::detail::parallel::threads_count(4);
+    }
+
+    std::vector<std::size_t>& m_counts;
+};
+
+void test_nested_threads()
+{
+    BOOST_CHECK_EQUAL(bg::detail::parallel::threads_count(4), 4u);
+
+    std::vector<std::size_t> counts(64, 0);
+    bg::detail::parallel::run_tasks(recording_tasks(counts), 4);
+    for (std::size_t i = 0; i < counts.size(); i++)
+    {
+        BOOST_CHECK_EQUAL(counts[i], 1u);
+    }
+
+    // The calling thread is not marked anymore
+    BOOST_CHECK_EQUAL(bg::detail::parallel::threads_count(4), 4u);
+}
+
+int test_main(int, char* [])
+{
+    test_nested_threads();
+    typedef bg::model::d2::point_xy<double> point;
+    test_linestring<point>();
+    test_multi_linestring<point>();
+    test_multi_polygon<point>();
+    return 0;
+}
@@ -0,0 +1,195 @@
+// Boost.Geometry (aka GGL, Generic Geometry Library)
+// Unit Test
+
+// Copyright (c) 2026 agent.
+
+// Use, modification and distribution is subject to the Boost Software License,
+// Version 1.0. (See accompanying file LICENSE_1_0.txt or copy at
+// http://www.boost.org/LICENSE_1_0.txt)
+
+#include <geometry_test_common.hpp>
+
+#include <algorithm>
+#include <string>
+#include <vector>
+
+#include <boost/geometry/geometry.hpp>
+#include <boost/geometry/algorithms/simplify_preserving_topology.hpp>
+#include <boost/geometry/geometries/point_xy.hpp>
+#include <boost/geometry/multi/geometries/multi_polygon.hpp>
+#include <boost/geometry/io/wkt/wkt.hpp>
+
+
+// Points of a jagged edge between two corners, the same for both directions
+template <typename P>
+std::vector<P> jagged_edge(P const& a, P const& b, int count, double amplitude)
+{
+    if (bg::less<P>()(b, a))
+    {
+        std::vector<P> result = jagged_edge(b, a, count, amplitude);
+        std::reverse(result.begin(), result.end());
+        return result;
+    }
+
+    double const dx = bg::get<0>(b) - bg::get<0>(a);
+    double const dy = bg::get<1>(b) - bg::get<1>(a);
+    double const length = sqrt(dx * dx + dy * dy);
+
+    std::vector<P> result;
+    result.push_back(a);
+    for (int k = 1; k < count; k++)
+    {
+        double const f = double(k) / count;
+        double const offset = amplitude * sin(k * 1.7
+                    + bg::get<0>(a) * 0.37 + bg::get<1>(a) * 0.71);
+        result.push_back(P(bg::get<0>(a) + f * dx - offset * dy / length,
+                           bg::get<1>(a) + f * dy + offset * dx / length));
+    }
+    result.push_back(b);
+    return result;
+}
+
+// Square cells of a grid, sharing their jagged borders
+template <typename MultiPolygon>
+void parcels(MultiPolygon& multi, int columns, int rows, double size,
+             int count, double amplitude)
+{
+    typedef typename boost::range_value<MultiPolygon>::type polygon_type;
+    typedef typename bg::point_type<MultiPolygon>::type point_type;
+
+    for (int i = 0; i < columns; i++)
+    {
+        for (int j = 0; j < rows; j++)
+        {
+            point_type const corners[5] =
+                {
+                    point_type(i * size, j * size),
+                    point_type(i * size, (j + 1) * size),
+                    point_type((i + 1) * size, (j + 1) * size),
+                    point_type((i + 1) * size, j * size),
+                    point_type(i * size, j * size)
+                };
+
+            polygon_type polygon;
+            for (int c = 0; c < 4; c++)
+            {
+                std::vector<point_type> const edge
+                    = jagged_edge(corners[c], corners[c + 1], count, amplitude);
+                bg::append(polygon, std::vector<point_type>(
+                        edge.begin() + (c == 0 ? 0 : 1), edge.end()));
+            }
+            multi.push_back(polygon);
+        }
+    }
+    bg::correct(multi);
+}
+
+// The parts should be valid, without gaps or overlaps. The multi-polygon
+// itself is not valid, its polygons share borders.
+template <typename MultiPolygon>
+void check_coverage(std::string const& caseid, MultiPolygon const& multi)
+{
+    MultiPolygon total;
+    double sum = 0;
+    for (std::size_t i = 0; i < multi.size(); i++)
+    {
+        BOOST_CHECK_MESSAGE(bg::is_valid(multi[i]),
+                caseid << " polygon " << i << " is not valid");
+
+        MultiPolygon united;
+        bg::union_(total, multi[i], united);
+        total = united;
+        sum += bg::area(multi[i]);
+    }
+
+    BOOST_CHECK_EQUAL(total.size(), 1u);
+    BOOST_CHECK_MESSAGE(total.size() == 1 && total.front().inners().empty(),
+            caseid << " has gaps");
+    BOOST_CHECK_CLOSE(bg::area(total), sum, 1.0e-6);
+}
+
+template <typename MultiPolygon>
+void test_parcels(std::string const& caseid, int columns, int rows,
+                  double max_distance)
+{
+    MultiPolygon multi;
+    parcels(multi, columns, rows, 10.0, 20, 0.3);
+    check_coverage(caseid + "_input", multi);
+
+    MultiPolygon simplified;
+    bg::simplify_preserving_topology(multi, simplified, max_distance);
+    BOOST_CHECK_EQUAL(simplified.size(), multi.size());
+    BOOST_CHECK(bg::num_points(simplified) < bg::num_points(multi));
+    check_coverage(caseid, simplified);
+}
+
+template <typename Geometry>
+void test_geometry(std::string const& caseid, std::string const& wkt,
+                   std::string const& expected, double max_distance)
+{
+    Geometry geometry, simplified;
+    bg::read_wkt(wkt, geometry);
+    bg::simplify_preserving_topology(geometry, simplified, max_distance);
+
+    Geometry expected_geometry;
+    bg::read_wkt(expected, expected_geometry);
+    BOOST_CHECK_MESSAGE(bg::equals(simplified, expected_geometry),
+            caseid << " detected: " << bg::wkt(simplified)
+            << " expected: " << expected);
+}
+
+template <typename P>
+void test_all()
+{
+    typedef bg::model::polygon<P> polygon;
+    typedef bg::model::multi_polygon<polygon> multi_polygon;
+    typedef bg::model::polygon<P, false, false> ccw_open_polygon;
+    typedef bg::model::multi_polygon<ccw_open_polygon> ccw_open_multi_polygon;
+
+    test_parcels<multi_polygon>("parcels", 4, 3, 0.5);
+    test_parcels<multi_polygon>("parcels_coarse", 3, 3, 4.0);
+    test_parcels<ccw_open_multi_polygon>("parcels_ccw_open", 3, 2, 0.5);
+
+    // The hole is filled by an island, the wiggle is removed from both
+    test_geometry<multi_polygon>("island",
+        "MULTIPOLYGON(((0 0,0 10,10 10,10 0,0 0),(2 2,8 2,8 5,8.1 6,8 8,2 8,2 2)),"
+        "((2 2,2 8,8 8,8.1 6,8 5,8 2,2 2)))",
+        "MULTIPOLYGON(((0 0,0 10,10 10,10 0,0 0),(2 2,8 2,8 8,2 8,2 2)),"
+        "((2 2,2 8,8 8,8 2,2 2)))",
+        0.5);
+
+    // The notch would be removed, putting the island inside the polygon.
+    // The island touches the polygon at its first point.
+    test_geometry<multi_polygon>("island_in_notch",
+        "MULTIPOLYGON(((0 0,0 10,5 6,10 10,10 0,0 0)),((0 10,3 9.5,3 8.5,0 10)))",
+        "MULTIPOLYGON(((0 0,0 10,5 6,10 10,10 0,0 0)),((0 10,3 9.5,3 8.5,0 10)))",
+        5.0);
+
+    test_geometry<polygon>("bump",
+        "POLYGON((0 0,0 10,5 12,10 10,10 0,0 0))",
+        "POLYGON((0 0,0 10,10 10,10 0,0 0))",
+        3.0);
+
+    // The simplified exterior ring would cross the hole, or leave it
+    // outside, so it is kept
+    test_geometry<polygon>("bump_hole_crossing",
+        "POLYGON((0 0,0 10,5 12,10 10,10 0,0 0),(4.5 9.5,5.5 9.5,5.5 11,4.5 11,4.5 9.5))",
+        "POLYGON((0 0,0 10,5 12,10 10,10 0,0 0),(4.5 9.5,5.5 9.5,5.5 11,4.5 11,4.5 9.5))",
+        3.0);
+    test_geometry<polygon>("bump_hole_outside",
+        "POLYGON((0 0,0 10,5 12,10 10,10 0,0 0),(4.5 10.5,5.5 10.5,5.5 11,4.5 11,4.5 10.5))",
+        "POLYGON((0 0,0 10,5 12,10 10,10 0,0 0),(4.5 10.5,5.5 10.5,5.5 11,4.5 11,4.5 10.5))",
+        3.0);
+
+    // Rings are not collapsed
+    test_geometry<polygon>("small_ring",
+        "POLYGON((0 0,0 10,10 10,10 0,0 0),(4 4,4.1 4.1,4 4.1,4 4))",
+        "POLYGON((0 0,0 10,10 10,10 0,0 0),(4 4,4.1 4.1,4 4.1,4 4))",
+        1.0);
+}
+
+int test_main(int, char* [])
+{
+    test_all<bg::model::d2::point_xy<double> >();
+    return 0;
+}
@@ -0,0 +1,157 @@
+// Boost.Geometry (aka GGL, Generic Geometry Library)
+// Unit Test
+
+// Copyright (c) 2026 agent.
+
+// Use, modification and distribution is subject to the Boost Software License,
+// Version 1.0. (See accompanying file LICENSE_1_0.txt or copy at
+// http://www.boost.org/LICENSE_1_0.txt)
+
+#include <geometry_test_common.hpp>
+
+#include <iterator>
+#include <string>
+#include <vector>
+
+#include <boost/geometry/geometry.hpp>
+#include <boost/geometry/algorithms/simplify_stream.hpp>
+#include <boost/geometry/geometries/point_xy.hpp>
+
+
+template <typename P>
+std::vector<P> random_walk(std::size_t count, unsigned int seed)
+{
+    std::vector<P> result;
+    double x = 0, y = 0;
+    for (std::size_t i = 0; i < count; i++)
+    {
+        seed = seed * 1103515245u + 12345u;
+        x += ((seed >> 8) % 1000) / 500.0 - 1.0;
+        seed = seed * 1103515245u + 12345u;
+        y += ((seed >> 8) % 1000) / 500.0 - 0.98;
+        result.push_back(P(x, y));
+    }
+    return result;
+}
+
+template <typename P>
+std::vector<P> stream(std::vector<P> const& points, double max_distance,
+                      std::size_t window_size)
+{
+    typedef std::back_insert_iterator<std::vector<P> > iterator_type;
+    std::vector<P> result;
+    bg::simplify_stream<P, iterator_type> simplifier(
+        std::back_inserter(result), max_distance, window_size);
+    for (std::size_t i = 0; i < points.size(); i++)
+    {
+        simplifier.push(points[i]);
+    }
+    simplifier.finish();
+    return result;
+}
+
+// The output should be an ordered subset of the input, including the first
+// and last point, and all removed points should be within max_distance of
+// the output segment spanning them
+template <typename P>
+void check_stream(std::string const& caseid, std::vector<P> const& points,
+                  std::vector<P> const& simplified, double max_distance)
+{
+    typedef bg::model::referring_segment<P const> segment_type;
+
+    BOOST_CHECK(simplified.size() >= 2);
+    BOOST_CHECK(bg::equals(simplified.front(), points.front()));
+    BOOST_CHECK(bg::equals(simplified.back(), points.back()));
+
+    std::size_t index = 0;
+    std::size_t far_count = 0;
+    for (std::size_t s = 1; s < simplified.size(); s++)
+    {
+        std::size_t const first = index;
+        while (index + 1 < points.size()
+               && ! bg::equals(points[++index], simplified[s]))
+        {}
+        BOOST_CHECK_MESSAGE(bg::equals(points[index], simplified[s]),
+                caseid << " point " << s << " is not in the input");
+        segment_type segment(points[first], points[index]);
+        for (std::size_t i = first + 1; i < index; i++)
+        {
+            if (bg::distance(points[i], segment) > max_distance)
+            {
+                far_count++;
+            }
+        }
+    }
+    BOOST_CHECK_MESSAGE(far_count == 0,
+            caseid << " " << far_count << " points are too far");
+}
+
+template <typename P>
+void test_all()
+{
+    std::vector<P> const walk = random_walk<P>(20000, 12345);
+
+    // With a window larger than the input it is the same as simplify
+    {
+        bg::model::linestring<P> line(walk.begin(), walk.end()), expected;
+        bg::simplify(line, expected, 2.0);
+        std::vector<P> const simplified = stream(walk, 2.0, walk.size() + 1);
+        BOOST_CHECK_EQUAL(simplified.size(), expected.size());
+        bool equal = simplified.size() == expected.size();
+        for (std::size_t i = 0; i < simplified.size() && equal; i++)
+        {
+            equal = bg::equals(simplified[i], expected[i]);
+        }
+        BOOST_CHECK(equal);
+    }
+
+    // Smaller windows: the same distance semantics, a few more points
+    std::size_t const window_sizes[] = { 3, 16, 256 };
+    for (int w = 0; w < 3; w++)
+    {
+        for (int d = 0; d < 3; d++)
+        {
+            double const max_distance = 0.5 + d * 2.0;
+            std::vector<P> const simplified
+                = stream(walk, max_distance, window_sizes[w]);
+            check_stream("walk", walk, simplified, max_distance);
+            BOOST_CHECK(simplified.size() < walk.size());
+        }
+    }
+
+    // A straight line keeps a point per half window
+    std::vector<P> straight;
+    for (int i = 0; i < 1000; i++)
+    {
+        straight.push_back(P(i, 2 * i));
+    }
+    std::vector<P> const simplified = stream(straight, 0.1, 100);
+    check_stream("straight", straight, simplified, 0.1);
+    BOOST_CHECK(simplified.size() <= 1000 / 50 + 2);
+
+    // After finish a new sequence starts
+    {
+        typedef std::back_insert_iterator<std::vector<P> > iterator_type;
+        std::vector<P> result;
+        bg::simplify_stream<P, iterator_type> simplifier(
+            std::back_inserter(result), 0.5, 16);
+        simplifier.finish();
+        BOOST_CHECK(result.empty());
+        simplifier.push(P(0, 0));
+        simplifier.push(P(1, 0.1));
+        simplifier.push(P(2, 0));
+        simplifier.finish();
+        simplifier.push(P(5, 5));
+        simplifier.finish();
+        BOOST_CHECK_EQUAL(result.size(), 3u);
+    }
+
+    // A negative distance keeps all points
+    BOOST_CHECK_EQUAL(stream(straight, -1.0, 16).size(), straight.size());
+}
+
+int test_main(int, char* [])
+{
+    test_all<bg::model::d2::point_xy<double> >();
+    return 0;
+}
@@ -0,0 +1,344 @@
+// Boost.Geometry (aka GGL, Generic Geometry Library)
+// Unit Test
+
+// Copyright (c) 2026 agent.
+
+// Use, modification and distribution is subject to the Boost Software License,
+// Version 1.0. (See accompanying file LICENSE_1_0.txt or copy at
+// http://www.boost.org/LICENSE_1_0.txt)
+
+#include <iterator>
+#include <sstream>
+#include <string>
+#include <vector>
+
+#include <boost/cstdint.hpp>
+
+#include <geometry_test_common.hpp>
+
+#include <boost/geometry/geometries/geometries.hpp>
+#include <boost/geometry/geometries/point_xy.hpp>
+
+#include <boost/geometry/io/io.hpp>
+#include <boost/geometry/io/wkb/wkb.hpp>
+#include <boost/geometry/io/wkt/read.hpp>
+#include <boost/geometry/io/wkt/write.hpp>
+
+
+typedef std::vector<unsigned char> bytes_type;
+
+// Hexadecimal WKB, as shown by databases (for example: select ST_AsEWKB(...))
+bytes_type from_hex(std::string const& hex)
+{
+    bytes_type result;
+    for (std::size_t i = 0; i + 1 < hex.size(); i += 2)
+    {
+        std::istringstream in(hex.substr(i, 2));
+        unsigned int value = 0;
+        in >> std::hex >> value;
+        result.push_back(static_cast<unsigned char>(value));
+    }
+    return result;
+}
+
+std::string to_hex(bytes_type const& bytes)
+{
+    static char const digits[] = "0123456789ABCDEF";
+    std::string result;
+    for (std::size_t i = 0; i < bytes.size(); i++)
+    {
+        result += digits[bytes[i] >> 4];
+        result += digits[bytes[i] & 0x0F];
+    }
+    return result;
+}
+
+template <typename G>
+std::string as_wkt(G const& geometry)
+{
+    std::ostringstream out;
+    out << bg::wkt(geometry);
+    return out.str();
+}
+
+
+// Reads the WKT, writes it as WKB and reads that back,
+// which should give the same WKT
+template <typename G>
+void test_round_trip(std::string const& wkt, std::string const& expected_wkt,
+            bg::wkb_byte_order byte_order)
+{
+    G geometry;
+    bg::read_wkt(wkt, geometry);
+
+    bytes_type wkb;
+    bg::write_wkb(geometry, std::back_inserter(wkb), byte_order);
+    BOOST_CHECK(! wkb.empty());
+    BOOST_CHECK_EQUAL(wkb[0], byte_order == bg::wkb_little_endian ? 1 : 0);
+
+    G result;
+    bytes_type::const_iterator it = bg::read_wkb(wkb.begin(), wkb.end(), result);
+    BOOST_CHECK(it == wkb.end());
+    BOOST_CHECK_EQUAL(as_wkt(result), expected_wkt);
+
+    // The same, as EWKB with an SRID
+    bytes_type ewkb;
+    bg::write_ewkb(geometry, std::back_inserter(ewkb), 4326, byte_order);
+    BOOST_CHECK_EQUAL(ewkb.size(), wkb.size() + 4);
+
+    G ewkb_result;
+    boost::uint32_t srid = 0;
+    bg::read_wkb(ewkb.begin(), ewkb.end(), ewkb_result, srid);
+    BOOST_CHECK_EQUAL(srid, 4326u);
+    BOOST_CHECK_EQUAL(as_wkt(ewkb_result), expected_wkt);
+
+    // Reading into a geometry which was used before
+    bg::read_wkb(wkb.begin(), wkb.end(), ewkb_result);
+    BOOST_CHECK_EQUAL(as_wkt(ewkb_result), expected_wkt);
+
+    // Every truncated WKB should be rejected
+    for (std::size_t i = 0; i < wkb.size(); i++)
+    {
+        G truncated;
+        BOOST_CHECK_THROW(bg::read_wkb(wkb.begin(), wkb.begin() + i, truncated),
+                          bg::read_wkb_exception);
+    }
+}
+
+template <typename G>
+void test_round_trip(std::string const& wkt, std::string const& expected_wkt)
+{
+    test_round_trip<G>(wkt, expected_wkt, bg::wkb_little_endian);
+    test_round_trip<G>(wkt, expected_wkt, bg::wkb_big_endian);
+}
+
+template <typename G>
+void test_round_trip(std::string const& wkt)
+{
+    test_round_trip<G>(wkt, wkt);
+}
+
+
+// Compares with the hexadecimal WKB as written by PostGIS
+template <typename G>
+void test_hex(std::string const& wkt, std::string const& hex,
+            bg::wkb_byte_order byte_order = bg::wkb_little_endian)
+{
+    G geometry;
+    bg::read_wkt(wkt, geometry);
+
+    bytes_type wkb;
+    bg::write_wkb(geometry, std::back_inserter(wkb), byte_order);
+    BOOST_CHECK_EQUAL(to_hex(wkb), hex);
+
+    G result;
+    bytes_type const bytes = from_hex(hex);
+    bg::read_wkb(bytes.begin(), bytes.end(), result);
+    BOOST_CHECK_EQUAL(as_wkt(result), as_wkt(geometry));
+}
+
+template <typename G>
+void test_read_hex(std::string const& hex, std::string const& expected_wkt,
+            boost::uint32_t expected_srid = 0)
+{
+    bytes_type const bytes = from_hex(hex);
+    G geometry;
+    boost::uint32_t srid = 0;
+    bg::read_wkb(bytes.begin(), bytes.end(), geometry, srid);
+    BOOST_CHECK_EQUAL(as_wkt(geometry), expected_wkt);
+    BOOST_CHECK_EQUAL(srid, expected_srid);
+}
+
+template <typename G>
+void test_wrong_wkb(std::string const& hex, std::string const& start_of_message)
+{
+    bytes_type const bytes = from_hex(hex);
+    G geometry;
+    std::string message;
+    try
+    {
+        bg::read_wkb(bytes.begin(), bytes.end(), geometry);
+    }
+    catch(bg::read_wkb_exception const& e)
+    {
+        message = e.what();
+    }
+    BOOST_CHECK_MESSAGE(boost::starts_with(message, start_of_message),
+            "WKB: " << hex
+            << " expected: " << start_of_message
+            << " got: " << message);
+}
+
+
+template <typename P>
+void test_all()
+{
+    typedef bg::model::linestring<P> linestring;
+    typedef bg::model::ring<P> ring;
+    typedef bg::model::polygon<P> polygon;
+    typedef bg::model::multi_point<P> multi_point;
+    typedef bg::model::multi_linestring<linestring> multi_linestring;
+    typedef bg::model::multi_polygon<polygon> multi_polygon;
+
+    test_round_trip<P>("POINT(1 2)");
+    test_round_trip<P>("POINT(-1 100)");
+    test_round_trip<linestring>("LINESTRING(1 1,2 2,3 3)");
+    test_round_trip<linestring>("LINESTRING()");
+    test_round_trip<ring>("POLYGON((0 0,0 1,1 1,1 0,0 0))");
+    test_round_trip<ring>("POLYGON(())");
+    test_round_trip<polygon>("POLYGON((0 0,0 10,10 10,10 0,0 0),(1 1,2 1,2 2,1 2,1 1))");
+    test_round_trip<polygon>("POLYGON((0 0,0 10,10 10,10 0,0 0))");
+    test_round_trip<polygon>("POLYGON(())", "POLYGON(())");
+    test_round_trip<multi_point>("MULTIPOINT((1 2),(3 4))");
+    test_round_trip<multi_point>("MULTIPOINT()");
+    test_round_trip<multi_linestring>("MULTILINESTRING((1 1,2 2),(3 3,4 4,5 5))");
+    test_round_trip<multi_polygon>("MULTIPOLYGON(((0 0,0 10,10 10,10 0,0 0),(1 1,2 1,2 2,1 2,1 1)),((20 20,20 30,30 30,20 20)))");
+
+    // Non-OGC geometries
+    test_round_trip<bg::model::box<P> >("BOX(1 2,3 4)", "POLYGON((1 2,1 4,3 4,3 2,1 2))");
+    test_round_trip<bg::model::segment<P> >("SEGMENT(1 2,3 4)", "LINESTRING(1 2,3 4)");
+
+    // Rings are written closed, and read open again (WKT writes them closed)
+    test_round_trip<bg::model::ring<P, true, false> >(
+            "POLYGON((0 0,0 1,1 1,1 0))");
+    test_round_trip<bg::model::polygon<P, false, false> >(
+            "POLYGON((0 0,10 0,10 10,0 10),(2 2,2 8,8 8,8 2))",
+            "POLYGON((0 0,10 0,10 10,0 10,0 0),(2 2,2 8,8 8,8 2,2 2))");
+    test_round_trip<ring>("POLYGON((0 0,0 1,1 1,1 0))",
+            "POLYGON((0 0,0 1,1 1,1 0,0 0))");
+    {
+        ring closed_ring;
+        bg::read_wkt("POLYGON((0 0,0 1,1 1,1 0,0 0))", closed_ring);
+        bytes_type wkb;
+        bg::write_wkb(closed_ring, std::back_inserter(wkb));
+
+        bg::model::ring<P, true, false> open_ring;
+        bg::read_wkb(wkb.begin(), wkb.end(), open_ring);
+        BOOST_CHECK_EQUAL(boost::size(open_ring), 4u);
+    }
+
+    // Known bytes (select ST_AsBinary(...) in PostGIS)
+    test_hex<P>("POINT(1 2)",
+            "0101000000000000000000F03F0000000000000040");
+    test_hex<P>("POINT(1 2)",
+            "00000000013FF00000000000004000000000000000", bg::wkb_big_endian);
+    test_hex<linestring>("LINESTRING(1 2,3 4)",
+            "010200000002000000"
+            "000000000000F03F0000000000000040"
+            "00000000000008400000000000001040");
+    test_hex<bg::model::box<P> >("BOX(0 0,1 1)",
+            "010300000001000000050000000000000000000000000000000000000000000000"
+            "00000000000000000000F03F000000000000F03F000000000000F03F000000000000"
+            "F03F000000000000000000000000000000000000000000000000");
+    test_hex<multi_point>("MULTIPOINT((1 2))",
+            "010400000001000000"
+            "0101000000000000000000F03F0000000000000040");
+
+    // EWKB of PostGIS (select ST_AsEWKB('SRID=4326;POINT(1 2)'))
+    test_read_hex<P>("0101000020E6100000000000000000F03F0000000000000040",
+            "POINT(1 2)", 4326);
+    // Big endian EWKB
+    test_read_hex<P>("0020000001000010E63FF00000000000004000000000000000",
+            "POINT(1 2)", 4326);
+    // M is skipped: ISO POINT M (1 2 3) and EWKB POINTM(1 2 3)
+    test_read_hex<P>("01D1070000000000000000F03F00000000000000400000000000000840",
+            "POINT(1 2)");
+    test_read_hex<P>("0101000040000000000000F03F00000000000000400000000000000840",
+            "POINT(1 2)");
+
+    // Elements of a multi geometry can have another byte order
+    test_read_hex<multi_point>("010400000002000000"
+            "0101000000000000000000F03F0000000000000040"
+            "00000000013FF00000000000004000000000000000",
+            "MULTIPOINT((1 2),(1 2))");
+
+    test_wrong_wkb<P>("", "Unexpected end of WKB");
+    test_wrong_wkb<P>("0201000000000000000000F03F0000000000000040",
+            "Invalid byte order");
+    test_wrong_wkb<P>("0102000000000000000000F03F0000000000000040",
+            "Unexpected geometry type");
+    test_wrong_wkb<P>("0101100000000000000000F03F0000000000000040",
+            "Invalid geometry type");
+    test_wrong_wkb<P>("01E9030000000000000000F03F00000000000000400000000000000840",
+            "Z only allowed for 3 or more dimensions");
+    test_wrong_wkb<P>("0101000080000000000000F03F00000000000000400000000000000840",
+            "Z only allowed for 3 or more dimensions");
+    // A linestring claiming more points than there are bytes
+    test_wrong_wkb<linestring>("0102000000FFFFFFFF000000000000F03F",
+            "Unexpected end of WKB");
+    test_wrong_wkb<bg::model::segment<P> >("010200000001000000"
+            "000000000000F03F0000000000000040", "Segment should have 2 points");
+    test_wrong_wkb<ring>("010300000002000000",
+            "Ring should not have interior rings");
+
+    // Two geometries in one buffer
+    {
+        bytes_type buffer;
+        bg::write_wkb(P(1, 2), std::back_inserter(buffer));
+        bg::write_wkb(P(3, 4), std::back_inserter(buffer), bg::wkb_big_endian);
+
+        P p1, p2;
+        bytes_type::iterator it = bg::read_wkb(buffer.begin(), buffer.end(), p1);
+        it = bg::read_wkb(it, buffer.end(), p2);
+        BOOST_CHECK(it == buffer.end());
+        BOOST_CHECK_EQUAL(as_wkt(p1), "POINT(1 2)");
+        BOOST_CHECK_EQUAL(as_wkt(p2), "POINT(3 4)");
+    }
+
+    // Read from characters, also by read<format_wkb>
+    {
+        std::string wkb;
+        bg::write_wkb(P(1, 2), std::back_inserter(wkb));
+
+        P p;
+        bg::read<bg::format_wkb>(p, wkb);
+        BOOST_CHECK_EQUAL(as_wkt(p), "POINT(1 2)");
+    }
+}
+
+template <typename P>
+void test_3d()
+{
+    typedef bg::model::linestring<P> linestring;
+    typedef bg::model::polygon<P> polygon;
+
+    test_round_trip<P>("POINT(1 2 3)");
+    test_round_trip<linestring>("LINESTRING(1 2 3,4 5 6)");
+    test_round_trip<polygon>("POLYGON((0 0 1,0 1 1,1 1 1,0 0 1))");
+    test_round_trip<bg::model::segment<P> >("SEGMENT(1 2 3,4 5 6)",
+            "LINESTRING(1 2 3,4 5 6)");
+
+    // ISO POINT Z (1 2 3)
+    test_hex<P>("POINT(1 2 3)",
+            "01E9030000000000000000F03F00000000000000400000000000000840");
+
+    // EWKB POINT(1 2 3) with and without SRID
+    test_read_hex<P>("0101000080000000000000F03F00000000000000400000000000000840",
+            "POINT(1 2 3)");
+    test_read_hex<P>("01010000A0E6100000000000000000F03F00000000000000400000000000000840",
+            "POINT(1 2 3)", 4326);
+    {
+        bytes_type ewkb;
+        bg::write_ewkb(P(1, 2, 3), std::back_inserter(ewkb), 4326);
+        BOOST_CHECK_EQUAL(to_hex(ewkb),
+            "01010000A0E6100000000000000000F03F00000000000000400000000000000840");
+    }
+
+    // ZM: M is skipped
+    test_read_hex<P>("01B90B0000000000000000F03F000000000000004000000000000008400000000000001040",
+            "POINT(1 2 3)");
+
+    // 2D WKB read into a 3D point: Z is zero
+    test_read_hex<P>("0101000000000000000000F03F0000000000000040",
+            "POINT(1 2 0)");
+}
+
+int test_main(int, char* [])
+{
+    test_all<bg::model::d2::point_xy<double> >();
+    test_all<bg::model::point<float, 2, bg::cs::cartesian> >();
+    test_all<bg::model::d2::point_xy<int> >();
+    test_3d<bg::model::point<double, 3, bg::cs::cartesian> >();
+
+    return 0;
+}
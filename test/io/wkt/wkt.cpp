@@ -17,10 +17,13 @@
 // Version 1.0. (See accompanying file LICENSE_1_0.txt or copy at
 // http://www.boost.org/LICENSE_1_0.txt)
 
+#include <iomanip>
 #include <sstream>
 #include <string>
 
 #include <boost/algorithm/string.hpp>
+#include <boost/lexical_cast.hpp>
+#include <boost/math/special_functions/fpclassify.hpp>
 
 #include <geometry_test_common.hpp>
 
@@ -137,6 +140,125 @@ void test_wrong_wkt(std::string const& wkt, std::string const& start)
     }
 }
 
+// Coordinates should be read exactly as by lexical_cast, also if they are
+// converted without it
+template <typename T>
+void test_coordinate(std::string const& value)
+{
+    typedef bg::model::point<T, 2, bg::cs::cartesian> P;
+
+    std::string const wkt = "POINT(" + value + " 1)";
+    bool expected_exception = false, exception = false;
+    T expected = 0;
+    try
+    {
+        expected = boost::lexical_cast<T>(value);
+    }
+    catch(boost::bad_lexical_cast const&)
+    {
+        expected_exception = true;
+    }
+
+    P point;
+    try
+    {
+        bg::read_wkt(wkt, point);
+    }
+    catch(bg::read_wkt_exception const&)
+    {
+        exception = true;
+    }
+
+    BOOST_CHECK_MESSAGE(exception == expected_exception,
+            "Exception for " << wkt << " : " << exception);
+    if (! exception && ! expected_exception
+        && ! boost::math::isnan(expected))
+    {
+        BOOST_CHECK_MESSAGE(bg::get<0>(point) == expected
+                && (bg::get<0>(point) < 0) == (expected < 0)
+                && (1 / bg::get<0>(point) < 0) == (1 / expected < 0),
+                std::setprecision(20) << "Coordinate of " << wkt << " : "
+                << bg::get<0>(point) << " expected: " << expected);
+    }
+}
+
+template <typename T>
+void test_coordinates()
+{
+    char const* const values[] =
+        {
+            "0", "-0", "+0", "0.0", "-0.0", "00012", "1.", ".5", "+.5e-3",
+            "1e5", "1E+5", "1e-0", "1.e2", "0.1", "0.3", "2.2250738585072014e-308",
+            "1e22", "1e23", "1e-22", "1e-23", "9007199254740993",
+            "9007199254740992", "123456789012345678901234567890",
+            "0.000000000000000000000000000001", "1.7976931348623157e308",
+            "1e400", "1e-400", "0e99999", "16777217", "3.4028235e38",
+            "nan", "inf", "-inf", "INF",
+            "1e", "-", ".", "-.", "e5", "1.5.2", "1e+", "1d5", "0x10", "+-1",
+            "1e5.5", "1\t2"
+        };
+    for (std::size_t i = 0; i < sizeof(values) / sizeof(values[0]); i++)
+    {
+        test_coordinate<T>(values[i]);
+    }
+
+    unsigned int seed = 1234;
+    for (int i = 0; i < 20000; i++)
+    {
+        seed = seed * 1103515245u + 12345u;
+        int const digits = 1 + (seed >> 8) % 22;
+        seed = seed * 1103515245u + 12345u;
+        int const point = (seed >> 8) % (digits + 1);
+
+        std::string value = (seed >> 20) % 2 == 0 ? "" : "-";
+        for (int d = 0; d < digits; d++)
+        {
+            if (d == point)
+            {
+                value += ".";
+            }
+            seed = seed * 1103515245u + 12345u;
+            value += char('0' + (seed >> 8) % 10);
+        }
+        seed = seed * 1103515245u + 12345u;
+        if ((seed >> 8) % 3 == 0)
+        {
+            value += "e" + boost::lexical_cast<std::string>(int((seed >> 12) % 61) - 30);
+        }
+        test_coordinate<T>(value);
+    }
+}
+
+template <typename T>
+void test_character_range()
+{
+    typedef bg::model::point<T, 2, bg::cs::cartesian> P;
+    typedef bg::model::polygon<P> polygon;
+
+    // Geometries in one buffer, read without copying
+    std::string const buffer = "POINT(1 2)POLYGON((0 0,0 4,4 4,4 0,0 0))";
+    char const* first = buffer.data();
+
+    P point;
+    bg::read_wkt(first, first + 10, point);
+    check_wkt(point, "POINT(1 2)");
+
+    polygon poly;
+    bg::read_wkt(first + 10, first + buffer.size(), poly);
+    check_wkt(poly, "POLYGON((0 0,0 4,4 4,4 0,0 0))");
+
+    bool exception = false;
+    try
+    {
+        bg::read_wkt(first, first + 9, point);
+    }
+    catch(bg::read_wkt_exception const& e)
+    {
+        exception = boost::contains(std::string(e.what()), "POINT(1 2'");
+    }
+    BOOST_CHECK_MESSAGE(exception, "Expected exception with the WKT");
+}
+
 template <typename G>
 void test_wkt_output_iterator(std::string const& wkt)
 {
@@ -231,6 +353,7 @@ void test_all()
     test_wrong_wkt<P>("POINT(a 2 3)", "bad lexical cast");
     test_wrong_wkt<P>("POINT 2 3", "expected '('");
     test_wrong_wkt<P>("POINT Z (1 2 3)", "z only allowed");
+    test_wrong_wkt<P>("POINT(1\t2)", "bad lexical cast");
 
     test_wrong_wkt<P>("PIONT (1 2)", "should start with 'point'");
 
@@ -253,6 +376,7 @@ void test_all()
     // test_wkt_output_iterator<bg::model::ring<P> >("POLYGON((1 1,2 2,3 3))");
 
     test_order_closure<T>();
+    test_character_range<T>();
 }
 #endif
 
@@ -261,6 +385,11 @@ int test_main(int, char* [])
     test_all<double>();
     test_all<int>();
 
+#ifndef GEOMETRY_TEST_MULTI
+    test_coordinates<double>();
+    test_coordinates<float>();
+#endif
+
 #if defined(HAVE_TTMATH)
     test_all<ttmath_big>();
 #endif
@@ -0,0 +1,137 @@
+// Boost.Geometry (aka GGL, Generic Geometry Library)
+// Unit Test
+
+// Copyright (c) 2026 agent.
+
+// Use, modification and distribution is subject to the Boost Software License,
+// Version 1.0. (See accompanying file LICENSE_1_0.txt or copy at
+// http://www.boost.org/LICENSE_1_0.txt)
+
+
+#include <geometry_test_common.hpp>
+
+#include <cmath>
+#include <string>
+
+#include <boost/geometry/algorithms/convex_hull.hpp>
+#include <boost/geometry/algorithms/equals.hpp>
+#include <boost/geometry/geometries/geometries.hpp>
+#include <boost/geometry/geometries/point_xy.hpp>
+#include <boost/geometry/multi/geometries/multi_point.hpp>
+#include <boost/geometry/multi/geometries/multi_polygon.hpp>
+#include <boost/geometry/io/wkt/wkt.hpp>
+#include <boost/geometry/strategies/strategies.hpp>
+#include <boost/geometry/strategies/cartesian/hull_akl_toussaint.hpp>
+
+
+// The hull should be the same as calculated by graham_andrew,
+// with the same points in the same order
+template <typename Geometry>
+void check_hull(std::string const& caseid, Geometry const& geometry)
+{
+    typedef typename bg::point_type<Geometry>::type point_type;
+    typedef bg::model::polygon<point_type> polygon;
+
+    polygon expected, hull;
+    bg::convex_hull(geometry, expected,
+        bg::strategy::convex_hull::graham_andrew<Geometry, point_type>());
+    bg::convex_hull(geometry, hull,
+        bg::strategy::convex_hull::akl_toussaint<Geometry, point_type>());
+
+    bool equal = bg::num_points(hull) == bg::num_points(expected);
+    for (std::size_t i = 0; equal && i < hull.outer().size(); i++)
+    {
+        equal = bg::equals(hull.outer()[i], expected.outer()[i]);
+    }
+    BOOST_CHECK_MESSAGE(equal,
+        caseid << " detected: " << bg::wkt(hull)
+        << " expected: " << bg::wkt(expected));
+}
+
+template <typename Geometry>
+void test_geometry(std::string const& caseid, std::string const& wkt)
+{
+    Geometry geometry;
+    bg::read_wkt(wkt, geometry);
+    check_hull(caseid, geometry);
+}
+
+template <typename P>
+void test_clouds()
+{
+    typedef bg::model::multi_point<P> multi_point;
+
+    multi_point square, disk, circle, grid;
+    unsigned int seed = 12345;
+    for (int i = 0; i < 100000; i++)
+    {
+        seed = seed * 1103515245u + 12345u;
+        double const u = ((seed >> 8) % 100000) / 100000.0;
+        seed = seed * 1103515245u + 12345u;
+        double const v = ((seed >> 8) % 100000) / 100000.0;
+
+        square.push_back(P(u * 100.0, v * 50.0));
+
+        double const angle = u * 2.0 * bg::math::pi<double>();
+        disk.push_back(P(std::sqrt(v) * std::cos(angle),
+                         std::sqrt(v) * std::sin(angle)));
+
+        // (Nearly) all points are outside the octagon
+        double const radius = 1.0 - v * 0.05;
+        circle.push_back(P(radius * std::cos(angle), radius * std::sin(angle)));
+
+        // Many points share the extreme coordinates
+        grid.push_back(P(double((seed >> 8) % 20), double((seed >> 16) % 20)));
+    }
+
+    check_hull("square", square);
+    check_hull("disk", disk);
+    check_hull("circle", circle);
+    check_hull("grid", grid);
+}
+
+template <typename P>
+void test_all()
+{
+    typedef bg::model::multi_point<P> multi_point;
+    typedef bg::model::linestring<P> linestring;
+    typedef bg::model::polygon<P> polygon;
+    typedef bg::model::multi_polygon<polygon> multi_polygon;
+
+    test_geometry<linestring>("linestring",
+        "LINESTRING(1.1 1.1,2.5 2.1,3.1 3.1,4.9 1.1,3.1 1.9)");
+    test_geometry<polygon>("concave",
+        "POLYGON((1 1,1 4,3 4,3 3,4 3,4 4,5 4,5 1,1 1))");
+    test_geometry<polygon>("polygon",
+        "POLYGON((2.0 1.3,2.4 1.7,2.8 1.8,3.4 1.2,3.7 1.6,3.4 2.0,4.1 3.0,"
+        "5.3 2.6,5.4 1.2,4.9 0.8,2.9 0.7,2.0 1.3))");
+    test_geometry<multi_polygon>("multi_polygon",
+        "MULTIPOLYGON(((0 0,0 2,2 2,2 0,0 0)),((5 5,5 7,7 7,7 5,5 5)))");
+
+    // Points inside, on the edges and on the vertices of the octagon
+    test_geometry<multi_point>("octagon",
+        "MULTIPOINT(0 1,1 0,2 0,3 1,3 2,2 3,1 3,0 2,1.5 1.5,1 1,0.5 0.5,"
+        "2.5 0.5,0 1.5,1.5 0)");
+    test_geometry<multi_point>("diamond",
+        "MULTIPOINT(0 2,2 0,4 2,2 4,2 2,1 1,3 3,1 3,3 1,2 3.9)");
+
+    // Degenerate octagons
+    test_geometry<multi_point>("collinear",
+        "MULTIPOINT(0 0,1 1,2 2,3 3,1.5 1.5)");
+    test_geometry<multi_point>("horizontal",
+        "MULTIPOINT(0 0,3 0,1 0,2 0)");
+    test_geometry<multi_point>("triangle",
+        "MULTIPOINT(0 0,4 0,0 4,1 1,0 0,4 0)");
+    test_geometry<multi_point>("two", "MULTIPOINT(0 0,1 1)");
+
+    test_clouds<P>();
+}
+
+
+int test_main(int, char* [])
+{
+    test_all<bg::model::d2::point_xy<double> >();
+    test_all<bg::model::d2::point_xy<float> >();
+
+    return 0;
+}
@@ -0,0 +1,219 @@
+// Boost.Geometry (aka GGL, Generic Geometry Library)
+// Unit Test
+
+// Copyright (c) 2026 agent.
+
+// Use, modification and distribution is subject to the Boost Software License,
+// Version 1.0. (See accompanying file LICENSE_1_0.txt or copy at
+// http://www.boost.org/LICENSE_1_0.txt)
+
+
+#include <geometry_test_common.hpp>
+
+#include <algorithm>
+#include <string>
+#include <vector>
+
+#include <boost/range/adaptor/transformed.hpp>
+
+#include <boost/geometry/algorithms/equals.hpp>
+#include <boost/geometry/algorithms/simplify.hpp>
+#include <boost/geometry/geometries/geometries.hpp>
+#include <boost/geometry/geometries/point_xy.hpp>
+#include <boost/geometry/multi/geometries/multi_linestring.hpp>
+#include <boost/geometry/multi/geometries/multi_polygon.hpp>
+#include <boost/geometry/io/wkt/wkt.hpp>
+#include <boost/geometry/strategies/cartesian/simplify_visvalingam_whyatt.hpp>
+
+
+template <typename P>
+double triangle_area(P const& p1, P const& p2, P const& p3)
+{
+    double const dx1 = bg::get<0>(p2) - bg::get<0>(p1);
+    double const dy1 = bg::get<1>(p2) - bg::get<1>(p1);
+    double const dx2 = bg::get<0>(p3) - bg::get<0>(p1);
+    double const dy2 = bg::get<1>(p3) - bg::get<1>(p1);
+    return std::abs(dx1 * dy2 - dy1 * dx2) / 2.0;
+}
+
+// Removes the point with the smallest effective area, one after another,
+// by recalculating all areas, in O(n^2)
+template <typename P>
+std::vector<P> reference_visvalingam(std::vector<P> const& points,
+        double min_area, std::size_t max_points)
+{
+    std::vector<std::size_t> remaining;
+    for (std::size_t i = 0; i < points.size(); i++)
+    {
+        remaining.push_back(i);
+    }
+    std::vector<double> minimum(points.size(), 0.0);
+
+    while (remaining.size() > 2)
+    {
+        std::size_t best = 0;
+        double best_area = -1.0;
+        for (std::size_t i = 1; i + 1 < remaining.size(); i++)
+        {
+            double const area = (std::max)(minimum[remaining[i]],
+                triangle_area(points[remaining[i - 1]], points[remaining[i]],
+                              points[remaining[i + 1]]));
+            if (best_area < 0 || area < best_area)
+            {
+                best = i;
+                best_area = area;
+            }
+        }
+        if (! (best_area < min_area)
+            && (max_points == 0 || remaining.size() <= max_points))
+        {
+            break;
+        }
+        // The neighbours get at least the area of the removed point
+        minimum[remaining[best - 1]] = (std::max)(minimum[remaining[best - 1]], best_area);
+        minimum[remaining[best + 1]] = (std::max)(minimum[remaining[best + 1]], best_area);
+        remaining.erase(remaining.begin() + best);
+    }
+
+    std::vector<P> result;
+    for (std::size_t i = 0; i < remaining.size(); i++)
+    {
+        result.push_back(points[remaining[i]]);
+    }
+    return result;
+}
+
+template <typename P>
+void check_reference(std::string const& caseid, std::vector<P> const& points,
+        double min_area, std::size_t max_points)
+{
+    typedef bg::strategy::simplify::visvalingam_whyatt<P> strategy_type;
+
+    std::vector<P> simplified;
+    strategy_type(max_points).apply(points, std::back_inserter(simplified),
+                                    min_area);
+    std::vector<P> const expected
+        = reference_visvalingam(points, min_area, max_points);
+
+    BOOST_CHECK_MESSAGE(simplified.size() == expected.size(),
+            caseid << " detected: " << simplified.size()
+            << " expected: " << expected.size());
+    bool equal = simplified.size() == expected.size();
+    for (std::size_t i = 0; i < simplified.size() && i < expected.size(); i++)
+    {
+        equal = equal && bg::equals(simplified[i], expected[i]);
+    }
+    BOOST_CHECK_MESSAGE(equal, caseid << " points differ");
+}
+
+// Returns the points by value, such that the iterators of the transformed
+// range don't return references
+template <typename P>
+struct point_copy
+{
+    typedef P result_type;
+
+    P operator()(P const& p) const
+    {
+        return p;
+    }
+};
+
+template <typename Geometry, typename Strategy>
+void test_geometry(std::string const& caseid, std::string const& wkt,
+        std::string const& expected, double min_area, Strategy const& strategy)
+{
+    Geometry geometry, simplified;
+    bg::read_wkt(wkt, geometry);
+    bg::simplify(geometry, simplified, min_area, strategy);
+
+    std::ostringstream out;
+    out << bg::wkt(simplified);
+    BOOST_CHECK_MESSAGE(out.str() == expected,
+            caseid << " detected: " << out.str() << " expected: " << expected);
+}
+
+template <typename P>
+void test_all()
+{
+    typedef bg::strategy::simplify::visvalingam_whyatt<P> strategy_type;
+    typedef bg::model::linestring<P> linestring;
+    typedef bg::model::polygon<P> polygon;
+    typedef bg::model::multi_linestring<linestring> multi_linestring;
+
+    strategy_type const strategy;
+
+    // The middle point forms a triangle with area 1
+    test_geometry<linestring>("triangle",
+        "LINESTRING(0 0,1 1,2 0)", "LINESTRING(0 0,1 1,2 0)", 1.0, strategy);
+    test_geometry<linestring>("triangle_removed",
+        "LINESTRING(0 0,1 1,2 0)", "LINESTRING(0 0,2 0)", 1.01, strategy);
+    test_geometry<linestring>("collinear",
+        "LINESTRING(0 0,1 0,2 0,3 0,4 0)", "LINESTRING(0 0,4 0)", 0.001, strategy);
+
+    // The small spike at 3 is removed first, then its neighbours get larger
+    // areas and are kept
+    test_geometry<linestring>("spikes",
+        "LINESTRING(0 0,1 1,2 0,3 0.1,4 0,5 3,6 0)",
+        "LINESTRING(0 0,1 1,2 0,4 0,5 3,6 0)", 0.5, strategy);
+
+    // To N points, the area is not used. Of the equal areas (1 1 and 2 0)
+    // the first is removed, then 2 0 gets area 0
+    test_geometry<linestring>("to_4",
+        "LINESTRING(0 0,1 1,2 0,3 0.1,4 0,5 3,6 0)",
+        "LINESTRING(0 0,4 0,5 3,6 0)", 0.0, strategy_type(4));
+    test_geometry<linestring>("to_1",
+        "LINESTRING(0 0,1 1,2 0,3 0.1,4 0,5 3,6 0)",
+        "LINESTRING(0 0,6 0)", 0.0, strategy_type(1));
+
+    test_geometry<polygon>("polygon",
+        "POLYGON((0 0,0 10,5 10.05,10 10,10 0,0 0),(2 2,8 2,8 8,5 7.99,2 8,2 2))",
+        "POLYGON((0 0,0 10,10 10,10 0,0 0),(2 2,8 2,8 8,2 8,2 2))", 0.5, strategy);
+    test_geometry<multi_linestring>("multi_linestring",
+        "MULTILINESTRING((0 0,1 0.1,2 0),(0 0,1 5,2 0))",
+        "MULTILINESTRING((0 0,2 0),(0 0,1 5,2 0))", 0.5, strategy);
+
+    // Random walks against the reference, with ties (integer coordinates)
+    for (int n = 0; n < 4; n++)
+    {
+        std::vector<P> points;
+        double x = 0, y = 0;
+        unsigned int seed = 4321 + n;
+        for (int i = 0; i < 300; i++)
+        {
+            seed = seed * 1103515245u + 12345u;
+            x += ((seed >> 8) % 7) - 3.0;
+            seed = seed * 1103515245u + 12345u;
+            y += ((seed >> 8) % 7) - 2.5;
+            points.push_back(P(x, y));
+        }
+
+        check_reference("random_area", points, 4.0, 0);
+        check_reference("random_area_large", points, 50.0, 0);
+        check_reference("random_to_n", points, 0.0, 40);
+        check_reference("random_both", points, 2.0, 100);
+
+        std::vector<P> simplified;
+        strategy_type(25).apply(points, std::back_inserter(simplified), 0.0);
+        BOOST_CHECK_EQUAL(simplified.size(), 25u);
+
+        std::vector<P> expected, simplified_transformed;
+        strategy_type(100).apply(points, std::back_inserter(expected), 2.0);
+        strategy_type(100).apply(points | boost::adaptors::transformed(point_copy<P>()),
+                                 std::back_inserter(simplified_transformed), 2.0);
+        BOOST_CHECK_EQUAL(simplified_transformed.size(), expected.size());
+        for (std::size_t i = 0; i < simplified_transformed.size() && i < expected.size(); i++)
+        {
+            BOOST_CHECK(bg::equals(simplified_transformed[i], expected[i]));
+        }
+    }
+}
+
+
+int test_main(int, char* [])
+{
+    test_all<bg::model::d2::point_xy<double> >();
+    test_all<bg::model::d2::point_xy<float> >();
+
+    return 0;
+}